@@ -44,8 +44,14 @@ FOUNDATION_EXPORT const unsigned char BibliotekVersionString[];
 #import <Bibliotek/BibMARCInputStream.h>
 #import <Bibliotek/BibMARCOutputStream.h>
 #import <Bibliotek/BibMARCSerialization.h>
+#import <Bibliotek/BibMARCMappedFile.h>
+#import <Bibliotek/BibMARCFileIndex.h>
+#import <Bibliotek/BibParallelRecordReader.h>
 #import <Bibliotek/BibMARCXMLInputStream.h>
 #import <Bibliotek/BibMARCXMLOutputStream.h>
 #import <Bibliotek/BibMARCXMLSerialization.h>
 
 #import <Bibliotek/BibLCCallNumber.h>
+#import <Bibliotek/BibLCCallNumberIndex.h>
+#import <Bibliotek/BibLCCallNumberInternTable.h>
+#import <Bibliotek/BibLCClassOutline.h>
@@ -0,0 +1,33 @@
+//
+//  BibLCCallNumber+Private.h
+//  Bibliotek
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+
+#import <Bibliotek/BibLCCallNumber.h>
+#import "bibtype.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface BibLCCallNumber ()
+
+/// The compact encoding of the call number represented by this object.
+///
+/// Encoded call numbers can be ordered with `bib_lc_calln_encoded_compare()` without decoding them.
+@property (nonatomic, readonly, assign) unsigned char const *encodedCallNumber NS_RETURNS_INNER_POINTER;
+
+/// Create a Library of Congress call number that takes ownership of the given parsed call number structure.
+/// - parameter calln: A successfully parsed call number. Its value is encoded into the new object and deinitialized.
+/// - returns: A new call number, or `nil` when memory for its encoding couldn't be allocated.
+- (nullable instancetype)initWithCallNumberStructure:(bib_lc_calln_t *)calln NS_DESIGNATED_INITIALIZER;
+
+/// Decode the call number represented by this object.
+/// - parameter calln: Allocated space for the call number structure,
+///                    which must be deinitialized with `bib_lc_calln_deinit()`.
+- (void)getCallNumberStructure:(bib_lc_calln_t *)calln;
+
+@end
+
+NS_ASSUME_NONNULL_END
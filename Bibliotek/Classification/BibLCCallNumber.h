@@ -112,6 +112,15 @@ BIB_SWIFT_BRIDGE(LCCallNumber) NS_SWIFT_SENDABLE
 /// A string representation of the call number.
 @property (nonatomic, readonly, copy) NSString *stringValue;
 
+/// A binary representation of the call number's linear shelf order.
+///
+/// Comparing the sort keys of two call numbers byte-by-byte, such as with `memcmp`, gives the same
+/// ordering as ``compare:``. Equivalent call numbers have identical sort keys.
+///
+/// Sort keys are suitable for storing in a database index or sorting with a radix sort, and can be
+/// compared without parsing the call numbers they represent.
+@property (nonatomic, readonly, copy) NSData *sortKey;
+
 /// Create a Library of Congress call number with the given string representation.
 /// - parameter string: The string value of the call number.
 - (nullable instancetype)initWithString:(NSString *)string NS_DESIGNATED_INITIALIZER;
@@ -120,11 +129,43 @@ BIB_SWIFT_BRIDGE(LCCallNumber) NS_SWIFT_SENDABLE
 /// - parameter string: The string value of the call number.
 + (nullable instancetype)callNumberWithString:(NSString *)string NS_SWIFT_UNAVAILABLE("Use init(string:)");
 
+/// Create Library of Congress call numbers for each of the given string representations.
+/// - parameter strings: The string values of the call numbers.
+/// - returns: An array with an element for each string, in the same order as `strings`. Each element is
+///            either a call number, or `NSNull` when the string at the same index isn't a valid call number.
+///
+/// Large arrays are parsed in parallel across the available processors, which is considerably faster
+/// than creating each call number with ``initWithString:``.
++ (NSArray *)callNumbersWithStrings:(NSArray<NSString *> *)strings NS_REFINED_FOR_SWIFT;
+
+/// Sort call numbers in shelf order.
+/// - parameter callNumbers: The call numbers to sort.
+/// - parameter inPlace: Set to `YES` to reorder the elements of `callNumbers`, which must be a mutable array.
+/// - parameter options: Use `NSSortConcurrent` to sort large arrays in parallel across the available processors.
+/// - returns: The call numbers ordered by ``compare:``. When `inPlace` is `YES`, this is `callNumbers`.
+///
+/// The sort is always stable, so equivalent call numbers keep their relative order. This is considerably
+/// faster than sorting with ``compare:`` because call numbers are compared without sending any messages.
++ (NSArray<BibLCCallNumber *> *)sortCallNumbers:(NSArray<BibLCCallNumber *> *)callNumbers
+                                        inPlace:(BOOL)inPlace
+                                        options:(NSSortOptions)options;
+
 /// Create a string representation of the call number using the given style attributes.
 /// - parameter options: Attributes describing the format of the resulting string value.
 /// - returns: A string representation of the call number in a format described by the given attributes.
 - (NSString *)stringWithFormatOptions:(BibLCCallNumberFormatOptions)options;
 
+/// Create string representations of many call numbers using the given style attributes.
+/// - parameter callNumbers: The call numbers to format.
+/// - parameter options: Attributes describing the format of each resulting string value.
+/// - returns: An array with the string representation of each call number, in the same order as `callNumbers`.
+///
+/// Use ``BibLCCallNumberFormatOptionsSpine`` or ``BibLCCallNumberFormatOptionsPocket`` to print labels
+/// for a whole batch of items. The call numbers are formatted together into a shared buffer, which is
+/// considerably faster than calling ``stringWithFormatOptions:`` on each call number.
++ (NSArray<NSString *> *)stringsWithCallNumbers:(NSArray<BibLCCallNumber *> *)callNumbers
+                                  formatOptions:(BibLCCallNumberFormatOptions)options;
+
 /// Determine the linear ordering relationship between two call numbers.
 ///
 /// - parameter callNumber: The call number being compared with the receiver.
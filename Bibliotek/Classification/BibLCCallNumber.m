@@ -7,6 +7,7 @@
 //
 
 #import "BibLCCallNumber.h"
+#import "BibLCCallNumber+Private.h"
 #import "bibtype.h"
 #import "bibtypeio.h"
 
@@ -18,8 +19,46 @@ BibLCCallNumberFormatOptions const BibLCCallNumberFormatOptionsSpine = BibLCCall
                                                                      | BibLCCallNumberFormatOptionsExpandCutterMarks
                                                                      | BibLCCallNumberFormatOptionsMultiline;
 
+/// The amount of call numbers parsed at a time by `+callNumbersWithStrings:`.
+/// This limits the size of temporary buffers when parsing very large arrays.
+static NSUInteger const BibLCCallNumberBatchCount = 1 << 16;
+
+/// The expected length of a formatted call number.
+/// This sizes the buffer used by `+stringsWithCallNumbers:formatOptions:` before any call numbers are formatted.
+static NSUInteger const BibLCCallNumberLabelLength = 32;
+
+/// The formatting style described by the given options.
+static bib_lc_calln_style_t BibLCCallNumberStyle(BibLCCallNumberFormatOptions const options)
+{
+    return (bib_lc_calln_style_t){
+        .separator = (options & BibLCCallNumberFormatOptionsMultiline) ? '\n' : ' ',
+        .split_subject = (options & BibLCCallNumberFormatOptionsExpandSubject) != 0,
+        .split_cutters = (options & BibLCCallNumberFormatOptionsExpandCutters) != 0,
+        .split_sections = (options & BibLCCallNumberFormatOptionsExpandCutterMarks) != 0,
+        .extra_cutpoint = (options & BibLCCallNumberFormatOptionsMarkCutterAfterDate) != 0
+    };
+}
+
+/// Create the heap-allocated compact encoding of the given call number.
+/// - parameter calln: The call number to encode.
+/// - parameter length: Set to the size of the encoding in bytes.
+/// - returns: A buffer containing the encoded call number, which must be freed by the caller,
+///            or `NULL` when the buffer couldn't be allocated.
+static unsigned char *BibLCCallNumberEncode(bib_lc_calln_t const *const calln, size_t *const length)
+{
+    *length = bib_lc_calln_encode(NULL, 0, calln);
+    unsigned char *const encoding = malloc(*length);
+    if (encoding == NULL) {
+        return NULL;
+    }
+    size_t __unused _ = bib_lc_calln_encode(encoding, *length, calln);
+    return encoding;
+}
+
 @implementation BibLCCallNumber {
-    bib_lc_calln_t _calln;
+    unsigned char *_encoding;
+    size_t _length;
+    uint64_t _fingerprint;
 }
 
 @synthesize stringValue = _stringValue;
@@ -29,7 +68,18 @@ BibLCCallNumberFormatOptions const BibLCCallNumberFormatOptionsSpine = BibLCCall
     if (self = [super init]) {
         NSCharacterSet *const whitespace = [NSCharacterSet whitespaceAndNewlineCharacterSet];
         NSString *const trimmed = [string stringByTrimmingCharactersInSet:whitespace];
-        if (!bib_lc_calln_init(&_calln, [trimmed cStringUsingEncoding:NSASCIIStringEncoding])) {
+        // parse on the stack, since only the compact encoding is kept
+        bib_lc_specification_t specifications[8];
+        bib_lc_specification_arena_t arena = {};
+        bib_lc_specification_arena_init(&arena, specifications, sizeof(specifications) / sizeof(*specifications));
+        bib_lc_calln_t calln = {};
+        if (!bib_lc_calln_init_arena(&calln, [trimmed cStringUsingEncoding:NSASCIIStringEncoding], &arena)) {
+            return nil;
+        }
+        _encoding = BibLCCallNumberEncode(&calln, &_length);
+        _fingerprint = calln.fingerprint;
+        bib_lc_calln_deinit(&calln);
+        if (_encoding == NULL) {
             return nil;
         }
     }
@@ -41,14 +91,119 @@ BibLCCallNumberFormatOptions const BibLCCallNumberFormatOptionsSpine = BibLCCall
     return [[BibLCCallNumber alloc] initWithString:string];
 }
 
+- (instancetype)initWithCallNumberStructure:(bib_lc_calln_t *)calln
+{
+    if (self = [super init]) {
+        _encoding = BibLCCallNumberEncode(calln, &_length);
+        _fingerprint = bib_lc_calln_fingerprint(calln);
+        bib_lc_calln_deinit(calln);
+        if (_encoding == NULL) {
+            return nil;
+        }
+    }
+    return self;
+}
+
++ (NSArray *)callNumbersWithStrings:(NSArray<NSString *> *)strings
+{
+    NSUInteger const count = [strings count];
+    NSMutableArray *const callNumbers = [NSMutableArray arrayWithCapacity:count];
+    NSCharacterSet *const whitespace = [NSCharacterSet whitespaceAndNewlineCharacterSet];
+    NSUInteger const capacity = MIN(count, BibLCCallNumberBatchCount);
+    NSMutableData *const characters = [NSMutableData data];
+    size_t *const offsets = calloc(capacity, sizeof(size_t));
+    char const **const cstrings = calloc(capacity, sizeof(char const *));
+    bib_lc_calln_t *const calls = calloc(capacity, sizeof(bib_lc_calln_t));
+    bool *const parsed = calloc(capacity, sizeof(bool));
+    for (NSUInteger start = 0; start < count; start += capacity) {
+        NSUInteger const length = MIN(capacity, count - start);
+        [characters setLength:0];
+        for (NSUInteger index = 0; index < length; index += 1) {
+            NSString *const trimmed = [strings[start + index] stringByTrimmingCharactersInSet:whitespace];
+            NSUInteger const size = [trimmed lengthOfBytesUsingEncoding:NSASCIIStringEncoding] + 1;
+            NSUInteger const offset = [characters length];
+            [characters increaseLengthBy:size];
+            BOOL const success = [trimmed getCString:(char *)[characters mutableBytes] + offset
+                                           maxLength:size
+                                            encoding:NSASCIIStringEncoding];
+            offsets[index] = (success) ? offset : SIZE_MAX;
+        }
+        char const *const buffer = [characters bytes];
+        for (NSUInteger index = 0; index < length; index += 1) {
+            cstrings[index] = (offsets[index] == SIZE_MAX) ? NULL : &(buffer[offsets[index]]);
+        }
+        size_t __unused _ = bib_lc_calln_init_batch(calls, cstrings, length, parsed, 0);
+        for (NSUInteger index = 0; index < length; index += 1) {
+            BibLCCallNumber *const callNumber = (parsed[index])
+                                              ? [[BibLCCallNumber alloc] initWithCallNumberStructure:&(calls[index])]
+                                              : nil;
+            [callNumbers addObject:callNumber ?: [NSNull null]];
+        }
+    }
+    free(offsets);
+    free(cstrings);
+    free(calls);
+    free(parsed);
+    return [callNumbers copy];
+}
+
++ (NSArray<BibLCCallNumber *> *)sortCallNumbers:(NSArray<BibLCCallNumber *> *)callNumbers
+                                        inPlace:(BOOL)inPlace
+                                        options:(NSSortOptions)options
+{
+    NSParameterAssert(!inPlace || [callNumbers isKindOfClass:[NSMutableArray class]]);
+    NSUInteger const count = [callNumbers count];
+    BibLCCallNumber *__unsafe_unretained *const objects = calloc(count, sizeof(BibLCCallNumber *));
+    unsigned char const **const encodings = calloc(count, sizeof(unsigned char const *));
+    size_t *const order = calloc(count, sizeof(size_t));
+    NSArray<BibLCCallNumber *> *sorted = nil;
+    if (objects != NULL && encodings != NULL && order != NULL) {
+        [callNumbers getObjects:objects range:NSMakeRange(0, count)];
+        for (NSUInteger index = 0; index < count; index += 1) {
+            encodings[index] = objects[index]->_encoding;
+        }
+        unsigned const threads = (options & NSSortConcurrent) ? 0 : 1;
+        if (bib_lc_calln_encoded_sort(order, encodings, count, threads)) {
+            NSMutableArray<BibLCCallNumber *> *const result = [NSMutableArray arrayWithCapacity:count];
+            for (NSUInteger index = 0; index < count; index += 1) {
+                [result addObject:objects[order[index]]];
+            }
+            sorted = result;
+        }
+    }
+    free(objects);
+    free(encodings);
+    free(order);
+    if (sorted == nil) {
+        sorted = [callNumbers sortedArrayWithOptions:NSSortStable usingComparator:^(id left, id right) {
+            return [left compare:right];
+        }];
+    }
+    if (inPlace) {
+        [(NSMutableArray<BibLCCallNumber *> *)callNumbers setArray:sorted];
+        return callNumbers;
+    }
+    return sorted;
+}
+
 - (id)copyWithZone:(NSZone *)zone
 {
     return self;
 }
 
+- (unsigned char const *)encodedCallNumber
+{
+    return _encoding;
+}
+
+- (void)getCallNumberStructure:(bib_lc_calln_t *)calln
+{
+    bool __unused _ = bib_lc_calln_decode(calln, _encoding, _length);
+}
+
 - (void)dealloc
 {
-    bib_lc_calln_deinit(&_calln);
+    free(_encoding);
 }
 
 - (NSString *)description {
@@ -66,41 +221,83 @@ BibLCCallNumberFormatOptions const BibLCCallNumberFormatOptionsSpine = BibLCCall
 - (NSString *)stringWithFormatOptions:(BibLCCallNumberFormatOptions)options
 {
     char buffer[] = (char[256]){};
-    bib_lc_calln_style_t style = {
-        .separator = ' ',
-        .split_subject = false,
-        .split_cutters = false,
-        .split_sections = false,
-        .extra_cutpoint = false
-    };
-    if (options & BibLCCallNumberFormatOptionsExpandSubject) {
-        style.split_subject = true;
-    }
-    if (options & BibLCCallNumberFormatOptionsExpandCutters) {
-        style.split_cutters = true;
+    bib_lc_calln_style_t const style = BibLCCallNumberStyle(options);
+    bib_lc_calln_t calln = {};
+    [self getCallNumberStructure:&calln];
+    size_t const length = bib_snprint_lc_calln(buffer, sizeof(buffer), &calln, style);
+    if (length < sizeof(buffer)) {
+        bib_lc_calln_deinit(&calln);
+        return [[NSString alloc] initWithBytes:buffer length:length encoding:NSASCIIStringEncoding];
     }
-    if (options & BibLCCallNumberFormatOptionsExpandCutterMarks) {
-        style.split_sections = true;
-    }
-    if (options & BibLCCallNumberFormatOptionsMultiline) {
-        style.separator = '\n';
-    }
-    if (options & BibLCCallNumberFormatOptionsMarkCutterAfterDate) {
-        style.extra_cutpoint = true;
+    char *const string = malloc(length + 1);
+    size_t __unused _ = bib_snprint_lc_calln(string, length + 1, &calln, style);
+    bib_lc_calln_deinit(&calln);
+    return [[NSString alloc] initWithBytesNoCopy:string length:length encoding:NSASCIIStringEncoding freeWhenDone:YES];
+}
+
++ (NSArray<NSString *> *)stringsWithCallNumbers:(NSArray<BibLCCallNumber *> *)callNumbers
+                                  formatOptions:(BibLCCallNumberFormatOptions)options
+{
+    bib_lc_calln_style_t const style = BibLCCallNumberStyle(options);
+    NSUInteger const count = [callNumbers count];
+    NSMutableArray<NSString *> *const strings = [NSMutableArray arrayWithCapacity:count];
+    NSUInteger const capacity = MIN(count, BibLCCallNumberBatchCount);
+    BibLCCallNumber *__unsafe_unretained *const objects = calloc(capacity, sizeof(BibLCCallNumber *));
+    bib_lc_calln_t *const calls = calloc(capacity, sizeof(bib_lc_calln_t));
+    size_t *const offsets = calloc(capacity, sizeof(size_t));
+    NSMutableData *const characters = [NSMutableData data];
+    for (NSUInteger start = 0; start < count; start += capacity) {
+        NSUInteger const length = MIN(capacity, count - start);
+        [callNumbers getObjects:objects range:NSMakeRange(start, length)];
+        for (NSUInteger index = 0; index < length; index += 1) {
+            BibLCCallNumber *const callNumber = objects[index];
+            bool __unused _ = bib_lc_calln_decode(&(calls[index]), callNumber->_encoding, callNumber->_length);
+        }
+        // guess the size of the labels to format them in a single pass, and only retry when the guess is too small
+        [characters setLength:MAX([characters length], length * BibLCCallNumberLabelLength)];
+        size_t const size = bib_lc_calln_format_batch([characters mutableBytes], [characters length], offsets,
+                                                      calls, length, style);
+        if (size > [characters length]) {
+            [characters setLength:size];
+            size_t __unused _ = bib_lc_calln_format_batch([characters mutableBytes], size, offsets,
+                                                          calls, length, style);
+        }
+        char const *const buffer = [characters bytes];
+        for (NSUInteger index = 0; index < length; index += 1) {
+            size_t const end = (index + 1 < length) ? offsets[index + 1] : size;
+            [strings addObject:[[NSString alloc] initWithBytes:&(buffer[offsets[index]])
+                                                        length:end - offsets[index] - 1
+                                                      encoding:NSASCIIStringEncoding]];
+            bib_lc_calln_deinit(&(calls[index]));
+        }
     }
-    size_t __unused _ = bib_snprint_lc_calln(buffer, sizeof(buffer), &_calln, style);
-    return [NSString stringWithCString:buffer encoding:NSASCIIStringEncoding];
+    free(objects);
+    free(calls);
+    free(offsets);
+    return [strings copy];
+}
+
+- (NSData *)sortKey
+{
+    size_t length = 0;
+    unsigned char const *const key = bib_lc_calln_encoded_sortkey(_encoding, &length);
+    return [NSData dataWithBytes:key length:length];
 }
 
 - (NSComparisonResult)compare:(BibLCCallNumber *)other
 {
-    switch ([self compareWithCallNumber:other forSpecialization:NO]) {
-        case BibClassificationOrderedSpecifying: return NSOrderedAscending;
-        case BibClassificationOrderedAscending: return NSOrderedAscending;
-        case BibClassificationOrderedSame: return NSOrderedSame;
-        case BibClassificationOrderedDescending: return NSOrderedDescending;
-        case BibClassificationOrderedGeneralizing: return NSOrderedDescending;
+    if (other == nil) {
+        return NSOrderedDescending;
+    }
+    switch (bib_lc_calln_fingerprint_compare(_fingerprint, other->_fingerprint, false)) {
+        case bib_calln_ordered_ascending: return NSOrderedAscending;
+        case bib_calln_ordered_descending: return NSOrderedDescending;
+        default: break;
     }
+    int const result = bib_lc_calln_encoded_compare(_encoding, other->_encoding);
+    return (result < 0) ? NSOrderedAscending
+         : (result > 0) ? NSOrderedDescending
+         : NSOrderedSame;
 }
 
 - (BibClassificationComparisonResult)compareWithCallNumber:(BibLCCallNumber *)other
@@ -114,11 +311,24 @@ BibLCCallNumberFormatOptions const BibLCCallNumberFormatOptionsSpine = BibLCCall
         return BibClassificationOrderedDescending;
     }
 
-    bib_lc_calln_t const *const leftn = &_calln;
-    bib_lc_calln_t const *const rightn = &(other->_calln);
+    if (_length == other->_length && memcmp(_encoding, other->_encoding, _length) == 0) {
+        return BibClassificationOrderedSame;
+    }
+    switch (bib_lc_calln_fingerprint_compare(_fingerprint, other->_fingerprint, specialize)) {
+        case bib_calln_ordered_ascending: return BibClassificationOrderedAscending;
+        case bib_calln_ordered_descending: return BibClassificationOrderedDescending;
+        default: break;
+    }
+
+    bib_lc_calln_t leftn = {};
+    bib_lc_calln_t rightn = {};
+    [self getCallNumberStructure:&leftn];
+    [other getCallNumberStructure:&rightn];
 
     bib_calln_comparison_t result = bib_calln_ordered_same;
-    result = bib_lc_calln_compare(result, leftn, rightn, specialize);
+    result = bib_lc_calln_compare(result, &leftn, &rightn, specialize);
+    bib_lc_calln_deinit(&leftn);
+    bib_lc_calln_deinit(&rightn);
     switch (result) {
         case bib_calln_ordered_same: return BibClassificationOrderedSame;
         case bib_calln_ordered_specifying: return BibClassificationOrderedSpecifying;
@@ -142,7 +352,7 @@ BibLCCallNumberFormatOptions const BibLCCallNumberFormatOptionsSpine = BibLCCall
 
 - (BOOL)isEqualToCallNumber:(BibLCCallNumber *)other
 {
-    return self == other || [self compareWithCallNumber:other forSpecialization:NO] == BibClassificationOrderedSame;
+    return self == other || (other != nil && bib_lc_calln_encoded_compare(_encoding, other->_encoding) == 0);
 }
 
 - (BOOL)isEqual:(id)object
@@ -153,7 +363,7 @@ BibLCCallNumberFormatOptions const BibLCCallNumberFormatOptionsSpine = BibLCCall
 
 - (NSUInteger)hash
 {
-    return [[self stringValue] hash];
+    return (NSUInteger)bib_lc_calln_encoded_hash(_encoding);
 }
 
 - (instancetype)init
@@ -26,11 +26,39 @@ public struct LCCallNumber: Sendable {
         self.storage = storage
     }
 
-    private init(storage: BibLCCallNumber) {
+    fileprivate init(storage: BibLCCallNumber) {
         self.storage = storage
     }
 }
 
+extension LCCallNumber {
+    /// Create Library of Congress call numbers for each of the given string representations.
+    /// - parameter strings: The string values of the call numbers.
+    /// - returns: An array with an element for each string, in the same order as `strings`.
+    ///            Elements are `nil` when the string at the same index isn't a valid call number.
+    ///
+    /// Large arrays are parsed in parallel across the available processors.
+    public static func callNumbers(_ strings: [String]) -> [LCCallNumber?] {
+        return BibLCCallNumber.__callNumbers(with: strings).map { element in
+            (element as? BibLCCallNumber).map(LCCallNumber.init(storage:))
+        }
+    }
+}
+
+extension LCCallNumberInternTable {
+    /// Get the shared call numbers for each of the given string representations.
+    /// - parameter strings: The string values of the call numbers.
+    /// - returns: An array with an element for each string, in the same order as `strings`.
+    ///            Elements are `nil` when the string at the same index isn't a valid call number.
+    ///
+    /// Strings not already in the table are parsed in parallel, and each distinct string is parsed only once.
+    public func callNumbers(_ strings: [String]) -> [LCCallNumber?] {
+        return self.__callNumbers(with: strings).map { element in
+            (element as? BibLCCallNumber).map(LCCallNumber.init(storage:))
+        }
+    }
+}
+
 extension LCCallNumber: RawRepresentable {
     public typealias RawValue = String
 
@@ -234,6 +262,11 @@ extension LCCallNumber: CustomStringConvertible, CustomDebugStringConvertible, C
     public func string(formatOptions: FormatOptions) -> String {
         self.storage.string(formatOptions: formatOptions)
     }
+
+    /// A binary representation of the call number's linear shelf order.
+    ///
+    /// Sort keys compare byte-by-byte in the same order as their call numbers.
+    public var sortKey: Data { return self.storage.sortKey }
 }
 
 // MARK: Bridging
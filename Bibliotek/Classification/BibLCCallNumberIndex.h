@@ -0,0 +1,120 @@
+//
+//  BibLCCallNumberIndex.h
+//  Bibliotek
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <Bibliotek/BibAttributes.h>
+
+@class BibLCCallNumber;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A collection of Library of Congress call numbers kept in shelf order.
+///
+/// Call numbers are stored in the linear order given by ``BibLCCallNumber/compare:``, which lets the index
+/// answer shelf-browsing queries with a binary search instead of checking every call number. Finding a
+/// range of call numbers takes `O(log n + k)` time, where `k` is the amount of call numbers in the result.
+///
+/// Equivalent call numbers, such as multiple copies of the same item, are kept in the order they were added.
+NS_SWIFT_NAME(LCCallNumberIndex)
+@interface BibLCCallNumberIndex : NSObject <NSFastEnumeration>
+
+/// The amount of call numbers in the index.
+@property (nonatomic, readonly) NSUInteger count;
+
+/// All call numbers in the index, in shelf order.
+@property (nonatomic, readonly, copy) NSArray<BibLCCallNumber *> *callNumbers;
+
+/// Create an index containing the given call numbers.
+/// - parameter callNumbers: The call numbers to add to the index, in any order.
+- (instancetype)initWithCallNumbers:(NSArray<BibLCCallNumber *> *)callNumbers;
+
+/// Create an index containing the given call numbers.
+/// - parameter callNumbers: The call numbers to add to the index, in any order.
++ (instancetype)indexWithCallNumbers:(NSArray<BibLCCallNumber *> *)callNumbers NS_SWIFT_UNAVAILABLE("Use init(callNumbers:)");
+
+/// Get the call number at the given position on the shelf.
+/// - parameter index: The position of the call number in shelf order.
+/// - returns: The call number at the given position.
+- (BibLCCallNumber *)callNumberAtIndex:(NSUInteger)index;
+
+/// Get the call number at the given position on the shelf.
+/// - parameter index: The position of the call number in shelf order.
+/// - returns: The call number at the given position.
+- (BibLCCallNumber *)objectAtIndexedSubscript:(NSUInteger)index;
+
+/// Find the position on the shelf where the given call number belongs.
+/// - parameter callNumber: The call number to find a position for.
+/// - returns: The index of the first call number in the index that isn't ordered before `callNumber`.
+///            This is ``count`` when every call number in the index is ordered before `callNumber`.
+- (NSUInteger)indexForCallNumber:(BibLCCallNumber *)callNumber;
+
+/// Find the call numbers in an inclusive range of classifications.
+/// - parameter lowerCallNumber: The first classification in the range.
+/// - parameter upperCallNumber: The last classification in the range.
+/// - returns: The call numbers ordered on or after `lowerCallNumber`, and ordered on or before `upperCallNumber`
+///            or included within it, in shelf order.
+///
+/// Call numbers that ``BibLCCallNumber/includesCallNumber:`` for `upperCallNumber` are within the range.
+/// For example, the range `QA76.7` to `QA76.9` contains `QA76.9.T48 I544 2013`.
+- (NSArray<BibLCCallNumber *> *)callNumbersFromCallNumber:(BibLCCallNumber *)lowerCallNumber
+                                             toCallNumber:(BibLCCallNumber *)upperCallNumber
+    NS_SWIFT_NAME(callNumbers(from:to:));
+
+/// Find the call numbers whose subject matter is included by the given classification.
+/// - parameter callNumber: The classification containing the resulting call numbers.
+/// - returns: The call numbers for which `callNumber` returns `YES` from ``BibLCCallNumber/includesCallNumber:``,
+///            in shelf order.
+///
+/// For example, the classification `QA76` includes `QA76`, `QA76.76.C65 A37 1986`, and `QA76.9.T48 I544 2013`.
+- (NSArray<BibLCCallNumber *> *)callNumbersIncludedByCallNumber:(BibLCCallNumber *)callNumber
+    NS_SWIFT_NAME(callNumbers(includedBy:));
+
+/// Find the call numbers shelved next to the given call number.
+/// - parameter callNumber: The call number whose neighbors are returned.
+/// - parameter count: The largest amount of call numbers returned from each side of `callNumber`.
+/// - returns: Up to `count` call numbers ordered before `callNumber`, followed by up to `count` call numbers
+///            ordered on or after it, in shelf order.
+- (NSArray<BibLCCallNumber *> *)callNumbersNearCallNumber:(BibLCCallNumber *)callNumber count:(NSUInteger)count
+    NS_SWIFT_NAME(callNumbers(near:count:));
+
+@end
+
+#pragma mark - Copying
+
+@interface BibLCCallNumberIndex (Copying) <NSCopying, NSMutableCopying>
+@end
+
+#pragma mark - Mutable
+
+/// A mutable collection of Library of Congress call numbers kept in shelf order.
+NS_SWIFT_NAME(MutableLCCallNumberIndex)
+@interface BibMutableLCCallNumberIndex : BibLCCallNumberIndex
+
+/// Add a call number at its position on the shelf.
+/// - parameter callNumber: The call number to add to the index.
+///
+/// The call number is placed after any equivalent call numbers already in the index.
+- (void)addCallNumber:(BibLCCallNumber *)callNumber;
+
+/// Add call numbers at their positions on the shelf.
+/// - parameter callNumbers: The call numbers to add to the index, in any order.
+- (void)addCallNumbers:(NSArray<BibLCCallNumber *> *)callNumbers;
+
+/// Remove a call number equivalent to the given value from the index.
+/// - parameter callNumber: The call number to remove from the index.
+///
+/// When the index contains multiple equivalent call numbers, the first is removed.
+- (void)removeCallNumber:(BibLCCallNumber *)callNumber;
+
+/// Remove the call number at the given position on the shelf.
+/// - parameter index: The position of the call number in shelf order.
+- (void)removeCallNumberAtIndex:(NSUInteger)index;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,254 @@
+//
+//  BibLCCallNumberIndex.m
+//  Bibliotek
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+
+#import "BibLCCallNumberIndex.h"
+#import "BibLCCallNumber.h"
+#import "BibLCCallNumber+Private.h"
+#import "bibtype.h"
+
+/// Is the left call number ordered before the right call number on the shelf?
+static BOOL BibLCCallNumberIsOrderedBefore(BibLCCallNumber *const left, BibLCCallNumber *const right)
+{
+    return bib_lc_calln_encoded_compare([left encodedCallNumber], [right encodedCallNumber]) < 0;
+}
+
+/// Does the classification include the given call number's subject matter?
+static BOOL BibLCCallNumberIncludes(bib_lc_calln_t const *const classification, BibLCCallNumber *const callNumber)
+{
+    bib_lc_calln_t calln = {};
+    [callNumber getCallNumberStructure:&calln];
+    bib_calln_comparison_t const result = bib_lc_calln_compare(bib_calln_ordered_same, classification, &calln, true);
+    bib_lc_calln_deinit(&calln);
+    return result == bib_calln_ordered_same || result == bib_calln_ordered_specifying;
+}
+
+@interface BibLCCallNumberIndex ()
+
+/// Create an index containing call numbers that are already in shelf order.
+/// - parameter callNumbers: The call numbers to add to the index, in shelf order.
+- (instancetype)initWithSortedCallNumbers:(NSArray<BibLCCallNumber *> *)callNumbers NS_DESIGNATED_INITIALIZER;
+
+@end
+
+@implementation BibLCCallNumberIndex {
+@protected
+    NSMutableArray<BibLCCallNumber *> *_callNumbers;
+}
+
+- (instancetype)initWithSortedCallNumbers:(NSArray<BibLCCallNumber *> *)callNumbers
+{
+    if (self = [super init]) {
+        _callNumbers = [callNumbers mutableCopy];
+    }
+    return self;
+}
+
+- (instancetype)initWithCallNumbers:(NSArray<BibLCCallNumber *> *)callNumbers
+{
+    return [self initWithSortedCallNumbers:[BibLCCallNumber sortCallNumbers:callNumbers
+                                                                     inPlace:NO
+                                                                     options:NSSortConcurrent]];
+}
+
++ (instancetype)indexWithCallNumbers:(NSArray<BibLCCallNumber *> *)callNumbers
+{
+    return [[self alloc] initWithCallNumbers:callNumbers];
+}
+
+- (instancetype)init
+{
+    return [self initWithSortedCallNumbers:@[]];
+}
+
+- (NSUInteger)count
+{
+    return [_callNumbers count];
+}
+
+- (NSArray<BibLCCallNumber *> *)callNumbers
+{
+    return [_callNumbers copy];
+}
+
+- (NSString *)description
+{
+    return [_callNumbers description];
+}
+
+- (BibLCCallNumber *)callNumberAtIndex:(NSUInteger)index
+{
+    return [_callNumbers objectAtIndex:index];
+}
+
+- (BibLCCallNumber *)objectAtIndexedSubscript:(NSUInteger)index
+{
+    return [_callNumbers objectAtIndex:index];
+}
+
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state
+                                  objects:(id __unsafe_unretained [])buffer
+                                    count:(NSUInteger)len
+{
+    return [_callNumbers countByEnumeratingWithState:state objects:buffer count:len];
+}
+
+#pragma mark - Search
+
+/// Find the first position within the given range where the predicate is no longer satisfied.
+/// - precondition: The predicate is satisfied by a prefix of the call numbers within the range, and no others.
+- (NSUInteger)indexInRange:(NSRange)range passingTest:(BOOL (NS_NOESCAPE ^)(BibLCCallNumber *callNumber))predicate
+{
+    NSUInteger lower = range.location;
+    NSUInteger upper = NSMaxRange(range);
+    while (lower < upper) {
+        NSUInteger const middle = lower + (upper - lower) / 2;
+        if (predicate([_callNumbers objectAtIndex:middle])) {
+            lower = middle + 1;
+        } else {
+            upper = middle;
+        }
+    }
+    return lower;
+}
+
+- (NSUInteger)indexForCallNumber:(BibLCCallNumber *)callNumber
+{
+    return [self indexInRange:NSMakeRange(0, [_callNumbers count]) passingTest:^BOOL(BibLCCallNumber *element) {
+        return BibLCCallNumberIsOrderedBefore(element, callNumber);
+    }];
+}
+
+/// Find the position after the last call number equivalent to the given value.
+- (NSUInteger)indexAfterCallNumber:(BibLCCallNumber *)callNumber
+{
+    return [self indexInRange:NSMakeRange(0, [_callNumbers count]) passingTest:^BOOL(BibLCCallNumber *element) {
+        return !BibLCCallNumberIsOrderedBefore(callNumber, element);
+    }];
+}
+
+/// Find the position after the last call number included by the given classification.
+///
+/// The call numbers included by a classification are ordered directly after it, so they're all found
+/// within a single run of call numbers starting at the classification's shelf position.
+- (NSUInteger)indexAfterCallNumbersIncludedByCallNumber:(BibLCCallNumber *)callNumber
+                                             startIndex:(NSUInteger)startIndex
+{
+    NSRange const range = NSMakeRange(startIndex, [_callNumbers count] - startIndex);
+    bib_lc_calln_t classification = {};
+    [callNumber getCallNumberStructure:&classification];
+    bib_lc_calln_t const *const classn = &classification;
+    NSUInteger const index = [self indexInRange:range passingTest:^BOOL(BibLCCallNumber *element) {
+        return BibLCCallNumberIncludes(classn, element);
+    }];
+    bib_lc_calln_deinit(&classification);
+    return index;
+}
+
+- (NSArray<BibLCCallNumber *> *)callNumbersFromCallNumber:(BibLCCallNumber *)lowerCallNumber
+                                             toCallNumber:(BibLCCallNumber *)upperCallNumber
+{
+    NSUInteger const lower = [self indexForCallNumber:lowerCallNumber];
+    NSUInteger const upperStart = MAX(lower, [self indexForCallNumber:upperCallNumber]);
+    NSUInteger const upper = [self indexAfterCallNumbersIncludedByCallNumber:upperCallNumber startIndex:upperStart];
+    if (upper <= lower) {
+        return @[];
+    }
+    return [_callNumbers subarrayWithRange:NSMakeRange(lower, upper - lower)];
+}
+
+- (NSArray<BibLCCallNumber *> *)callNumbersIncludedByCallNumber:(BibLCCallNumber *)callNumber
+{
+    NSUInteger const lower = [self indexForCallNumber:callNumber];
+    NSUInteger const upper = [self indexAfterCallNumbersIncludedByCallNumber:callNumber startIndex:lower];
+    return [_callNumbers subarrayWithRange:NSMakeRange(lower, upper - lower)];
+}
+
+- (NSArray<BibLCCallNumber *> *)callNumbersNearCallNumber:(BibLCCallNumber *)callNumber count:(NSUInteger)count
+{
+    NSUInteger const index = [self indexForCallNumber:callNumber];
+    NSUInteger const lower = (index > count) ? index - count : 0;
+    NSUInteger const upper = MIN(index + count, [_callNumbers count]);
+    return [_callNumbers subarrayWithRange:NSMakeRange(lower, upper - lower)];
+}
+
+@end
+
+#pragma mark - Copying
+
+@implementation BibLCCallNumberIndex (Copying)
+
+- (id)copyWithZone:(NSZone *)zone
+{
+    return self;
+}
+
+- (id)mutableCopyWithZone:(NSZone *)zone
+{
+    return [[BibMutableLCCallNumberIndex allocWithZone:zone] initWithSortedCallNumbers:_callNumbers];
+}
+
+@end
+
+#pragma mark - Mutable
+
+@implementation BibMutableLCCallNumberIndex
+
+- (id)copyWithZone:(NSZone *)zone
+{
+    return [[BibLCCallNumberIndex allocWithZone:zone] initWithSortedCallNumbers:_callNumbers];
+}
+
+- (void)addCallNumber:(BibLCCallNumber *)callNumber
+{
+    [_callNumbers insertObject:callNumber atIndex:[self indexAfterCallNumber:callNumber]];
+}
+
+- (void)addCallNumbers:(NSArray<BibLCCallNumber *> *)callNumbers
+{
+    if ([callNumbers count] < [_callNumbers count] / 16) {
+        for (BibLCCallNumber *callNumber in callNumbers) {
+            [self addCallNumber:callNumber];
+        }
+        return;
+    }
+    BibLCCallNumberIndex *const index = [[BibLCCallNumberIndex alloc] initWithCallNumbers:callNumbers];
+    NSArray<BibLCCallNumber *> *const left = _callNumbers;
+    NSArray<BibLCCallNumber *> *const right = [index callNumbers];
+    NSMutableArray<BibLCCallNumber *> *const merged = [NSMutableArray arrayWithCapacity:[left count] + [right count]];
+    NSUInteger leftIndex = 0;
+    NSUInteger rightIndex = 0;
+    while (leftIndex < [left count] && rightIndex < [right count]) {
+        BibLCCallNumber *const leftCallNumber = [left objectAtIndex:leftIndex];
+        BibLCCallNumber *const rightCallNumber = [right objectAtIndex:rightIndex];
+        if (BibLCCallNumberIsOrderedBefore(rightCallNumber, leftCallNumber)) {
+            [merged addObject:rightCallNumber];
+            rightIndex += 1;
+        } else {
+            [merged addObject:leftCallNumber];
+            leftIndex += 1;
+        }
+    }
+    [merged addObjectsFromArray:[left subarrayWithRange:NSMakeRange(leftIndex, [left count] - leftIndex)]];
+    [merged addObjectsFromArray:[right subarrayWithRange:NSMakeRange(rightIndex, [right count] - rightIndex)]];
+    _callNumbers = merged;
+}
+
+- (void)removeCallNumber:(BibLCCallNumber *)callNumber
+{
+    NSUInteger const index = [self indexForCallNumber:callNumber];
+    if (index < [_callNumbers count] && [[_callNumbers objectAtIndex:index] isEqualToCallNumber:callNumber]) {
+        [_callNumbers removeObjectAtIndex:index];
+    }
+}
+
+- (void)removeCallNumberAtIndex:(NSUInteger)index
+{
+    [_callNumbers removeObjectAtIndex:index];
+}
+
+@end
@@ -0,0 +1,66 @@
+//
+//  BibLCCallNumberInternTable.h
+//  Bibliotek
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <Bibliotek/BibAttributes.h>
+
+@class BibLCCallNumber;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A table of shared call number instances, so that equivalent call numbers are kept in memory only once.
+///
+/// Collections with several copies of the same item tend to repeat the same call numbers many times.
+/// Creating call numbers through an intern table parses each distinct string only once, and gives back
+/// the same ``BibLCCallNumber`` instance for every string with an equivalent call number, such as
+/// `QA76.C6` and `QA76 .C6`.
+///
+/// Intern tables can be used from multiple threads at the same time. The table is split into independently
+/// locked partitions, so threads interning different call numbers rarely have to wait on each other.
+NS_SWIFT_NAME(LCCallNumberInternTable) NS_SWIFT_SENDABLE
+@interface BibLCCallNumberInternTable : NSObject
+
+/// An intern table shared by the whole process.
+@property (class, nonatomic, readonly, strong) BibLCCallNumberInternTable *sharedTable NS_SWIFT_NAME(shared);
+
+/// The amount of distinct call numbers in the table.
+@property (nonatomic, readonly) NSUInteger count;
+
+/// Get the shared call number for the given string representation.
+/// - parameter string: The string value of the call number.
+/// - returns: The call number in the table equivalent to the one represented by `string`,
+///            or `nil` when the string isn't a valid call number.
+///
+/// Strings are parsed only the first time they're seen by the table.
+- (nullable BibLCCallNumber *)callNumberWithString:(NSString *)string;
+
+/// Get the shared call numbers for each of the given string representations.
+/// - parameter strings: The string values of the call numbers.
+/// - returns: An array with an element for each string, in the same order as `strings`. Each element is
+///            either the call number in the table equivalent to the one represented by the string at the same
+///            index, or `NSNull` when the string isn't a valid call number.
+///
+/// Strings not already in the table are parsed in parallel with ``BibLCCallNumber/callNumbersWithStrings:``,
+/// and each distinct string is parsed only once.
+- (NSArray *)callNumbersWithStrings:(NSArray<NSString *> *)strings NS_REFINED_FOR_SWIFT;
+
+/// Get the shared call number equivalent to the given value.
+/// - parameter callNumber: The call number to add to the table.
+/// - returns: The call number in the table equivalent to `callNumber`, which is `callNumber` itself
+///            when the table doesn't already contain an equivalent call number.
+- (BibLCCallNumber *)internCallNumber:(BibLCCallNumber *)callNumber NS_SWIFT_NAME(intern(_:));
+
+/// Remove every call number from the table.
+///
+/// Call numbers already returned from the table stay valid, but won't be shared with call numbers
+/// created after they're removed.
+- (void)removeAllCallNumbers;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,181 @@
+//
+//  BibLCCallNumberInternTable.m
+//  Bibliotek
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+
+#import "BibLCCallNumberInternTable.h"
+#import "BibLCCallNumber.h"
+#import <os/lock.h>
+
+/// The amount of independently locked partitions in an intern table.
+static NSUInteger const BibLCCallNumberInternShardCount = 64;
+
+/// An independently locked partition of an intern table.
+///
+/// Strings and call numbers are assigned to shards separately, using their own hash values, so a call number
+/// and the strings that represent it are usually kept in different shards.
+@interface _BibLCCallNumberInternShard : NSObject {
+@package
+    os_unfair_lock _lock;
+    NSMutableDictionary<NSString *, BibLCCallNumber *> *_strings;
+    NSMutableSet<BibLCCallNumber *> *_callNumbers;
+}
+@end
+
+@implementation _BibLCCallNumberInternShard
+
+- (instancetype)init
+{
+    if (self = [super init]) {
+        _lock = OS_UNFAIR_LOCK_INIT;
+        _strings = [NSMutableDictionary dictionary];
+        _callNumbers = [NSMutableSet set];
+    }
+    return self;
+}
+
+@end
+
+@implementation BibLCCallNumberInternTable {
+    NSArray<_BibLCCallNumberInternShard *> *_shards;
+}
+
+- (instancetype)init
+{
+    if (self = [super init]) {
+        NSMutableArray *const shards = [NSMutableArray arrayWithCapacity:BibLCCallNumberInternShardCount];
+        for (NSUInteger index = 0; index < BibLCCallNumberInternShardCount; index += 1) {
+            [shards addObject:[_BibLCCallNumberInternShard new]];
+        }
+        _shards = [shards copy];
+    }
+    return self;
+}
+
++ (BibLCCallNumberInternTable *)sharedTable
+{
+    static BibLCCallNumberInternTable *sSharedTable;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sSharedTable = [BibLCCallNumberInternTable new];
+    });
+    return sSharedTable;
+}
+
+- (NSUInteger)count
+{
+    NSUInteger count = 0;
+    for (_BibLCCallNumberInternShard *shard in _shards) {
+        os_unfair_lock_lock(&(shard->_lock));
+        count += [shard->_callNumbers count];
+        os_unfair_lock_unlock(&(shard->_lock));
+    }
+    return count;
+}
+
+/// Find the shard holding the call number for the given string.
+- (_BibLCCallNumberInternShard *)shardForString:(NSString *)string
+{
+    return [_shards objectAtIndex:[string hash] % BibLCCallNumberInternShardCount];
+}
+
+/// Find the shared call number for a string that has already been interned.
+- (BibLCCallNumber *)existingCallNumberWithString:(NSString *)string
+{
+    _BibLCCallNumberInternShard *const shard = [self shardForString:string];
+    os_unfair_lock_lock(&(shard->_lock));
+    BibLCCallNumber *const callNumber = [shard->_strings objectForKey:string];
+    os_unfair_lock_unlock(&(shard->_lock));
+    return callNumber;
+}
+
+/// Intern the call number, and remember it as the shared call number for the given string.
+/// - returns: The shared call number for the string.
+- (BibLCCallNumber *)internCallNumber:(BibLCCallNumber *)callNumber withString:(NSString *)string
+{
+    BibLCCallNumber *const interned = [self internCallNumber:callNumber];
+    _BibLCCallNumberInternShard *const shard = [self shardForString:string];
+    os_unfair_lock_lock(&(shard->_lock));
+    // another thread may have interned the same string first, but both get the same call number
+    [shard->_strings setObject:interned forKey:string];
+    os_unfair_lock_unlock(&(shard->_lock));
+    return interned;
+}
+
+- (BibLCCallNumber *)callNumberWithString:(NSString *)string
+{
+    BibLCCallNumber *const existing = [self existingCallNumberWithString:string];
+    if (existing != nil) {
+        return existing;
+    }
+    BibLCCallNumber *const callNumber = [[BibLCCallNumber alloc] initWithString:string];
+    if (callNumber == nil) {
+        return nil;
+    }
+    return [self internCallNumber:callNumber withString:string];
+}
+
+- (NSArray *)callNumbersWithStrings:(NSArray<NSString *> *)strings
+{
+    NSUInteger const count = [strings count];
+    NSMutableArray *const callNumbers = [NSMutableArray arrayWithCapacity:count];
+    NSMutableOrderedSet<NSString *> *const missing = [NSMutableOrderedSet orderedSet];
+    for (NSString *string in strings) {
+        BibLCCallNumber *const existing = [self existingCallNumberWithString:string];
+        if (existing != nil) {
+            [callNumbers addObject:existing];
+        } else {
+            [callNumbers addObject:[NSNull null]];
+            [missing addObject:string];
+        }
+    }
+    if ([missing count] == 0) {
+        return [callNumbers copy];
+    }
+    NSArray *const parsed = [BibLCCallNumber callNumbersWithStrings:[missing array]];
+    NSMutableDictionary<NSString *, BibLCCallNumber *> *const interned = [NSMutableDictionary dictionary];
+    [parsed enumerateObjectsUsingBlock:^(id callNumber, NSUInteger index, BOOL *stop) {
+        if (callNumber != [NSNull null]) {
+            NSString *const string = [missing objectAtIndex:index];
+            [interned setObject:[self internCallNumber:callNumber withString:string] forKey:string];
+        }
+    }];
+    for (NSUInteger index = 0; index < count; index += 1) {
+        if ([callNumbers objectAtIndex:index] == [NSNull null]) {
+            BibLCCallNumber *const callNumber = [interned objectForKey:[strings objectAtIndex:index]];
+            if (callNumber != nil) {
+                [callNumbers replaceObjectAtIndex:index withObject:callNumber];
+            }
+        }
+    }
+    return [callNumbers copy];
+}
+
+- (BibLCCallNumber *)internCallNumber:(BibLCCallNumber *)callNumber
+{
+    NSUInteger const index = [callNumber hash] % BibLCCallNumberInternShardCount;
+    _BibLCCallNumberInternShard *const shard = [_shards objectAtIndex:index];
+    os_unfair_lock_lock(&(shard->_lock));
+    BibLCCallNumber *interned = [shard->_callNumbers member:callNumber];
+    if (interned == nil) {
+        [shard->_callNumbers addObject:callNumber];
+        interned = callNumber;
+    }
+    os_unfair_lock_unlock(&(shard->_lock));
+    return interned;
+}
+
+- (void)removeAllCallNumbers
+{
+    for (_BibLCCallNumberInternShard *shard in _shards) {
+        os_unfair_lock_lock(&(shard->_lock));
+        [shard->_strings removeAllObjects];
+        [shard->_callNumbers removeAllObjects];
+        os_unfair_lock_unlock(&(shard->_lock));
+    }
+}
+
+@end
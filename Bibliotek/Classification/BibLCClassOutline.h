@@ -0,0 +1,106 @@
+//
+//  BibLCClassOutline.h
+//  Bibliotek
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <Bibliotek/BibAttributes.h>
+
+@class BibLCCallNumber;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A heading in an outline of the Library of Congress Classification, naming the subject matter
+/// for a range of classifications.
+NS_SWIFT_NAME(LCClassCaption) NS_SWIFT_SENDABLE
+@interface BibLCClassCaption : NSObject <NSCopying>
+
+/// The first classification in the caption's range.
+@property (nonatomic, readonly, copy) BibLCCallNumber *lowerCallNumber;
+
+/// The last classification in the caption's range.
+///
+/// Call numbers included by this classification are also within the caption's range.
+@property (nonatomic, readonly, copy) BibLCCallNumber *upperCallNumber;
+
+/// A description of the subject matter for call numbers within the caption's range.
+@property (nonatomic, readonly, copy) NSString *caption;
+
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)new NS_UNAVAILABLE;
+
+/// Create a caption for an inclusive range of classifications.
+/// - parameter lowerCallNumber: The first classification in the range.
+/// - parameter upperCallNumber: The last classification in the range.
+/// - parameter caption: A description of the subject matter for call numbers within the range.
+- (instancetype)initWithLowerCallNumber:(BibLCCallNumber *)lowerCallNumber
+                        upperCallNumber:(BibLCCallNumber *)upperCallNumber
+                                caption:(NSString *)caption NS_DESIGNATED_INITIALIZER;
+
+/// Determine if the given call number is within the caption's range of classifications.
+/// - parameter callNumber: The call number to look for in the caption's range.
+/// - returns: `YES` when `callNumber` is ordered on or after ``lowerCallNumber``, and is ordered
+///            on or before ``upperCallNumber`` or included within it.
+- (BOOL)containsCallNumber:(BibLCCallNumber *)callNumber;
+
+/// Determine if the given caption has the same range and description as the receiver.
+- (BOOL)isEqualToCaption:(BibLCClassCaption *)caption;
+
+@end
+
+/// An outline of the Library of Congress Classification, for finding the subject areas of call numbers.
+///
+/// Captions are kept in an interval tree ordered by the first classification in each caption's range, which
+/// lets the outline find every caption containing a call number in `O(log n + k)` time, where `k` is the amount
+/// of captions in the result, instead of checking each caption.
+///
+/// Outlines are immutable, and can be shared and searched from multiple threads at the same time.
+NS_SWIFT_NAME(LCClassOutline) NS_SWIFT_SENDABLE
+@interface BibLCClassOutline : NSObject
+
+/// The amount of captions in the outline.
+@property (nonatomic, readonly) NSUInteger count;
+
+/// All captions in the outline, ordered by the first classification in their ranges.
+///
+/// Captions starting with the same classification are ordered from the widest range to the narrowest.
+@property (nonatomic, readonly, copy) NSArray<BibLCClassCaption *> *captions;
+
+/// Create an outline containing the given captions.
+/// - parameter captions: The captions to add to the outline, in any order.
+- (instancetype)initWithCaptions:(NSArray<BibLCClassCaption *> *)captions NS_DESIGNATED_INITIALIZER;
+
+/// Create an outline from a table of captions.
+/// - parameter string: The outline table, with one caption on each line.
+/// - parameter error: Set to an error describing the first line that can't be read.
+/// - returns: An outline containing each caption in the table, or `nil` when a line can't be read.
+///
+/// Each line begins with a classification or range of classifications, followed by whitespace and the
+/// caption's description, such as `QA71-QA90 Instruments and machines` or `QA76 Computers`. The upper
+/// classification can leave out its class letters when they're the same as the lower classification's,
+/// such as `QA71-90`. Blank lines and lines starting with `#` are skipped.
+- (nullable instancetype)initWithString:(NSString *)string
+                                  error:(out NSError *_Nullable __autoreleasing *_Nullable)error;
+
+/// Create an outline from a file containing a table of captions.
+/// - parameter url: The location of a UTF-8 file containing the outline table.
+/// - parameter error: Set to an error describing why the file can't be read.
+/// - returns: An outline containing each caption in the file, or `nil` when the file can't be read.
+///
+/// The file is formatted as described by ``initWithString:error:``.
+- (nullable instancetype)initWithContentsOfURL:(NSURL *)url
+                                         error:(out NSError *_Nullable __autoreleasing *_Nullable)error;
+
+/// Find the captions whose ranges contain the given call number.
+/// - parameter callNumber: The call number to find captions for.
+/// - returns: The captions that return `YES` from ``BibLCClassCaption/containsCallNumber:`` for `callNumber`,
+///            in the same order as ``captions``. For a nested outline, this lists the broadest subject first.
+- (NSArray<BibLCClassCaption *> *)captionsContainingCallNumber:(BibLCCallNumber *)callNumber
+    NS_SWIFT_NAME(captions(containing:));
+
+@end
+
+NS_ASSUME_NONNULL_END
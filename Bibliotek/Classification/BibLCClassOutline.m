@@ -0,0 +1,337 @@
+//
+//  BibLCClassOutline.m
+//  Bibliotek
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+
+#import "BibLCClassOutline.h"
+#import "BibLCCallNumber.h"
+#import "BibLCCallNumber+Private.h"
+#import "bibtype.h"
+
+/// Is the call number ordered on or after the lower bound of a range?
+static BOOL BibLCClassIsAfterLowerBound(bib_lc_calln_t const *const calln, bib_lc_calln_t const *const lower)
+{
+    return bib_lc_calln_compare(bib_calln_ordered_same, calln, lower, false) <= bib_calln_ordered_same;
+}
+
+/// Is the call number ordered on or before the upper bound of a range, or included within it?
+static BOOL BibLCClassIsBeforeUpperBound(bib_lc_calln_t const *const calln, bib_lc_calln_t const *const upper)
+{
+    return bib_lc_calln_compare(bib_calln_ordered_same, calln, upper, true) != bib_calln_ordered_descending;
+}
+
+/// Order the upper bounds of two ranges by how far along the shelf they reach.
+///
+/// An upper bound reaches every classification ordered before it, along with every classification it includes.
+/// Any call number before one upper bound is therefore also before every upper bound that reaches further,
+/// which is what lets a subtree be skipped by checking only its furthest upper bound.
+static NSComparisonResult BibLCClassCompareReach(bib_lc_calln_t const *const upper, bib_lc_calln_t const *const other)
+{
+    switch (bib_lc_calln_compare(bib_calln_ordered_same, upper, other, true)) {
+        case bib_calln_ordered_same:
+            return NSOrderedSame;
+
+        case bib_calln_ordered_ascending:
+        case bib_calln_ordered_generalizing:
+            return NSOrderedAscending;
+
+        case bib_calln_ordered_descending:
+        case bib_calln_ordered_specifying:
+            return NSOrderedDescending;
+    }
+}
+
+/// Create a caption from a line of an outline table, such as `QA71-90 Instruments and machines`.
+static BibLCClassCaption *BibLCClassCaptionMake(NSString *const line)
+{
+    NSCharacterSet *const whitespace = [NSCharacterSet whitespaceCharacterSet];
+    NSRange const space = [line rangeOfCharacterFromSet:whitespace];
+    NSString *const range = (space.location == NSNotFound) ? line : [line substringToIndex:space.location];
+    NSString *const caption = (space.location == NSNotFound)
+                            ? @""
+                            : [[line substringFromIndex:space.location] stringByTrimmingCharactersInSet:whitespace];
+    NSRange const dash = [range rangeOfString:@"-"];
+    NSString *const lowerString = (dash.location == NSNotFound) ? range : [range substringToIndex:dash.location];
+    NSString *upperString = (dash.location == NSNotFound) ? range : [range substringFromIndex:NSMaxRange(dash)];
+    NSCharacterSet *const digits = [NSCharacterSet decimalDigitCharacterSet];
+    if ([upperString length] > 0 && [digits characterIsMember:[upperString characterAtIndex:0]]) {
+        NSRange const number = [lowerString rangeOfCharacterFromSet:digits];
+        if (number.location != NSNotFound) {
+            upperString = [[lowerString substringToIndex:number.location] stringByAppendingString:upperString];
+        }
+    }
+    BibLCCallNumber *const lowerCallNumber = [[BibLCCallNumber alloc] initWithString:lowerString];
+    BibLCCallNumber *const upperCallNumber = [[BibLCCallNumber alloc] initWithString:upperString];
+    if (lowerCallNumber == nil || upperCallNumber == nil
+        || [lowerCallNumber compare:upperCallNumber] == NSOrderedDescending) {
+        return nil;
+    }
+    return [[BibLCClassCaption alloc] initWithLowerCallNumber:lowerCallNumber
+                                              upperCallNumber:upperCallNumber
+                                                      caption:caption];
+}
+
+#pragma mark - Caption
+
+@implementation BibLCClassCaption
+
+- (instancetype)initWithLowerCallNumber:(BibLCCallNumber *)lowerCallNumber
+                        upperCallNumber:(BibLCCallNumber *)upperCallNumber
+                                caption:(NSString *)caption
+{
+    if (self = [super init]) {
+        _lowerCallNumber = [lowerCallNumber copy];
+        _upperCallNumber = [upperCallNumber copy];
+        _caption = [caption copy];
+    }
+    return self;
+}
+
+- (instancetype)init
+{
+    [self doesNotRecognizeSelector:_cmd];
+    return nil;
+}
+
++ (instancetype)new
+{
+    [self doesNotRecognizeSelector:_cmd];
+    return nil;
+}
+
+- (id)copyWithZone:(NSZone *)zone
+{
+    return self;
+}
+
+- (NSString *)description
+{
+    if ([_lowerCallNumber isEqualToCallNumber:_upperCallNumber]) {
+        return [NSString stringWithFormat:@"%@ %@", [_lowerCallNumber stringValue], _caption];
+    }
+    return [NSString stringWithFormat:@"%@-%@ %@", [_lowerCallNumber stringValue], [_upperCallNumber stringValue],
+                                      _caption];
+}
+
+- (BOOL)containsCallNumber:(BibLCCallNumber *)callNumber
+{
+    bib_lc_calln_t calln = {};
+    bib_lc_calln_t lower = {};
+    bib_lc_calln_t upper = {};
+    [callNumber getCallNumberStructure:&calln];
+    [_lowerCallNumber getCallNumberStructure:&lower];
+    [_upperCallNumber getCallNumberStructure:&upper];
+    BOOL const contains = BibLCClassIsAfterLowerBound(&calln, &lower) && BibLCClassIsBeforeUpperBound(&calln, &upper);
+    bib_lc_calln_deinit(&calln);
+    bib_lc_calln_deinit(&lower);
+    bib_lc_calln_deinit(&upper);
+    return contains;
+}
+
+- (BOOL)isEqualToCaption:(BibLCClassCaption *)caption
+{
+    return self == caption
+        || ([_lowerCallNumber isEqualToCallNumber:[caption lowerCallNumber]]
+            && [_upperCallNumber isEqualToCallNumber:[caption upperCallNumber]]
+            && [_caption isEqualToString:[caption caption]]);
+}
+
+- (BOOL)isEqual:(id)object
+{
+    return self == object
+        || ([object isKindOfClass:[BibLCClassCaption self]] && [self isEqualToCaption:object]);
+}
+
+- (NSUInteger)hash
+{
+    return [_lowerCallNumber hash] ^ [_upperCallNumber hash] ^ [_caption hash];
+}
+
+@end
+
+#pragma mark - Outline
+
+/// Find the upper bound reaching furthest along the shelf within each subtree of the interval tree.
+///
+/// The interval tree is implicitly stored in the sorted arrays of bounds, where the root of each subtree
+/// is in the middle of its range of indices.
+/// - returns: The index of the upper bound reaching furthest within the range `[lower, upper)`.
+static NSUInteger BibLCClassOutlineBuild(bib_lc_calln_t const *const uppers, NSUInteger *const reach,
+                                         NSUInteger const lower, NSUInteger const upper)
+{
+    NSUInteger const middle = lower + (upper - lower) / 2;
+    NSUInteger furthest = middle;
+    if (lower < middle) {
+        NSUInteger const index = BibLCClassOutlineBuild(uppers, reach, lower, middle);
+        if (BibLCClassCompareReach(&(uppers[index]), &(uppers[furthest])) == NSOrderedDescending) {
+            furthest = index;
+        }
+    }
+    if (middle + 1 < upper) {
+        NSUInteger const index = BibLCClassOutlineBuild(uppers, reach, middle + 1, upper);
+        if (BibLCClassCompareReach(&(uppers[index]), &(uppers[furthest])) == NSOrderedDescending) {
+            furthest = index;
+        }
+    }
+    reach[middle] = furthest;
+    return furthest;
+}
+
+@implementation BibLCClassOutline {
+    NSArray<BibLCClassCaption *> *_captions;
+    bib_lc_calln_t *_lowers;
+    bib_lc_calln_t *_uppers;
+    NSUInteger *_reach;
+}
+
+- (instancetype)initWithCaptions:(NSArray<BibLCClassCaption *> *)captions
+{
+    if (self = [super init]) {
+        // order captions by their lower bounds, with the widest range first
+        _captions = [captions sortedArrayWithOptions:NSSortStable
+                                     usingComparator:^NSComparisonResult(BibLCClassCaption *left,
+                                                                         BibLCClassCaption *right) {
+            NSComparisonResult const result = [[left lowerCallNumber] compare:[right lowerCallNumber]];
+            if (result != NSOrderedSame) {
+                return result;
+            }
+            bib_lc_calln_t leftUpper = {};
+            bib_lc_calln_t rightUpper = {};
+            [[left upperCallNumber] getCallNumberStructure:&leftUpper];
+            [[right upperCallNumber] getCallNumberStructure:&rightUpper];
+            NSComparisonResult const reach = BibLCClassCompareReach(&rightUpper, &leftUpper);
+            bib_lc_calln_deinit(&leftUpper);
+            bib_lc_calln_deinit(&rightUpper);
+            return reach;
+        }];
+        NSUInteger const count = [_captions count];
+        _lowers = calloc(count, sizeof(bib_lc_calln_t));
+        _uppers = calloc(count, sizeof(bib_lc_calln_t));
+        _reach = calloc(count, sizeof(NSUInteger));
+        for (NSUInteger index = 0; index < count; index += 1) {
+            BibLCClassCaption *const caption = [_captions objectAtIndex:index];
+            [[caption lowerCallNumber] getCallNumberStructure:&(_lowers[index])];
+            [[caption upperCallNumber] getCallNumberStructure:&(_uppers[index])];
+        }
+        if (count > 0) {
+            NSUInteger __unused _ = BibLCClassOutlineBuild(_uppers, _reach, 0, count);
+        }
+    }
+    return self;
+}
+
+- (instancetype)init
+{
+    return [self initWithCaptions:@[]];
+}
+
+- (instancetype)initWithString:(NSString *)string error:(out NSError *__autoreleasing *)error
+{
+    NSMutableArray<BibLCClassCaption *> *const captions = [NSMutableArray array];
+    NSCharacterSet *const whitespace = [NSCharacterSet whitespaceCharacterSet];
+    __block NSUInteger lineNumber = 0;
+    __block BOOL success = YES;
+    [string enumerateLinesUsingBlock:^(NSString *line, BOOL *stop) {
+        lineNumber += 1;
+        NSString *const trimmed = [line stringByTrimmingCharactersInSet:whitespace];
+        if ([trimmed length] == 0 || [trimmed hasPrefix:@"#"]) {
+            return;
+        }
+        BibLCClassCaption *const caption = BibLCClassCaptionMake(trimmed);
+        if (caption == nil) {
+            success = NO;
+            *stop = YES;
+            return;
+        }
+        [captions addObject:caption];
+    }];
+    if (!success) {
+        if (error != NULL) {
+            NSString *const description = [NSString stringWithFormat:@"Invalid classification range on line %lu",
+                                                                     (unsigned long)lineNumber];
+            *error = [NSError errorWithDomain:NSCocoaErrorDomain
+                                         code:NSFileReadCorruptFileError
+                                     userInfo:@{ NSLocalizedDescriptionKey : description }];
+        }
+        return nil;
+    }
+    return [self initWithCaptions:captions];
+}
+
+- (instancetype)initWithContentsOfURL:(NSURL *)url error:(out NSError *__autoreleasing *)error
+{
+    NSString *const string = [NSString stringWithContentsOfURL:url encoding:NSUTF8StringEncoding error:error];
+    if (string == nil) {
+        return nil;
+    }
+    return [self initWithString:string error:error];
+}
+
+- (void)dealloc
+{
+    NSUInteger const count = [_captions count];
+    for (NSUInteger index = 0; index < count; index += 1) {
+        bib_lc_calln_deinit(&(_lowers[index]));
+        bib_lc_calln_deinit(&(_uppers[index]));
+    }
+    free(_lowers);
+    free(_uppers);
+    free(_reach);
+}
+
+- (NSUInteger)count
+{
+    return [_captions count];
+}
+
+- (NSArray<BibLCClassCaption *> *)captions
+{
+    return _captions;
+}
+
+- (NSString *)description
+{
+    return [_captions description];
+}
+
+#pragma mark - Search
+
+/// Add the captions containing the call number from the subtree in the range `[lower, upper)` to the results.
+///
+/// Subtrees are skipped when none of their upper bounds reach the call number, and the captions to the right
+/// of a lower bound ordered after the call number are skipped, since their lower bounds are after it as well.
+- (void)addCaptionsContainingCallNumber:(bib_lc_calln_t const *)calln
+                              fromIndex:(NSUInteger)lower
+                                toIndex:(NSUInteger)upper
+                                toArray:(NSMutableArray<BibLCClassCaption *> *)results
+{
+    while (lower < upper) {
+        NSUInteger const middle = lower + (upper - lower) / 2;
+        if (!BibLCClassIsBeforeUpperBound(calln, &(_uppers[_reach[middle]]))) {
+            return;
+        }
+        [self addCaptionsContainingCallNumber:calln fromIndex:lower toIndex:middle toArray:results];
+        if (!BibLCClassIsAfterLowerBound(calln, &(_lowers[middle]))) {
+            return;
+        }
+        if (BibLCClassIsBeforeUpperBound(calln, &(_uppers[middle]))) {
+            [results addObject:[_captions objectAtIndex:middle]];
+        }
+        lower = middle + 1;
+    }
+}
+
+- (NSArray<BibLCClassCaption *> *)captionsContainingCallNumber:(BibLCCallNumber *)callNumber
+{
+    NSMutableArray<BibLCClassCaption *> *const results = [NSMutableArray array];
+    bib_lc_calln_t calln = {};
+    [callNumber getCallNumberStructure:&calln];
+    [self addCaptionsContainingCallNumber:&calln fromIndex:0 toIndex:[_captions count] toArray:results];
+    bib_lc_calln_deinit(&calln);
+    return [results copy];
+}
+
+@end
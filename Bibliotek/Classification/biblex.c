@@ -7,16 +7,172 @@
 //
 
 #include "biblex.h"
+#include "bibtokenizer.h"
 #include <ctype.h>
 #include <string.h>
 #include <assert.h>
+#include <limits.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 
 /// The presence of this macro causes lowercase letters in the subject and cutters to
 /// autocorrect to their uppercase value instead of failing the lex/parse.
 #define BIB_LEX_AUTO_UPPERCASE
 
+#pragma mark - character class masks
+
+/// Sets of character classes from `bib_char_classes` matched by the lexer, with one bit for each class.
+///
+/// Testing a character against a mask is a table lookup, which avoids calling a `bib_cpred_f` function for
+/// every character read from the input.
+typedef enum bib_lex_mask {
+    bib_lex_mask_digit = 1u << bib_char_class_digit,
+    bib_lex_mask_upper = 1u << bib_char_class_upper,
+    bib_lex_mask_lower = 1u << bib_char_class_lower,
+    bib_lex_mask_alpha = bib_lex_mask_upper | bib_lex_mask_lower,
+    bib_lex_mask_space = 1u << bib_char_class_space,
+    bib_lex_mask_point = 1u << bib_char_class_point,
+    bib_lex_mask_comma = 1u << bib_char_class_comma,
+    bib_lex_mask_dash  = 1u << bib_char_class_dash,
+    bib_lex_mask_slash = 1u << bib_char_class_slash,
+    bib_lex_mask_stop  = (1u << bib_char_class_stop) | (1u << bib_char_class_null),
+    bib_lex_mask_any   = (1u << (bib_char_class_null + 1)) - 1,
+    bib_lex_mask_notspace = bib_lex_mask_any & ~(bib_lex_mask_space | (1u << bib_char_class_null))
+} bib_lex_mask_t;
+
+static inline bool bib_lex_is(char const c, bib_lex_mask_t const mask)
+{
+    return ((1u << bib_char_class(c)) & mask) != 0;
+}
+
+/// Get the class mask matching exactly the same characters as one of the predicates declared in `biblex.h`.
+/// - returns: `false` for predicates that aren't described by character classes, such as caller-defined functions.
+static bool bib_lex_mask_for_pred(bib_cpred_f const pred, bib_lex_mask_t *const mask)
+{
+    if      (pred == bib_isnumber)  { *mask = bib_lex_mask_digit; }
+    else if (pred == bib_isalpha)   { *mask = bib_lex_mask_alpha; }
+    else if (pred == bib_isupper)   { *mask = bib_lex_mask_upper; }
+    else if (pred == bib_islower)   { *mask = bib_lex_mask_lower; }
+    else if (pred == bib_isspace)   { *mask = bib_lex_mask_space; }
+    else if (pred == bib_notspace)  { *mask = bib_lex_mask_notspace; }
+    else if (pred == bib_ispoint)   { *mask = bib_lex_mask_point; }
+    else if (pred == bib_iscomma)   { *mask = bib_lex_mask_comma; }
+    else if (pred == bib_isdash)    { *mask = bib_lex_mask_dash; }
+    else if (pred == bib_isslash)   { *mask = bib_lex_mask_slash; }
+#if CHAR_MIN < 0
+    // `bib_isstop` only matches the byte 0xFF as `EOF` when `char` is signed.
+    else if (pred == bib_isstop)    { *mask = bib_lex_mask_stop; }
+#endif
+    else { return false; }
+    return true;
+}
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define BIB_LEX_SWAR 1
+
+#define BIB_LEX_SWAR_ONES 0x0101010101010101ull
+#define BIB_LEX_SWAR_HIGH 0x8080808080808080ull
+
+/// Mark the bytes in the word outside of the range `lo...hi` by setting their high bit.
+///
+/// Bytes within the range never carry or borrow into the next byte, so the lowest marked byte is always exact,
+/// even though the marks on the bytes that follow it may not be.
+static inline uint64_t bib_lex_swar_outside(uint64_t const word, unsigned char const lo, unsigned char const hi)
+{
+    return ((word + BIB_LEX_SWAR_ONES * (0x7F - hi)) | (word - BIB_LEX_SWAR_ONES * lo)) & BIB_LEX_SWAR_HIGH;
+}
+
+/// Mark the bytes in the word that aren't matched by the mask.
+/// - returns: `false` when the mask can't be checked a word at a time.
+static inline bool bib_lex_swar_misses(uint64_t const word, bib_lex_mask_t const mask, uint64_t *const misses)
+{
+    switch (mask) {
+        case bib_lex_mask_digit: *misses = bib_lex_swar_outside(word, '0', '9'); return true;
+        case bib_lex_mask_upper: *misses = bib_lex_swar_outside(word, 'A', 'Z'); return true;
+        case bib_lex_mask_lower: *misses = bib_lex_swar_outside(word, 'a', 'z'); return true;
+        case bib_lex_mask_alpha:
+            // setting the 0x20 bit lowercases letters without making any other character a letter
+            *misses = bib_lex_swar_outside(word | (BIB_LEX_SWAR_ONES * 0x20), 'a', 'z');
+            return true;
+        default:
+            return false;
+    }
+}
+#endif
+
+/// Count the leading characters in the string that are matched by the mask.
+/// - parameter str: The string to scan.
+/// - parameter len: The largest amount of characters to scan.
+/// - parameter mask: The character classes to match.
+/// - returns: The length of the matched prefix of `str`, which is at most `len`.
+///
+/// Runs of digits and letters are checked eight characters at a time where possible.
+static size_t bib_lex_span(char const *const str, size_t const len, bib_lex_mask_t const mask)
+{
+    size_t index = 0;
+#if BIB_LEX_SWAR
+    uint64_t misses = 0;
+    while (index + sizeof(uint64_t) <= len) {
+        uint64_t word = 0;
+        memcpy(&word, &(str[index]), sizeof(uint64_t));
+        if (!bib_lex_swar_misses(word, mask, &misses)) {
+            break;
+        }
+        if (misses != 0) {
+            return index + (size_t)__builtin_ctzll(misses) / 8;
+        }
+        index += sizeof(uint64_t);
+    }
+#endif
+    while (index < len && bib_lex_is(str[index], mask)) {
+        index += 1;
+    }
+    return index;
+}
+
+/// Read up to `buffer_len-1` characters matched by the mask from the input stream into the given buffer.
+/// This behaves exactly like `bib_lex_char_n` called with the predicate for the same characters.
+static size_t bib_lex_mask_n(char *const buffer, size_t const buffer_len, bib_lex_mask_t const mask,
+                             bib_strbuf_t *const lexer)
+{
+    if (buffer == NULL || buffer_len < 1 || lexer == NULL || lexer->str == NULL || lexer->len == 0) {
+        return 0;
+    }
+    size_t const max_length = (buffer_len - 1 < lexer->len) ? buffer_len - 1 : lexer->len;
+    size_t const length = bib_lex_span(lexer->str, max_length, mask);
+    memcpy(buffer, lexer->str, length);
+    bool success = bib_advance_step(length, &(lexer->str), &(lexer->len));
+    if (!success) {
+        memset(buffer, 0, buffer_len);
+    }
+    return (success) ? length : 0;
+}
+
+/// Consume a single character matched by the mask from the input string.
+/// This behaves exactly like `bib_read_char` called with the predicate for the same characters.
+static bool bib_read_mask(char *const c, bib_lex_mask_t const mask, bib_strbuf_t *const lexer)
+{
+    if (lexer == NULL || lexer->str == NULL || lexer->len == 0) {
+        return false;
+    }
+    char const v = lexer->str[0];
+    bool const success = bib_lex_is(v, mask) && bib_advance_step(1, &(lexer->str), &(lexer->len));
+    if (success && c != NULL) {
+        *c = v;
+    }
+    return success;
+}
+
+/// Consume the given character from the input string.
+static bool bib_read_exact(char const c, bib_strbuf_t *const lexer)
+{
+    if (lexer == NULL || lexer->str == NULL || lexer->len == 0) {
+        return false;
+    }
+    return (lexer->str[0] == c) && bib_advance_step(1, &(lexer->str), &(lexer->len));
+}
+
 bib_strbuf_t bib_strbuf(char const *const str, size_t const len)
 {
     return (bib_strbuf_t){
@@ -132,12 +288,12 @@ bool bib_lex_subclass(bib_alpah03_b buffer, bib_strbuf_t *const lexer)
     static size_t const max_buffer_index = sizeof(bib_alpah03_b) - sizeof(char);
     while ((buffer_index < max_buffer_index) && (string_index < l.len)) {
         const char current_char = l.str[string_index];
-        if (isupper(current_char)) {
+        if (bib_lex_is(current_char, bib_lex_mask_upper)) {
             buffer[buffer_index] = current_char;
             buffer_index += 1;
             string_index += 1;
 #ifdef BIB_LEX_AUTO_UPPERCASE
-        } else if (islower(current_char)) {
+        } else if (bib_lex_is(current_char, bib_lex_mask_lower)) {
             buffer[buffer_index] = toupper(current_char);
             buffer_index += 1;
             string_index += 1;
@@ -162,13 +318,13 @@ bool bib_lex_initial(bib_initial_t *initial, bib_strbuf_t *const lexer)
     }
 
 #ifdef BIB_LEX_AUTO_UPPERCASE
-    bool success = bib_read_char(initial, bib_isalpha, lexer);
-    if (success && islower(*initial)) {
+    bool success = bib_read_mask(initial, bib_lex_mask_alpha, lexer);
+    if (success && bib_lex_is(*initial, bib_lex_mask_lower)) {
         *initial = toupper(*initial);
     }
     return success;
 #else
-    return bib_read_char(initial, bib_isupper, lexer);
+    return bib_read_mask(initial, bib_lex_mask_upper, lexer);
 #endif
 }
 
@@ -318,7 +474,7 @@ bool bib_lex_volume_prefix(bib_word_b buffer, bib_strbuf_t *const lexer)
     char  *outbuf0 = buffer;
     size_t outlen0 = sizeof(bib_word_b);
 
-    size_t alphalen = bib_lex_char_n(outbuf0, outlen0, bib_islower, &l0);
+    size_t alphalen = bib_lex_mask_n(outbuf0, outlen0, bib_lex_mask_lower, &l0);
     bool alpha_success = (alphalen > 0);
 
     bib_strbuf_t l1 = l0;
@@ -339,13 +495,13 @@ bool bib_lex_supplement_prefix(bib_word_b buffer, bib_strbuf_t *const lexer)
     bib_strbuf_t l0 = *lexer;
     char  *outbuf0 = buffer;
     size_t outlen0 = sizeof(bib_word_b);
-    bool success = bib_read_char(buffer, bib_isupper, &l0)
+    bool success = bib_read_mask(buffer, bib_lex_mask_upper, &l0)
                 && bib_advance_step(1, (char const **)&outbuf0, &outlen0);
     if (success) {
         bib_strbuf_t l1 = l0;
         char  *outbuf1 = outbuf0;
         size_t outlen1 = outlen0;
-        size_t length = bib_lex_char_n(outbuf1, outlen1, bib_islower, &l1);
+        size_t length = bib_lex_mask_n(outbuf1, outlen1, bib_lex_mask_lower, &l1);
         if (bib_advance_step(length, (char const **)&outbuf1, &outlen1)) {
             outbuf0 = outbuf1;
             outlen0 = outlen1;
@@ -370,7 +526,7 @@ bool bib_lex_longword(bib_longword_b buffer, bib_strbuf_t *const lexer)
     char  *outbuf0 = buffer;
     size_t outlen0 = sizeof(bib_longword_b);
 
-    size_t wordlen = bib_lex_char_n(outbuf0, outlen0, bib_notspace, &l);
+    size_t wordlen = bib_lex_mask_n(outbuf0, outlen0, bib_lex_mask_notspace, &l);
     bool word_success = (wordlen > 0);
 
     bool success = word_success && bib_advance_strbuf(lexer, &l);
@@ -380,16 +536,103 @@ bool bib_lex_longword(bib_longword_b buffer, bib_strbuf_t *const lexer)
     return success;
 }
 
+#pragma mark - keywords
+
+/// The amount of entries in the keyword table, which must be a power of two.
+#define BIB_KEYWORD_TABLE_SIZE 128
+
+/// The multiplier used to hash keywords.
+///
+/// This was chosen so that every keyword in `bib_keyword_table` is given a distinct slot. Adding keywords to the
+/// table will likely require searching for a new multiplier, such as by trying random odd values until every keyword
+/// hashes to a different slot.
+#define BIB_KEYWORD_HASH_MULTIPLIER 0xce044f17u
+
+/// An entry in the keyword table.
+typedef struct bib_keyword {
+    /// The null-terminated keyword, or `NULL` for an empty slot.
+    char const *word;
+
+    /// The role of the keyword.
+    bib_keyword_kind_t kind;
+} bib_keyword_t;
+
+/// Get the slot in the keyword table for the given word.
+/// - note: The hash uses only the word's first, second, and last characters, along with its length.
+static inline size_t bib_keyword_hash(char const *const str, size_t const len)
+{
+    uint32_t const first = (unsigned char)str[0];
+    uint32_t const second = (len > 1) ? (unsigned char)str[1] : 0;
+    uint32_t const last = (unsigned char)str[len - 1];
+    uint32_t const key = (first << 24) | (second << 16) | (last << 8) | (uint32_t)(len & 0xFF);
+    return (size_t)((key * BIB_KEYWORD_HASH_MULTIPLIER) >> 25);
+}
+
+/// A perfect hash table of the words commonly used within specification segments.
+static bib_keyword_t const bib_keyword_table[BIB_KEYWORD_TABLE_SIZE] = {
+    [  2] = { "fasc",       bib_keyword_kind_volume_prefix },
+    [  6] = { "vols",       bib_keyword_kind_volume_prefix },
+    [  7] = { "kn",         bib_keyword_kind_volume_prefix },
+    [  8] = { "nd",         bib_keyword_kind_ordinal_suffix },
+    [ 14] = { "Indexes",    bib_keyword_kind_supplement_prefix },
+    [ 16] = { "vol",        bib_keyword_kind_volume_prefix },
+    [ 22] = { "t",          bib_keyword_kind_volume_prefix },
+    [ 28] = { "hft",        bib_keyword_kind_volume_prefix },
+    [ 31] = { "jahrg",      bib_keyword_kind_volume_prefix },
+    [ 32] = { "pts",        bib_keyword_kind_volume_prefix },
+    [ 33] = { "ed",         bib_keyword_kind_volume_prefix },
+    [ 34] = { "bk",         bib_keyword_kind_volume_prefix },
+    [ 36] = { "vyp",        bib_keyword_kind_volume_prefix },
+    [ 37] = { "Abstracts",  bib_keyword_kind_supplement_prefix },
+    [ 46] = { "c",          bib_keyword_kind_volume_prefix },
+    [ 47] = { "Suppls",     bib_keyword_kind_supplement_prefix },
+    [ 49] = { "ch",         bib_keyword_kind_volume_prefix },
+    [ 50] = { "v",          bib_keyword_kind_volume_prefix },
+    [ 54] = { "rd",         bib_keyword_kind_ordinal_suffix },
+    [ 56] = { "Suppl",      bib_keyword_kind_supplement_prefix },
+    [ 59] = { "pt",         bib_keyword_kind_volume_prefix },
+    [ 60] = { "d",          bib_keyword_kind_ordinal_suffix },
+    [ 64] = { "Abstract",   bib_keyword_kind_supplement_prefix },
+    [ 67] = { "nos",        bib_keyword_kind_volume_prefix },
+    [ 75] = { "Index",      bib_keyword_kind_supplement_prefix },
+    [ 77] = { "Supplement", bib_keyword_kind_supplement_prefix },
+    [ 78] = { "sec",        bib_keyword_kind_volume_prefix },
+    [ 83] = { "no",         bib_keyword_kind_volume_prefix },
+    [ 87] = { "Appx",       bib_keyword_kind_supplement_prefix },
+    [ 90] = { "sect",       bib_keyword_kind_volume_prefix },
+    [ 93] = { "st",         bib_keyword_kind_ordinal_suffix },
+    [100] = { "anno",       bib_keyword_kind_volume_prefix },
+    [101] = { "knj",        bib_keyword_kind_volume_prefix },
+    [104] = { "ptie",       bib_keyword_kind_volume_prefix },
+    [111] = { "ser",        bib_keyword_kind_volume_prefix },
+    [115] = { "Appendix",   bib_keyword_kind_supplement_prefix },
+    [116] = { "th",         bib_keyword_kind_ordinal_suffix },
+    [123] = { "tom",        bib_keyword_kind_volume_prefix },
+    [126] = { "bd",         bib_keyword_kind_volume_prefix },
+};
+
+bib_keyword_kind_t bib_lex_keyword(char const *const str, size_t const len)
+{
+    if (str == NULL || len == 0 || len >= sizeof(bib_word_b)) {
+        return bib_keyword_kind_none;
+    }
+    bib_keyword_t const *const keyword = &(bib_keyword_table[bib_keyword_hash(str, len)]);
+    bool const match = (keyword->word != NULL)
+                    && (strlen(keyword->word) == len)
+                    && (memcmp(keyword->word, str, len) == 0);
+    return (match) ? keyword->kind : bib_keyword_kind_none;
+}
+
 #pragma mark - lex primitives
 
 size_t bib_lex_digit_n(char *const buffer, size_t const buffer_len, bib_strbuf_t *const lexer)
 {
-    return bib_lex_char_n(buffer, buffer_len, bib_isnumber, lexer);
+    return bib_lex_mask_n(buffer, buffer_len, bib_lex_mask_digit, lexer);
 }
 
 size_t bib_lex_alpha_n(char *const buffer, size_t const buffer_len, bib_strbuf_t *const lexer)
 {
-    return bib_lex_char_n(buffer, buffer_len, bib_isalpha, lexer);
+    return bib_lex_mask_n(buffer, buffer_len, bib_lex_mask_alpha, lexer);
 }
 
 size_t bib_lex_char_n(char *const buffer, size_t const buffer_len, bool (*const pred)(char),
@@ -398,6 +641,10 @@ size_t bib_lex_char_n(char *const buffer, size_t const buffer_len, bool (*const
     if (buffer == NULL || buffer_len < 1 || pred == NULL || lexer == NULL || lexer->str == NULL || lexer->len == 0) {
         return false;
     }
+    bib_lex_mask_t mask = 0;
+    if (bib_lex_mask_for_pred(pred, &mask)) {
+        return bib_lex_mask_n(buffer, buffer_len, mask, lexer);
+    }
     bib_strbuf_t l = *lexer;
 
     size_t string_index = 0;
@@ -427,34 +674,23 @@ bool bib_read_space(bib_strbuf_t *const lexer)
     if (lexer == NULL || lexer->str == NULL || lexer->len == 0) {
         return false;
     }
-    bib_strbuf_t l = *lexer;
-
-    bool stop = false;
-    size_t string_index = 0;
-    while ((string_index < l.len) && !stop) {
-        char current_char = l.str[string_index];
-        if (isspace(current_char)) {
-            string_index += 1;
-        } else {
-            stop = true;
-        }
-    }
-    return bib_advance_step(string_index, &(lexer->str), &(lexer->len));
+    size_t const length = bib_lex_span(lexer->str, lexer->len, bib_lex_mask_space);
+    return bib_advance_step(length, &(lexer->str), &(lexer->len));
 }
 
 bool bib_read_point(bib_strbuf_t *const lexer)
 {
-    return bib_read_char(NULL, bib_ispoint, lexer);
+    return bib_read_mask(NULL, bib_lex_mask_point, lexer);
 }
 
 bool bib_read_dash(bib_strbuf_t *const lexer)
 {
-    return bib_read_char(NULL, bib_isdash, lexer);
+    return bib_read_mask(NULL, bib_lex_mask_dash, lexer);
 }
 
 bool bib_read_slash(bib_strbuf_t *const lexer)
 {
-    return bib_read_char(NULL, bib_isslash, lexer);
+    return bib_read_mask(NULL, bib_lex_mask_slash, lexer);
 }
 
 bool bib_read_etc(bib_strbuf_t *const lexer)
@@ -464,11 +700,11 @@ bool bib_read_etc(bib_strbuf_t *const lexer)
     }
     bib_strbuf_t l = *lexer;
     char word[4] = { 0, 0, 0, 0 };
-    bool comma_success = bib_read_char(NULL, bib_iscomma, &l);
+    bool comma_success = bib_read_mask(NULL, bib_lex_mask_comma, &l);
     bool space_success = comma_success && bib_read_space(&l);
     bool  word_success = false;
     if (space_success) {
-        size_t length = bib_lex_char_n(word, sizeof(word), bib_islower, &l);
+        size_t length = bib_lex_mask_n(word, sizeof(word), bib_lex_mask_lower, &l);
         word_success = (length > 0) && (strcmp(word, "etc") == 0);
     }
     bool point_success = word_success && bib_read_point(&l);
@@ -477,22 +713,22 @@ bool bib_read_etc(bib_strbuf_t *const lexer)
 
 bool bib_read_comma(bib_strbuf_t *const lexer)
 {
-    return bib_read_char(NULL, bib_iscomma, lexer);
+    return bib_read_mask(NULL, bib_lex_mask_comma, lexer);
 }
 
 bool bib_read_colon(bib_strbuf_t *const lexer)
 {
-    return bib_read_char(NULL, bib_iscolon, lexer);
+    return bib_read_exact(':', lexer);
 }
 
 bool bib_read_openangle(bib_strbuf_t *const lexer)
 {
-    return bib_read_char(NULL, bib_isopenangle, lexer);
+    return bib_read_exact('<', lexer);
 }
 
 bool bib_read_closeangle(bib_strbuf_t *const lexer)
 {
-    return bib_read_char(NULL, bib_iscloseangle, lexer);
+    return bib_read_exact('>', lexer);
 }
 
 
@@ -503,6 +739,10 @@ bool bib_read_char(char *const c, bool (*const pred)(char), bib_strbuf_t *const
     if (lexer == NULL || lexer->str == NULL || lexer->len == 0) {
         return false;
     }
+    bib_lex_mask_t mask = 0;
+    if (pred != NULL && bib_lex_mask_for_pred(pred, &mask)) {
+        return bib_read_mask(c, mask, lexer);
+    }
     char v = '\0';
     bool success = bib_peek_char(&v, pred, lexer) && bib_advance_step(1, &(lexer->str), &(lexer->len));
     if (success && c != NULL) {
@@ -526,7 +766,7 @@ bool bib_islower(char c) {
 }
 
 bool bib_isnumber(char c) {
-    return isnumber(c);
+    return isdigit((unsigned char)c);
 }
 
 bool bib_isspace(char c) {
@@ -592,7 +832,9 @@ bool bib_peek_char(char *const c, bib_cpred_f const pred, bib_strbuf_t const *co
         return false;
     }
     char v = lexer->str[0];
-    bool success = (pred == NULL) || pred(v);
+    bib_lex_mask_t mask = 0;
+    bool success = (pred == NULL)
+                || (bib_lex_mask_for_pred(pred, &mask) ? bib_lex_is(v, mask) : pred(v));
     if (success && c != NULL) {
         *c = v;
     }
@@ -609,7 +851,11 @@ bool bib_peek_break(bib_strbuf_t const *const lexer)
         return true;
     }
     char c = '\0';
+#if CHAR_MIN < 0
+    return bib_read_mask(&c, bib_lex_mask_stop, &l);
+#else
     return bib_read_char(&c, bib_isstop, &l);
+#endif
 }
 
 #pragma mark - advance
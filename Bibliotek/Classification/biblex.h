@@ -142,6 +142,32 @@ extern bool bib_lex_supplement_prefix(bib_word_b buffer, bib_strbuf_t *const lex
 /// - returns: `true` when a long word is successfully read from the input string.
 extern bool bib_lex_longword(bib_longword_b buffer, bib_strbuf_t *lexer);
 
+#pragma mark - keywords
+
+/// The role of a commonly used word within a call number's specification segments.
+typedef enum bib_keyword_kind {
+    /// The word isn't a known keyword.
+    bib_keyword_kind_none = 0,
+
+    /// An abbreviation used before a volume number, such as `v` in `v. 2` or `pt` in `pt. 1`.
+    bib_keyword_kind_volume_prefix,
+
+    /// A word used before the number of a supplementary work, such as `Suppl` or `Index`.
+    bib_keyword_kind_supplement_prefix,
+
+    /// A suffix used after an ordinal number, such as `st` in `1st` or `d` in `2d`.
+    bib_keyword_kind_ordinal_suffix
+} bib_keyword_kind_t;
+
+/// Find the role of a known keyword.
+/// - parameter str: The characters of the word, which don't need to be null-terminated.
+/// - parameter len: The amount of characters in the word.
+/// - returns: The kind of keyword matching the given word exactly, or `bib_keyword_kind_none`.
+///
+/// Keywords are found in a fixed-size perfect hash table, so this never needs more than a single string comparison.
+/// The lexers still accept words that aren't in the table, since catalogers use many other abbreviations.
+extern bib_keyword_kind_t bib_lex_keyword(char const *str, size_t len);
+
 #pragma mark - lex primitives
 
 /// Read up to `buffer_len-1` decimal digits from the input stream into the given buffer.
@@ -8,74 +8,333 @@
 
 #include "bibparse.h"
 #include "biblex.h"
+#include "bibtokenizer.h"
 #include <string.h>
 
-static bool bib_parse_date_cpred_isbreak(char c);
-static bool bib_parse_month(bib_month_t *month, bib_strbuf_t *parser);
-static bool bib_parse_date_date(bib_date_t *date, bib_strbuf_t *parser);
-static bool bib_parse_date_span(bib_date_t *date, bib_strbuf_t *parser);
+static bool bib_parse_lc_calln_tokens(bib_lc_calln_t *calln, bib_lc_specification_arena_t *arena,
+                                      bib_tokbuf_t *parser);
+static bool bib_parse_lc_subject_tokens(bib_lc_calln_t *calln, bib_tokbuf_t *parser);
+static bool bib_parse_lc_subject_base_tokens(bib_lc_calln_t *calln, bib_tokbuf_t *parser);
+static bool bib_parse_cuttseg_list_tokens(bib_cuttseg_t segs[3], bib_tokbuf_t *parser);
+static bool bib_parse_dateord_tokens(bib_dateord_t *dord, bib_lex_word_f lex_ord_suffix, bib_tokbuf_t *parser);
+static bool bib_parse_cuttseg_tokens(bib_cuttseg_t *seg, bib_tokbuf_t *parser);
+static bool bib_parse_lc_specification_tokens(bib_lc_specification_t *spc, bib_tokbuf_t *parser);
+static bool bib_parse_lc_remainder_tokens(bib_lc_specification_list_t *rem, bib_lc_specification_arena_t *arena,
+                                          bib_tokbuf_t *parser);
+static bool bib_parse_cutter_tokens(bib_cutter_t *cut, bib_tokbuf_t *parser);
+static bool bib_parse_date_tokens(bib_date_t *date, bib_tokbuf_t *parser);
+static bool bib_parse_ordinal_tokens(bib_ordinal_t *ord, bib_lex_word_f lex_suffix, bib_tokbuf_t *parser);
+static bool bib_parse_volume_tokens(bib_volume_t *vol, bib_tokbuf_t *parser);
+static bool bib_parse_supplement_tokens(bib_supplement_t *supl, bib_tokbuf_t *parser);
+
+static bool bib_parse_date_peek_break(bib_tokbuf_t const *parser);
+static bool bib_parse_month(bib_month_t *month, bib_tokbuf_t *parser);
+static bool bib_parse_date_date(bib_date_t *date, bib_tokbuf_t *parser);
+static bool bib_parse_date_span(bib_date_t *date, bib_tokbuf_t *parser);
+
+#pragma mark - tokenize
+
+/// Split the remaining input from the given string buffer into tokens for one of the parse functions.
+/// - parameter list: Allocated space for the input's tokens.
+/// - parameter tokbuf: Set to a token buffer reading from the start of `list`.
+/// - parameter parser: The string buffer containing the parse function's input.
+/// - returns: `true` when the input is successfully tokenized.
+/// - postcondition: `bib_parse_tokens_end()` must be called when `true` is returned.
+static bool bib_parse_tokens_begin(bib_token_list_t *const list, bib_tokbuf_t *const tokbuf,
+                                   bib_strbuf_t const *const parser)
+{
+    if (!bib_token_list_init(list, parser->str, parser->len)) {
+        return false;
+    }
+    *tokbuf = bib_tokbuf(list);
+    return true;
+}
+
+/// Consume the characters read from the token buffer from the given string buffer, and release the token list.
+/// - parameter success: The result of the parse function reading from the token buffer.
+/// - parameter list: The token list created by `bib_parse_tokens_begin()`.
+/// - parameter tokbuf: The token buffer after being read by the parse function.
+/// - parameter parser: The string buffer containing the parse function's input.
+/// - returns: `true` when `success` is `true` and the string buffer is advanced to match the token buffer.
+static bool bib_parse_tokens_end(bool const success, bib_token_list_t *const list, bib_tokbuf_t const *const tokbuf,
+                                 bib_strbuf_t *const parser)
+{
+    bool const advance_success = success && bib_advance_step(tokbuf->offset, &(parser->str), &(parser->len));
+    bib_token_list_deinit(list);
+    return advance_success;
+}
+
+#pragma mark - parse lc
 
 bool bib_parse_lc_calln(bib_lc_calln_t *const calln, bib_strbuf_t *const parser)
+{
+    return bib_parse_lc_calln_arena(calln, NULL, parser);
+}
+
+bool bib_parse_lc_calln_arena(bib_lc_calln_t *const calln, bib_lc_specification_arena_t *const arena,
+                              bib_strbuf_t *const parser)
 {
     if (calln == NULL || parser == NULL || parser->str == NULL || parser->len == 0) {
         return false;
     }
+    bib_token_list_t list;
+    bib_tokbuf_t tokbuf;
+    if (!bib_parse_tokens_begin(&list, &tokbuf, parser)) {
+        return false;
+    }
+    bool success = bib_parse_lc_calln_tokens(calln, arena, &tokbuf);
+    return bib_parse_tokens_end(success, &list, &tokbuf, parser);
+}
+
+bool bib_parse_lc_subject(bib_lc_calln_t *const calln, bib_strbuf_t *const parser)
+{
+    if (calln == NULL || parser == NULL || parser->str == NULL || parser->len == 0) {
+        return false;
+    }
+    bib_token_list_t list;
+    bib_tokbuf_t tokbuf;
+    if (!bib_parse_tokens_begin(&list, &tokbuf, parser)) {
+        return false;
+    }
+    bool success = bib_parse_lc_subject_tokens(calln, &tokbuf);
+    return bib_parse_tokens_end(success, &list, &tokbuf, parser);
+}
+
+bool bib_parse_lc_subject_base(bib_lc_calln_t *const calln, bib_strbuf_t *const parser)
+{
+    if (calln == NULL || parser == NULL || parser->str == NULL || parser->len == 0) {
+        return false;
+    }
+    bib_token_list_t list;
+    bib_tokbuf_t tokbuf;
+    if (!bib_parse_tokens_begin(&list, &tokbuf, parser)) {
+        return false;
+    }
+    bool success = bib_parse_lc_subject_base_tokens(calln, &tokbuf);
+    return bib_parse_tokens_end(success, &list, &tokbuf, parser);
+}
+
+bool bib_parse_cuttseg_list(bib_cuttseg_t segs[3], bib_strbuf_t *const parser)
+{
+    if (segs == NULL || parser == NULL || parser->str == NULL || parser->len == 0) {
+        return false;
+    }
+    bib_token_list_t list;
+    bib_tokbuf_t tokbuf;
+    if (!bib_parse_tokens_begin(&list, &tokbuf, parser)) {
+        return false;
+    }
+    bool success = bib_parse_cuttseg_list_tokens(segs, &tokbuf);
+    return bib_parse_tokens_end(success, &list, &tokbuf, parser);
+}
+
+bool bib_parse_dateord(bib_dateord_t *const dord, bib_lex_word_f const lex_ord_suffix, bib_strbuf_t *const parser)
+{
+    if (dord == NULL || parser == NULL || parser->str == NULL || parser->len == 0) {
+        return false;
+    }
+    bib_token_list_t list;
+    bib_tokbuf_t tokbuf;
+    if (!bib_parse_tokens_begin(&list, &tokbuf, parser)) {
+        return false;
+    }
+    bool success = bib_parse_dateord_tokens(dord, lex_ord_suffix, &tokbuf);
+    return bib_parse_tokens_end(success, &list, &tokbuf, parser);
+}
+
+bool bib_parse_cuttseg(bib_cuttseg_t *seg, bib_strbuf_t *const parser)
+{
+    if (seg == NULL || parser == NULL || parser->str == NULL || parser->len == 0) {
+        return false;
+    }
+    bib_token_list_t list;
+    bib_tokbuf_t tokbuf;
+    if (!bib_parse_tokens_begin(&list, &tokbuf, parser)) {
+        return false;
+    }
+    bool success = bib_parse_cuttseg_tokens(seg, &tokbuf);
+    return bib_parse_tokens_end(success, &list, &tokbuf, parser);
+}
+
+bool bib_parse_lc_specification(bib_lc_specification_t *const spc, bib_strbuf_t *const parser)
+{
+    if (spc == NULL || parser == NULL || parser->str == NULL || parser->len == 0) {
+        return false;
+    }
+    bib_token_list_t list;
+    bib_tokbuf_t tokbuf;
+    if (!bib_parse_tokens_begin(&list, &tokbuf, parser)) {
+        return false;
+    }
+    bool success = bib_parse_lc_specification_tokens(spc, &tokbuf);
+    return bib_parse_tokens_end(success, &list, &tokbuf, parser);
+}
+
+bool bib_parse_lc_remainder(bib_lc_specification_list_t *const rem, bib_strbuf_t *const parser)
+{
+    if (rem == NULL || parser == NULL || parser->str == NULL || parser->len == 0) {
+        return false;
+    }
+    bib_token_list_t list;
+    bib_tokbuf_t tokbuf;
+    if (!bib_parse_tokens_begin(&list, &tokbuf, parser)) {
+        return false;
+    }
+    bool success = bib_parse_lc_remainder_tokens(rem, NULL, &tokbuf);
+    return bib_parse_tokens_end(success, &list, &tokbuf, parser);
+}
+
+bool bib_parse_cutter(bib_cutter_t *cut, bib_strbuf_t *const parser)
+{
+    if (cut == NULL || parser == NULL || parser->str == NULL || parser->len == 0) {
+        return false;
+    }
+    bib_token_list_t list;
+    bib_tokbuf_t tokbuf;
+    if (!bib_parse_tokens_begin(&list, &tokbuf, parser)) {
+        return false;
+    }
+    bool success = bib_parse_cutter_tokens(cut, &tokbuf);
+    return bib_parse_tokens_end(success, &list, &tokbuf, parser);
+}
+
+bool bib_parse_date(bib_date_t *const date, bib_strbuf_t *const parser)
+{
+    if (date == NULL || parser == NULL || parser->str == NULL || parser->len == 0) {
+        return false;
+    }
+    bib_token_list_t list;
+    bib_tokbuf_t tokbuf;
+    if (!bib_parse_tokens_begin(&list, &tokbuf, parser)) {
+        return false;
+    }
+    bool success = bib_parse_date_tokens(date, &tokbuf);
+    return bib_parse_tokens_end(success, &list, &tokbuf, parser);
+}
+
+bool bib_parse_ordinal(bib_ordinal_t *ord, bib_lex_word_f lex_suffix, bib_strbuf_t *const parser)
+{
+    if (ord == NULL || lex_suffix == NULL || parser == NULL || parser->str == NULL || parser->len == 0) {
+        return false;
+    }
+    bib_token_list_t list;
+    bib_tokbuf_t tokbuf;
+    if (!bib_parse_tokens_begin(&list, &tokbuf, parser)) {
+        return false;
+    }
+    bool success = bib_parse_ordinal_tokens(ord, lex_suffix, &tokbuf);
+    return bib_parse_tokens_end(success, &list, &tokbuf, parser);
+}
+
+bool bib_parse_cutter_ordinal(bib_ordinal_t *const ord, bib_strbuf_t *const parser)
+{
+    return bib_parse_ordinal(ord, bib_lex_cutter_ordinal_suffix, parser);
+}
+
+bool bib_parse_caption_ordinal(bib_ordinal_t *const ord, bib_strbuf_t *const parser)
+{
+    return bib_parse_ordinal(ord, bib_lex_caption_ordinal_suffix, parser);
+}
+
+bool bib_parse_specification_ordinal(bib_ordinal_t *const ord, bib_strbuf_t *const parser)
+{
+    return bib_parse_ordinal(ord, bib_lex_specification_ordinal_suffix, parser);
+}
+
+bool bib_parse_volume(bib_volume_t *const vol, bib_strbuf_t *const parser)
+{
+    if (vol == NULL || parser == NULL || parser->str == NULL || parser->len == 0) {
+        return false;
+    }
+    bib_token_list_t list;
+    bib_tokbuf_t tokbuf;
+    if (!bib_parse_tokens_begin(&list, &tokbuf, parser)) {
+        return false;
+    }
+    bool success = bib_parse_volume_tokens(vol, &tokbuf);
+    return bib_parse_tokens_end(success, &list, &tokbuf, parser);
+}
+
+bool bib_parse_supplement(bib_supplement_t *supl, bib_strbuf_t *parser)
+{
+    if (supl == NULL || parser == NULL || parser->str == NULL || parser->len == 0) {
+        return false;
+    }
+    bib_token_list_t list;
+    bib_tokbuf_t tokbuf;
+    if (!bib_parse_tokens_begin(&list, &tokbuf, parser)) {
+        return false;
+    }
+    bool success = bib_parse_supplement_tokens(supl, &tokbuf);
+    return bib_parse_tokens_end(success, &list, &tokbuf, parser);
+}
+
+#pragma mark - parse lc tokens
+
+static bool bib_parse_lc_calln_tokens(bib_lc_calln_t *const calln, bib_lc_specification_arena_t *const arena,
+                                      bib_tokbuf_t *const parser)
+{
+    if (calln == NULL || parser == NULL || parser->count == 0) {
+        return false;
+    }
 
     /// subject matter
-    bib_strbuf_t p0 = *parser;
-    bool sub_success = bib_parse_lc_subject(calln, &p0);
+    bib_tokbuf_t p0 = *parser;
+    bool sub_success = bib_parse_lc_subject_tokens(calln, &p0);
 
     /// cutter numbers
-    bib_strbuf_t p1 = (sub_success) ? p0 : *parser;
-    bool __unused  _ = sub_success && bib_read_space(&p1);
-    bool cut_success = sub_success && bib_parse_cuttseg_list(calln->cutters, &p1);
+    bib_tokbuf_t p1 = (sub_success) ? p0 : *parser;
+    bool __unused  _ = sub_success && bib_token_read_space(&p1);
+    bool cut_success = sub_success && bib_parse_cuttseg_list_tokens(calln->cutters, &p1);
 
     // specifications[0]
-    bib_strbuf_t p2 = (cut_success) ? p1 : p0;
-    bool spc_0_space_success = sub_success && bib_read_space(&p2);
+    bib_tokbuf_t p2 = (cut_success) ? p1 : p0;
+    bool spc_0_space_success = sub_success && bib_token_read_space(&p2);
     bool spc_0_parse_success = spc_0_space_success
-                            && bib_parse_lc_specification(&(calln->specifications[0]), &p2);
+                            && bib_parse_lc_specification_tokens(&(calln->specifications[0]), &p2);
 
     // specifications[1]
-    bib_strbuf_t p3 = (spc_0_parse_success) ? p2 : p1;
-    bool spc_1_space_success = spc_0_parse_success && bib_read_space(&p3);
+    bib_tokbuf_t p3 = (spc_0_parse_success) ? p2 : p1;
+    bool spc_1_space_success = spc_0_parse_success && bib_token_read_space(&p3);
     bool spc_1_parse_success = spc_1_space_success
-                            && bib_parse_lc_specification(&(calln->specifications[1]), &p3);
+                            && bib_parse_lc_specification_tokens(&(calln->specifications[1]), &p3);
 
     // remainder
-    bib_strbuf_t p4 = (spc_1_parse_success) ? p3 : p2;
-    bool rem_space_success = spc_1_parse_success && bib_read_space(&p4);
-    bool rem_parse_success = rem_space_success && bib_parse_lc_remainder(&(calln->remainder), &p4);
+    bib_tokbuf_t p4 = (spc_1_parse_success) ? p3 : p2;
+    bool rem_space_success = spc_1_parse_success && bib_token_read_space(&p4);
+    bool rem_parse_success = rem_space_success && bib_parse_lc_remainder_tokens(&(calln->remainder), arena, &p4);
 
-    bool success = bib_advance_strbuf(parser, (rem_parse_success)   ? &p4
+    bool success = bib_advance_tokbuf(parser, (rem_parse_success)   ? &p4
                                             : (spc_1_parse_success) ? &p3
                                             : (spc_0_parse_success) ? &p2
                                             : (cut_success)         ? &p1
                                             : (sub_success)         ? &p0
                                             : NULL);
-    if (!success) {
+    if (success) {
+        calln->fingerprint = bib_lc_calln_fingerprint(calln);
+    } else {
         bib_lc_specification_list_deinit(&(calln->remainder));
     }
     return success;
 }
 
-bool bib_parse_lc_subject(bib_lc_calln_t *const calln, bib_strbuf_t *const parser)
+static bool bib_parse_lc_subject_tokens(bib_lc_calln_t *const calln, bib_tokbuf_t *const parser)
 {
-    if (calln == NULL || parser == NULL || parser->str == NULL || parser->len == 0) {
+    if (calln == NULL || parser == NULL || parser->count == 0) {
         return false;
     }
 
     /// subject matter class and subclass
-    bib_strbuf_t p0 = *parser;
-    bool base_success = bib_parse_lc_subject_base(calln, &p0);
+    bib_tokbuf_t p0 = *parser;
+    bool base_success = bib_parse_lc_subject_base_tokens(calln, &p0);
 
     /// subject matter date or ordinal
-    bib_strbuf_t p1 = p0;
-    bool space_success = base_success && bib_read_space(&p1);
-    bool dord_success = space_success && bib_parse_dateord(&(calln->dateord),
-                                                           bib_lex_caption_ordinal_suffix,
-                                                           &p1);
-    bool success = bib_advance_strbuf(parser, (dord_success) ? &p1
+    bib_tokbuf_t p1 = p0;
+    bool space_success = base_success && bib_token_read_space(&p1);
+    bool dord_success = space_success && bib_parse_dateord_tokens(&(calln->dateord),
+                                                                  bib_lex_caption_ordinal_suffix,
+                                                                  &p1);
+    bool success = bib_advance_tokbuf(parser, (dord_success) ? &p1
                                             : (base_success) ? &p0
                                             : NULL);
     if (!success) {
@@ -84,23 +343,23 @@ bool bib_parse_lc_subject(bib_lc_calln_t *const calln, bib_strbuf_t *const parse
     return success;
 }
 
-bool bib_parse_lc_subject_base(bib_lc_calln_t *const calln, bib_strbuf_t *const parser)
+static bool bib_parse_lc_subject_base_tokens(bib_lc_calln_t *const calln, bib_tokbuf_t *const parser)
 {
-    if (calln == NULL || parser == NULL || parser->str == NULL || parser->len == 0) {
+    if (calln == NULL || parser == NULL || parser->count == 0) {
         return false;
     }
 
     // subject matter class
-    bib_strbuf_t p0 = *parser;
-    bool cls_success = bib_lex_subclass(calln->letters, &p0);
+    bib_tokbuf_t p0 = *parser;
+    bool cls_success = bib_token_lex_subclass(calln->letters, &p0);
 
     // subject matter subclass
-    bib_strbuf_t p1 = p0;
-    bool __unused __ = cls_success && bib_read_space(&p1); // optional space
-    bool int_success = cls_success && bib_lex_integer(calln->integer, &p1);
-    bool __unused  _ = int_success && bib_lex_decimal(calln->decimal, &p1);
+    bib_tokbuf_t p1 = p0;
+    bool __unused __ = cls_success && bib_token_read_space(&p1); // optional space
+    bool int_success = cls_success && bib_token_lex_integer(calln->integer, &p1);
+    bool __unused  _ = int_success && bib_token_lex_decimal(calln->decimal, &p1);
 
-    bool success = bib_advance_strbuf(parser, (int_success) ? &p1
+    bool success = bib_advance_tokbuf(parser, (int_success) ? &p1
                                             : (cls_success) ? &p0
                                             : NULL);
     if (!success) {
@@ -111,67 +370,68 @@ bool bib_parse_lc_subject_base(bib_lc_calln_t *const calln, bib_strbuf_t *const
     return success;
 }
 
-bool bib_parse_cuttseg_list(bib_cuttseg_t segs[3], bib_strbuf_t *const parser)
+static bool bib_parse_cuttseg_list_tokens(bib_cuttseg_t segs[3], bib_tokbuf_t *const parser)
 {
-    if (segs == NULL || parser == NULL || parser->str == NULL || parser->len == 0) {
+    if (segs == NULL || parser == NULL || parser->count == 0) {
         return false;
     }
 
-    bib_strbuf_t p0 = *parser;
-    bool __unused point_success = bib_read_point(&p0);
+    bib_tokbuf_t p0 = *parser;
+    bool __unused point_success = bib_token_read_point(&p0);
 
     bool stop = false;
     size_t index = 0;
     bool success = true; // point_success;
     while (index < 3 && success && !stop) {
-        bib_strbuf_t p1 = p0;
+        bib_tokbuf_t p1 = p0;
         bool first = (index == 0);
         bool has_prev_date = !first && !bib_dateord_is_empty(&(segs[index - 1].dateord));
         bool has_prev_mark = !first && !(segs[index - 1].cutter.mark[0] == '\0');
-        bool space_success = !first && bib_read_space(&p1);
+        bool space_success = !first && bib_token_read_space(&p1);
         bool require_space = (has_prev_date || has_prev_mark);
-        bool point_success = bib_read_point(&p1);
+        bool point_success = bib_token_read_point(&p1);
 
         if (require_space && !space_success && !point_success) {
-            success = bib_peek_break(&p1);
+            success = bib_token_peek_break(&p1);
             stop = true;
             break;
-        } else if (bib_parse_cuttseg(&(segs[index]), &p1)) {
+        } else if (bib_parse_cuttseg_tokens(&(segs[index]), &p1)) {
             p0 = p1;
             index += 1;
         } else {
-            success = !first || space_success || bib_peek_break(&p1);
+            success = !first || space_success || bib_token_peek_break(&p1);
             stop = true;
         }
     }
 
-    success = success && bib_advance_strbuf(parser, &p0);
+    success = success && bib_advance_tokbuf(parser, &p0);
     if (!success) {
         memset(segs, 0, sizeof(bib_cuttseg_t) * 3);
     }
     return success;
 }
 
-bool bib_parse_dateord(bib_dateord_t *const dord, bib_lex_word_f const lex_ord_suffix, bib_strbuf_t *const parser)
+static bool bib_parse_dateord_tokens(bib_dateord_t *const dord, bib_lex_word_f const lex_ord_suffix,
+                                     bib_tokbuf_t *const parser)
 {
-    if (dord == NULL || parser == NULL || parser->str == NULL || parser->len == 0) {
+    if (dord == NULL || parser == NULL || parser->count == 0) {
         return false;
     }
 
-    bib_strbuf_t p0 = *parser;
+    bib_tokbuf_t p0 = *parser;
 
     bib_date_t date = {};
-    bool date_success = bib_parse_date(&date, &p0)
+    bool date_success = bib_parse_date_tokens(&date, &p0)
                      && bib_dateord_init_date(dord, &date);
 
-    bib_strbuf_t p1 = *parser;
+    bib_tokbuf_t p1 = *parser;
 
     bib_ordinal_t ord = {};
     bool ordl_success = !date_success
-                     && bib_parse_ordinal(&ord, lex_ord_suffix, &p1)
+                     && bib_parse_ordinal_tokens(&ord, lex_ord_suffix, &p1)
                      && bib_dateord_init_ordinal(dord, &ord);
 
-    bool success = (date_success || ordl_success) && bib_advance_strbuf(parser, (date_success) ? &p0
+    bool success = (date_success || ordl_success) && bib_advance_tokbuf(parser, (date_success) ? &p0
                                                                               : (ordl_success) ? &p1
                                                                               : NULL);
     if (!success) {
@@ -180,22 +440,22 @@ bool bib_parse_dateord(bib_dateord_t *const dord, bib_lex_word_f const lex_ord_s
     return success;
 }
 
-bool bib_parse_cuttseg(bib_cuttseg_t *seg, bib_strbuf_t *const parser)
+static bool bib_parse_cuttseg_tokens(bib_cuttseg_t *seg, bib_tokbuf_t *const parser)
 {
-    if (seg == NULL || parser == NULL || parser->str == NULL || parser->len == 0) {
+    if (seg == NULL || parser == NULL || parser->count == 0) {
         return false;
     }
 
-    bib_strbuf_t p0 = *parser;
-    bool cutter_success = bib_parse_cutter(&(seg->cutter), &p0);
+    bib_tokbuf_t p0 = *parser;
+    bool cutter_success = bib_parse_cutter_tokens(&(seg->cutter), &p0);
 
-    bib_strbuf_t p1 = p0;
-    bool  space_success = cutter_success && bib_read_space(&p1);
-    bool number_success = space_success && bib_parse_dateord(&(seg->dateord),
-                                                             bib_lex_cutter_ordinal_suffix,
-                                                             &p1);
+    bib_tokbuf_t p1 = p0;
+    bool  space_success = cutter_success && bib_token_read_space(&p1);
+    bool number_success = space_success && bib_parse_dateord_tokens(&(seg->dateord),
+                                                                    bib_lex_cutter_ordinal_suffix,
+                                                                    &p1);
 
-    bool success = (number_success || cutter_success) && bib_advance_strbuf(parser, (number_success) ? &p1
+    bool success = (number_success || cutter_success) && bib_advance_tokbuf(parser, (number_success) ? &p1
                                                                                   : (cutter_success) ? &p0
                                                                                   : NULL);
     if (!success) {
@@ -204,41 +464,92 @@ bool bib_parse_cuttseg(bib_cuttseg_t *seg, bib_strbuf_t *const parser)
     return success;
 }
 
-bool bib_parse_lc_specification(bib_lc_specification_t *const spc, bib_strbuf_t *const parser)
+/// Find the first kind of specification segment that could possibly be read from the token stream.
+/// - parameter parser: The token buffer positioned at the start of a specification segment.
+/// - returns: The kind of specification segment to try reading first. Every kind ordered before the returned
+///            value is certain to fail, so those branches can be skipped without changing the parsed result.
+///
+/// Dates and ordinals must start with digits, supplements with an uppercase letter, and volumes with lowercase
+/// letters followed by a period. Known keywords like `v` or `Suppl` are looked up in a perfect hash table first,
+/// and other words fall back to the case of their first letter.
+static bib_lc_specification_kind_t bib_lc_specification_kind_guess(bib_tokbuf_t const *const parser)
 {
-    if (spc == NULL || parser == NULL || parser->str == NULL || parser->len == 0) {
+    if (parser->count == 0 || parser->pos >= parser->tok->len) {
+        return bib_lc_specification_kind_date;
+    }
+    bib_token_t const *const token = parser->tok;
+    bib_token_t const *const next = (parser->count > 1) ? &(token[1]) : NULL;
+    char const *const str = &(token->str[parser->pos]);
+    size_t const len = token->len - parser->pos;
+    switch (token->kind) {
+        case bib_token_kind_digits:
+            // a year is exactly four digits, and an ordinal's suffix must follow its digits
+            return (len >= 4) ? bib_lc_specification_kind_date
+                 : (next != NULL && next->kind == bib_token_kind_letters) ? bib_lc_specification_kind_ordinal
+                 : bib_lc_specification_kind_word;
+        case bib_token_kind_letters: {
+            bool const point = (next != NULL && next->kind == bib_token_kind_point);
+            switch (bib_lex_keyword(str, len)) {
+                case bib_keyword_kind_supplement_prefix:
+                    return bib_lc_specification_kind_supplement;
+                case bib_keyword_kind_volume_prefix:
+                    return (point) ? bib_lc_specification_kind_volume : bib_lc_specification_kind_word;
+                default:
+                    break;
+            }
+            bib_char_class_t const leading = bib_char_class(str[0]);
+            return (leading == bib_char_class_upper) ? bib_lc_specification_kind_supplement
+                 : (leading == bib_char_class_lower && point) ? bib_lc_specification_kind_volume
+                 : bib_lc_specification_kind_word;
+        }
+        default:
+            return bib_lc_specification_kind_word;
+    }
+}
+
+static bool bib_parse_lc_specification_tokens(bib_lc_specification_t *const spc, bib_tokbuf_t *const parser)
+{
+    if (spc == NULL || parser == NULL || parser->count == 0) {
         return false;
     }
 
-    bib_strbuf_t p0 = *parser;
-    bool date_success = bib_parse_date(&(spc->date), &p0)
-                     && bib_peek_break(&p0);
+    // skip the branches that can't match the first token, instead of backtracking through each of them
+    bib_lc_specification_kind_t const first = bib_lc_specification_kind_guess(parser);
+    memset(spc, 0, sizeof(bib_lc_specification_t));
 
-    bib_strbuf_t p1 = *parser;
+    bib_tokbuf_t p0 = *parser;
+    bool date_success = (first <= bib_lc_specification_kind_date)
+                     && bib_parse_date_tokens(&(spc->date), &p0)
+                     && bib_token_peek_break(&p0);
+
+    bib_tokbuf_t p1 = *parser;
     bool  ord_success = !date_success
-                     && bib_parse_specification_ordinal(&(spc->ordinal), &p1)
-                     && bib_peek_break(&p1);
+                     && (first <= bib_lc_specification_kind_ordinal)
+                     && bib_parse_ordinal_tokens(&(spc->ordinal), bib_lex_specification_ordinal_suffix, &p1)
+                     && bib_token_peek_break(&p1);
 
-    bib_strbuf_t p2 = *parser;
+    bib_tokbuf_t p2 = *parser;
     bool supl_success = !date_success
                      && !ord_success
-                     && bib_parse_supplement(&(spc->supplement), &p2)
-                     && bib_peek_break(&p2);
+                     && (first <= bib_lc_specification_kind_supplement)
+                     && bib_parse_supplement_tokens(&(spc->supplement), &p2)
+                     && bib_token_peek_break(&p2);
 
-    bib_strbuf_t p3 = *parser;
+    bib_tokbuf_t p3 = *parser;
     bool  vol_success = !date_success
                      && !ord_success
                      && !supl_success
-                     && bib_parse_volume(&(spc->volume), &p3)
-                     && bib_peek_break(&p3);
+                     && (first <= bib_lc_specification_kind_volume)
+                     && bib_parse_volume_tokens(&(spc->volume), &p3)
+                     && bib_token_peek_break(&p3);
 
-    bib_strbuf_t p4 = *parser;
+    bib_tokbuf_t p4 = *parser;
     bool word_success = !date_success
                      && !ord_success
                      && !supl_success
                      && !vol_success
-                     && bib_lex_longword(spc->word, &p4)
-                     && bib_peek_break(&p4);
+                     && bib_token_lex_longword(spc->word, &p4)
+                     && bib_token_peek_break(&p4);
 
     spc->kind = (date_success) ? bib_lc_specification_kind_date
               :  (ord_success) ? bib_lc_specification_kind_ordinal
@@ -246,7 +557,7 @@ bool bib_parse_lc_specification(bib_lc_specification_t *const spc, bib_strbuf_t
               :  (vol_success) ? bib_lc_specification_kind_volume
               : (word_success) ? bib_lc_specification_kind_word
               : 0;
-    bool success = (spc->kind != 0) && bib_advance_strbuf(parser, (date_success) ? &p0
+    bool success = (spc->kind != 0) && bib_advance_tokbuf(parser, (date_success) ? &p0
                                                                 :  (ord_success) ? &p1
                                                                 : (supl_success) ? &p2
                                                                 :  (vol_success) ? &p3
@@ -258,23 +569,24 @@ bool bib_parse_lc_specification(bib_lc_specification_t *const spc, bib_strbuf_t
     return success;
 }
 
-bool bib_parse_lc_remainder(bib_lc_specification_list_t *const rem, bib_strbuf_t *const parser)
+static bool bib_parse_lc_remainder_tokens(bib_lc_specification_list_t *const rem,
+                                          bib_lc_specification_arena_t *const arena, bib_tokbuf_t *const parser)
 {
-    if (rem == NULL || parser == NULL || parser->str == NULL || parser->len == 0) {
+    if (rem == NULL || parser == NULL || parser->count == 0) {
         return false;
     }
 
-    bib_strbuf_t p0 = *parser;
+    bib_tokbuf_t p0 = *parser;
 
     size_t index = 0;
     bool stop = false;
     bool success = true;
-    bib_lc_specification_list_init(rem);
-    while ((p0.len != 0) && success && !stop) {
-        bib_strbuf_t p1 = p0;
+    bib_lc_specification_list_init_arena(rem, arena);
+    while ((p0.count != 0) && success && !stop) {
+        bib_tokbuf_t p1 = p0;
         bib_lc_specification_t special = {};
-        bool pre_success = (index == 0) || bib_read_space(&p1);
-        bool spc_success = pre_success && bib_parse_lc_specification(&special, &p1);
+        bool pre_success = (index == 0) || bib_token_read_space(&p1);
+        bool spc_success = pre_success && bib_parse_lc_specification_tokens(&special, &p1);
         success = spc_success || (index > 0);
         stop = !spc_success;
         if (spc_success) {
@@ -284,25 +596,25 @@ bool bib_parse_lc_remainder(bib_lc_specification_list_t *const rem, bib_strbuf_t
         }
     }
 
-    success = success && bib_advance_strbuf(parser, &p0);
+    success = success && bib_advance_tokbuf(parser, &p0);
     if (!success) {
         bib_lc_specification_list_deinit(rem);
     }
     return success;
 }
 
-bool bib_parse_cutter(bib_cutter_t *cut, bib_strbuf_t *const parser)
+static bool bib_parse_cutter_tokens(bib_cutter_t *cut, bib_tokbuf_t *const parser)
 {
-    if (cut == NULL || parser == NULL || parser->str == NULL || parser->len == 0) {
+    if (cut == NULL || parser == NULL || parser->count == 0) {
         return false;
     }
 
-    bib_strbuf_t p0 = *parser;
-    bool cutter_success = bib_lex_initial(&(cut->letter), &p0);
-    bool number_success = cutter_success && bib_lex_digit16(cut->number, &p0);
+    bib_tokbuf_t p0 = *parser;
+    bool cutter_success = bib_token_lex_initial(&(cut->letter), &p0);
+    bool number_success = cutter_success && bib_token_lex_digit16(cut->number, &p0);
 
-    bib_strbuf_t p1 = p0;
-    bool mark_success = cutter_success && number_success && bib_lex_mark(cut->mark, &p1);
+    bib_tokbuf_t p1 = p0;
+    bool mark_success = cutter_success && number_success && bib_token_lex_mark(cut->mark, &p1);
     // if a mark is only one character, we should treat it as cutter
     if (mark_success && (strlen(cut->mark) < 2)) {
         memset(cut->mark, 0, sizeof(bib_mark_b));
@@ -311,37 +623,41 @@ bool bib_parse_cutter(bib_cutter_t *cut, bib_strbuf_t *const parser)
     }
 
     bool success = cutter_success
-                && (number_success || bib_peek_char(NULL, bib_isstop, &p1))
-                && bib_advance_strbuf(parser, &p1);
+                && (number_success || bib_token_peek_stop(&p1))
+                && bib_advance_tokbuf(parser, &p1);
     if (!success) {
         memset(cut, 0, sizeof(bib_cutter_t));
     }
     return success;
 }
 
-static bool bib_parse_date_cpred_isbreak(char c) {
-    return bib_isspace(c) || bib_ispoint(c) || bib_isstop(c);
+static bool bib_parse_date_peek_break(bib_tokbuf_t const *const parser)
+{
+    bib_token_t const *const token = bib_token_peek(parser);
+    return (token != NULL) && (token->kind == bib_token_kind_space
+                            || token->kind == bib_token_kind_point
+                            || token->kind == bib_token_kind_stop);
 }
 
-static bool bib_parse_month(bib_month_t *month, bib_strbuf_t *const parser)
+static bool bib_parse_month(bib_month_t *month, bib_tokbuf_t *const parser)
 {
-    if (month == NULL || parser == NULL || parser->str == NULL || parser->len == 0) {
+    if (month == NULL || parser == NULL || parser->count == 0) {
         return false;
     }
 
-    bib_strbuf_t p0 = *parser;
+    bib_tokbuf_t p0 = *parser;
 
     char abbrev[5];
     memset(abbrev, 0, sizeof(abbrev));
-    bool abbrev_success = bib_read_char(&(abbrev[0]), bib_isupper, &p0)
-                       && bib_read_char(&(abbrev[1]), bib_islower, &p0)
-                       && bib_read_char(&(abbrev[2]), bib_islower, &p0);
+    bool abbrev_success = bib_token_read_char(&(abbrev[0]), bib_char_class_upper, &p0)
+                       && bib_token_read_char(&(abbrev[1]), bib_char_class_lower, &p0)
+                       && bib_token_read_char(&(abbrev[2]), bib_char_class_lower, &p0);
     if (!abbrev_success) {
         *month = 0;
         return false;
     }
     bib_month_t result = 0;
-    if (bib_peek_char(NULL, bib_parse_date_cpred_isbreak, &p0)) {
+    if (bib_parse_date_peek_break(&p0)) {
         result = (strcmp("Jan", abbrev) == 0) ? bib_month_jan
                : (strcmp("Feb", abbrev) == 0) ? bib_month_feb
                : (strcmp("Mar", abbrev) == 0) ? bib_month_mar
@@ -355,45 +671,45 @@ static bool bib_parse_month(bib_month_t *month, bib_strbuf_t *const parser)
                : (strcmp("Dec", abbrev) == 0) ? bib_month_dec
                : 0;
     } else {
-        bool issept = bib_read_char(&(abbrev[3]), bib_islower, &p0)
-                   && bib_peek_char(NULL, bib_parse_date_cpred_isbreak, &p0)
+        bool issept = bib_token_read_char(&(abbrev[3]), bib_char_class_lower, &p0)
+                   && bib_parse_date_peek_break(&p0)
                    && (strcmp("Sept", abbrev) == 0);
         result = (issept) ? bib_month_sept : 0;
     }
-    bool success = (result != 0) && bib_advance_strbuf(parser, &p0);
+    bool success = (result != 0) && bib_advance_tokbuf(parser, &p0);
     *month = (success) ? result : 0;
     return success;
 }
 
-static bool bib_parse_date_date(bib_date_t *date, bib_strbuf_t *const parser)
+static bool bib_parse_date_date(bib_date_t *date, bib_tokbuf_t *const parser)
 {
-    if (date == NULL || parser == NULL || parser->str == NULL || parser->len == 0) {
+    if (date == NULL || parser == NULL || parser->count == 0) {
         return false;
     }
-    bib_strbuf_t p0 = *parser;
-    bool __unused _cma = bib_read_comma(&p0);
-    bool require_space = bib_read_space(&p0);
+    bib_tokbuf_t p0 = *parser;
+    bool __unused _cma = bib_token_read_comma(&p0);
+    bool require_space = bib_token_read_space(&p0);
     bool month_success = require_space && bib_parse_month(&(date->month), &p0);
 
-    bib_strbuf_t p1 = p0;
-    bool point_success = month_success && bib_read_point(&p1);
-    bool space_success = month_success && bib_read_space(&p1);
+    bib_tokbuf_t p1 = p0;
+    bool point_success = month_success && bib_token_read_point(&p1);
+    bool space_success = month_success && bib_token_read_space(&p1);
 
     char day[3];
     memset(day, 0, sizeof(day));
     bool day_success = (point_success || space_success)
-                    && bib_lex_char_n(day, sizeof(day), bib_isnumber, &p1)
-                    && bib_peek_char(NULL, bib_parse_date_cpred_isbreak, &p1);
+                    && bib_token_lex_digit_n(day, sizeof(day), &p1)
+                    && bib_parse_date_peek_break(&p1);
     date->day = (day_success) ? atoi(day) : 0;
     day_success = day_success && (date->day > 0) && (date->day < 32);
 
-    bib_strbuf_t p2 = p0;
+    bib_tokbuf_t p2 = p0;
     // consume the decimal point if it's the last element from the input stream
     bool consume_point = month_success && !day_success
-                      && bib_read_point(&p0)
-                      && bib_peek_char(NULL, bib_isstop, &p2);
+                      && bib_token_read_point(&p0)
+                      && bib_token_peek_stop(&p2);
 
-    bool success = (day_success || month_success) && bib_advance_strbuf(parser, (consume_point) ? &p2
+    bool success = (day_success || month_success) && bib_advance_tokbuf(parser, (consume_point) ? &p2
                                                                               :   (day_success) ? &p1
                                                                               : (month_success) ? &p0
                                                                               : NULL);
@@ -406,18 +722,18 @@ static bool bib_parse_date_date(bib_date_t *date, bib_strbuf_t *const parser)
     return success;
 }
 
-static bool bib_parse_date_span(bib_date_t *const date, bib_strbuf_t *const parser)
+static bool bib_parse_date_span(bib_date_t *const date, bib_tokbuf_t *const parser)
 {
-    if (date == NULL || parser == NULL || parser->str == NULL || parser->len == 0) {
+    if (date == NULL || parser == NULL || parser->count == 0) {
         return false;
     }
     bib_year_b span = {};
-    bib_strbuf_t p0 = *parser;
-    bool dash_success = bib_read_dash(&p0);
-    bool slsh_success = !dash_success && bib_read_slash(&p0);
+    bib_tokbuf_t p0 = *parser;
+    bool dash_success = bib_token_read_dash(&p0);
+    bool slsh_success = !dash_success && bib_token_read_slash(&p0);
     bool span_success = (dash_success || slsh_success)
-                     && (bib_lex_year(span, &p0) || bib_lex_year_abv(span, &p0));
-    bool success = span_success && bib_advance_strbuf(parser, &p0);
+                     && (bib_token_lex_year(span, &p0) || bib_token_lex_year_abv(span, &p0));
+    bool success = span_success && bib_advance_tokbuf(parser, &p0);
     if (success) {
         date->isspan = true;
         date->separator = (dash_success) ? '-'
@@ -428,24 +744,24 @@ static bool bib_parse_date_span(bib_date_t *const date, bib_strbuf_t *const pars
     return success;
 }
 
-bool bib_parse_date(bib_date_t *const date, bib_strbuf_t *const parser)
+static bool bib_parse_date_tokens(bib_date_t *const date, bib_tokbuf_t *const parser)
 {
-    if (date == NULL || parser == NULL || parser->str == NULL || parser->len == 0) {
+    if (date == NULL || parser == NULL || parser->count == 0) {
         return false;
     }
 
-    bib_strbuf_t p0 = *parser;
-    bool year_success = bib_lex_year(date->year, &p0);
+    bib_tokbuf_t p0 = *parser;
+    bool year_success = bib_token_lex_year(date->year, &p0);
 
-    bib_strbuf_t p1 = (year_success) ? p0 : *parser;
+    bib_tokbuf_t p1 = (year_success) ? p0 : *parser;
     bool span_success = year_success && bib_parse_date_span(date, &p1);
     bool mnth_success = year_success && !span_success && bib_parse_date_date(date, &p1);
     bool midl_success = span_success || mnth_success;
 
-    bib_strbuf_t p2 = (midl_success) ? p1 : p0;
-    bool mark_success = year_success && !mnth_success && bib_lex_mark(date->mark, &p2);
+    bib_tokbuf_t p2 = (midl_success) ? p1 : p0;
+    bool mark_success = year_success && !mnth_success && bib_token_lex_mark(date->mark, &p2);
 
-    bool success = year_success & bib_advance_strbuf(parser, (mark_success) ? &p2
+    bool success = year_success & bib_advance_tokbuf(parser, (mark_success) ? &p2
                                                            : (midl_success) ? &p1
                                                            : (year_success) ? &p0
                                                            : NULL);
@@ -455,16 +771,16 @@ bool bib_parse_date(bib_date_t *const date, bib_strbuf_t *const parser)
     return success;
 }
 
-bool bib_parse_ordinal(bib_ordinal_t *ord, bib_lex_word_f lex_suffix, bib_strbuf_t *const parser)
+static bool bib_parse_ordinal_tokens(bib_ordinal_t *ord, bib_lex_word_f lex_suffix, bib_tokbuf_t *const parser)
 {
-    if (ord == NULL || lex_suffix == NULL || parser == NULL || parser->str == NULL || parser->len == 0) {
+    if (ord == NULL || lex_suffix == NULL || parser == NULL || parser->count == 0) {
         return false;
     }
 
-    bib_strbuf_t p = *parser;
-    bool success = bib_lex_digit16(ord->number, &p)
-                && lex_suffix(ord->suffix, &p)
-                && bib_advance_strbuf(parser, &p);
+    bib_tokbuf_t p = *parser;
+    bool success = bib_token_lex_digit16(ord->number, &p)
+                && bib_token_lex_ordinal_suffix(ord->suffix, lex_suffix, &p)
+                && bib_advance_tokbuf(parser, &p);
 
     if (!success) {
         memset(ord, 0, sizeof(bib_ordinal_t));
@@ -472,58 +788,43 @@ bool bib_parse_ordinal(bib_ordinal_t *ord, bib_lex_word_f lex_suffix, bib_strbuf
     return success;
 }
 
-bool bib_parse_cutter_ordinal(bib_ordinal_t *const ord, bib_strbuf_t *const parser)
+static bool bib_parse_volume_tokens(bib_volume_t *const vol, bib_tokbuf_t *const parser)
 {
-    return bib_parse_ordinal(ord, bib_lex_cutter_ordinal_suffix, parser);
-}
-
-bool bib_parse_caption_ordinal(bib_ordinal_t *const ord, bib_strbuf_t *const parser)
-{
-    return bib_parse_ordinal(ord, bib_lex_caption_ordinal_suffix, parser);
-}
-
-bool bib_parse_specification_ordinal(bib_ordinal_t *const ord, bib_strbuf_t *const parser)
-{
-    return bib_parse_ordinal(ord, bib_lex_specification_ordinal_suffix, parser);
-}
-
-bool bib_parse_volume(bib_volume_t *const vol, bib_strbuf_t *const parser)
-{
-    if (vol == NULL || parser == NULL || parser->str == NULL || parser->len == 0) {
+    if (vol == NULL || parser == NULL || parser->count == 0) {
         return false;
     }
 
-    bib_strbuf_t p = *parser;
-    bool prefix_success = bib_lex_volume_prefix(vol->prefix, &p);
-    bool __unused space = prefix_success && bib_read_space(&p);
-    bool number_success = prefix_success && bib_lex_digit16(vol->number, &p);
-    vol->hasetc = number_success && bib_read_etc(&p);
+    bib_tokbuf_t p = *parser;
+    bool prefix_success = bib_token_lex_volume_prefix(vol->prefix, &p);
+    bool __unused space = prefix_success && bib_token_read_space(&p);
+    bool number_success = prefix_success && bib_token_lex_digit16(vol->number, &p);
+    vol->hasetc = number_success && bib_token_read_etc(&p);
 
-    bool success = number_success && bib_advance_strbuf(parser, &p);
+    bool success = number_success && bib_advance_tokbuf(parser, &p);
     if (!success) {
         memset(vol, 0, sizeof(bib_volume_t));
     }
     return success;
 }
 
-bool bib_parse_supplement(bib_supplement_t *supl, bib_strbuf_t *parser)
+static bool bib_parse_supplement_tokens(bib_supplement_t *supl, bib_tokbuf_t *parser)
 {
-    if (supl == NULL || parser == NULL || parser->str == NULL || parser->len == 0) {
+    if (supl == NULL || parser == NULL || parser->count == 0) {
         return false;
     }
 
-    bib_strbuf_t p0 = *parser;
-    bool prefix_success = bib_lex_supplement_prefix(supl->prefix, &p0);
-    supl->isabbr = prefix_success && bib_read_point(&p0);
+    bib_tokbuf_t p0 = *parser;
+    bool prefix_success = bib_token_lex_supplement_prefix(supl->prefix, &p0);
+    supl->isabbr = prefix_success && bib_token_read_point(&p0);
 
-    bib_strbuf_t p1 = p0;
-    bool required_space = prefix_success && bib_read_space(&p1);
-    bool number_success = prefix_success && required_space && bib_lex_digit16(supl->number, &p1);
+    bib_tokbuf_t p1 = p0;
+    bool required_space = prefix_success && bib_token_read_space(&p1);
+    bool number_success = prefix_success && required_space && bib_token_lex_digit16(supl->number, &p1);
 
-    bib_strbuf_t p2 = p1;
-    supl->hasetc = number_success && bib_read_etc(&p2);
+    bib_tokbuf_t p2 = p1;
+    supl->hasetc = number_success && bib_token_read_etc(&p2);
 
-    bool success = number_success && bib_advance_strbuf(parser, (supl->hasetc)    ? &p2
+    bool success = number_success && bib_advance_tokbuf(parser, (supl->hasetc)    ? &p2
                                                               : (number_success) ? &p1
                                                               : (prefix_success) ? &p0
                                                               : NULL);
@@ -532,3 +833,459 @@ bool bib_parse_supplement(bib_supplement_t *supl, bib_strbuf_t *parser)
     }
     return success;
 }
+
+
+#pragma mark - incremental parse
+
+/// The position of an incremental parser within the call number grammar.
+typedef enum bib_lc_calln_step {
+    /// No characters have been read.
+    bib_lc_calln_step_start = 0,
+
+    /// Reading the subject class letters.
+    bib_lc_calln_step_class,
+
+    /// Reading whitespace after the subject class letters.
+    bib_lc_calln_step_class_space,
+
+    /// Reading the integer portion of the subject subclass.
+    bib_lc_calln_step_integer,
+
+    /// Read the point or comma after the subject subclass's integer. The count is set after a comma.
+    bib_lc_calln_step_subject_point,
+
+    /// Reading the decimal portion of the subject subclass.
+    bib_lc_calln_step_decimal,
+
+    /// Reading whitespace after the subject subclass.
+    bib_lc_calln_step_subject_space,
+
+    /// Reading the date or ordinal value in the caption section.
+    bib_lc_calln_step_caption,
+
+    /// Read the point preceding a cutter number. The count is the amount of consecutive points.
+    bib_lc_calln_step_cutter_point,
+
+    /// Read a cutter number's initial letter.
+    bib_lc_calln_step_cutter_initial,
+
+    /// Reading a cutter number's digits.
+    bib_lc_calln_step_cutter_number,
+
+    /// Read one letter after a cutter number, which begins either a mark or the next cutter number.
+    /// The count is zero when the letter begins a new cutter number.
+    bib_lc_calln_step_cutter_letter,
+
+    /// Reading a cutter number's mark.
+    bib_lc_calln_step_cutter_mark,
+
+    /// Reading whitespace after a cutter segment or the caption section.
+    bib_lc_calln_step_cutter_space,
+
+    /// Reading the date or ordinal value trailing a cutter number.
+    bib_lc_calln_step_cutter_dateord,
+
+    /// Read a point within a date or ordinal value, which may precede a cutter number.
+    bib_lc_calln_step_dateord_point,
+
+    /// Read a letter after whitespace, which begins either a cutter number or a specification segment.
+    bib_lc_calln_step_word_initial,
+
+    /// Reading the specification segments.
+    bib_lc_calln_step_specification
+} bib_lc_calln_step_t;
+
+/// The sections that an incremental parser reads tentatively after whitespace.
+typedef enum bib_lc_calln_tentative {
+    /// The section being read can't be a specification segment.
+    bib_lc_calln_tentative_none = 0,
+
+    /// Reading cutter numbers that may turn out to be a specification segment.
+    bib_lc_calln_tentative_cutter,
+
+    /// Reading a subject subclass that may turn out to be a specification segment.
+    bib_lc_calln_tentative_subclass
+} bib_lc_calln_tentative_t;
+
+/// The kinds of characters that can appear within date, ordinal, and specification values.
+static bib_lc_calln_completion_t const bib_lc_calln_completion_word = bib_lc_calln_completion_letter
+                                                                    | bib_lc_calln_completion_digit
+                                                                    | bib_lc_calln_completion_point
+                                                                    | bib_lc_calln_completion_space
+                                                                    | bib_lc_calln_completion_symbol;
+
+/// Get the kind of completion that the given character is.
+static bib_lc_calln_completion_t bib_lc_calln_completion_for_char(char const c)
+{
+    switch (bib_char_class(c)) {
+    case bib_char_class_digit: return bib_lc_calln_completion_digit;
+    case bib_char_class_upper: return bib_lc_calln_completion_letter;
+    case bib_char_class_lower: return bib_lc_calln_completion_letter;
+    case bib_char_class_space: return bib_lc_calln_completion_space;
+    case bib_char_class_point: return bib_lc_calln_completion_point;
+    case bib_char_class_stop:  return bib_lc_calln_completion_none;
+    case bib_char_class_null:  return bib_lc_calln_completion_none;
+    default:                   return bib_lc_calln_completion_symbol;
+    }
+}
+
+/// Get the uppercase form of an alphabetic character.
+static char bib_lc_calln_parse_upper(char const c)
+{
+    return (bib_char_class(c) == bib_char_class_lower) ? (char)(c - 'a' + 'A') : c;
+}
+
+/// Add a cutter number with the given initial letter to the partial call number.
+///
+/// Cutter numbers following a date or ordinal value are left out of the partial call number, because they're
+/// read as part of a specification segment when the date or ordinal value turns out to be invalid.
+static void bib_lc_calln_parse_begin_cutter(bib_lc_calln_parse_state_t *const state, char const c)
+{
+    if (!state->after_dateord) {
+        state->calln.cutters[state->cutters].cutter.letter = bib_lc_calln_parse_upper(c);
+    }
+    state->cutters += 1;
+    state->cutter_dateord = false;
+    state->count = 0;
+}
+
+/// Remove the most recent cutter number, whose initial letter turned out to begin a mark.
+static void bib_lc_calln_parse_cancel_cutter(bib_lc_calln_parse_state_t *const state)
+{
+    state->cutters -= 1;
+    memset(&(state->calln.cutters[state->cutters]), 0, sizeof(bib_cuttseg_t));
+}
+
+/// Append a digit to the partial call number's most recent cutter number.
+static void bib_lc_calln_parse_cutter_digit(bib_lc_calln_parse_state_t *const state, char const c)
+{
+    if (!state->after_dateord) {
+        state->calln.cutters[state->cutters - 1].cutter.number[state->count] = c;
+    }
+    state->count += 1;
+}
+
+/// Start reading a section that is read as a specification segment instead if it turns out to be invalid.
+static void bib_lc_calln_parse_begin_tentative(bib_lc_calln_parse_state_t *const state,
+                                               bib_lc_calln_tentative_t const tentative)
+{
+    state->tentative = tentative;
+    state->tentative_cutters = state->cutters;
+}
+
+/// Remove everything read within the current tentative section from the partial call number, and continue
+/// reading it as a specification segment.
+static void bib_lc_calln_parse_cancel_tentative(bib_lc_calln_parse_state_t *const state)
+{
+    if (state->tentative == bib_lc_calln_tentative_subclass) {
+        memset(state->calln.integer, 0, sizeof(bib_digit06_b));
+        memset(state->calln.decimal, 0, sizeof(bib_digit16_b));
+    }
+    while (state->cutters > state->tentative_cutters) {
+        bib_lc_calln_parse_cancel_cutter(state);
+    }
+    state->tentative = bib_lc_calln_tentative_none;
+    state->step = bib_lc_calln_step_specification;
+    state->component = bib_lc_calln_component_specification;
+}
+
+/// Get the kinds of characters that can follow the input without leaving the current section.
+static bib_lc_calln_completion_t bib_lc_calln_parse_step_completions(bib_lc_calln_parse_state_t const *const state)
+{
+    bib_lc_calln_completion_t const cutter_point = (state->cutters < 3) ? bib_lc_calln_completion_point
+                                                                        : bib_lc_calln_completion_none;
+    switch ((bib_lc_calln_step_t)state->step) {
+    case bib_lc_calln_step_start:
+        return bib_lc_calln_completion_letter;
+    case bib_lc_calln_step_class:
+        return bib_lc_calln_completion_letter | bib_lc_calln_completion_digit | bib_lc_calln_completion_point
+             | bib_lc_calln_completion_space  | bib_lc_calln_completion_end;
+    case bib_lc_calln_step_integer:
+        return ((state->count < sizeof(bib_digit06_b) - 1) ? bib_lc_calln_completion_digit
+                                                           : bib_lc_calln_completion_none)
+             | bib_lc_calln_completion_letter | bib_lc_calln_completion_point | bib_lc_calln_completion_symbol
+             | bib_lc_calln_completion_space  | bib_lc_calln_completion_end;
+    case bib_lc_calln_step_subject_point:
+        return (state->count == 0) ? bib_lc_calln_completion_digit | bib_lc_calln_completion_letter
+                                   | bib_lc_calln_completion_point | bib_lc_calln_completion_space
+                                   | bib_lc_calln_completion_end
+                                   : bib_lc_calln_completion_digit;
+    case bib_lc_calln_step_decimal:
+        return ((state->count < sizeof(bib_digit16_b) - 1) ? bib_lc_calln_completion_digit
+                                                           : bib_lc_calln_completion_none)
+             | bib_lc_calln_completion_letter | bib_lc_calln_completion_point
+             | bib_lc_calln_completion_space  | bib_lc_calln_completion_end;
+    case bib_lc_calln_step_cutter_point:
+        // the cutter section can begin with two points, or end with one when it contains no cutter numbers
+        return bib_lc_calln_completion_letter
+             | ((state->cutters == 0 && state->count == 1) ? bib_lc_calln_completion_point
+                                                           | bib_lc_calln_completion_space
+                                                           | bib_lc_calln_completion_end
+                                                           : bib_lc_calln_completion_none);
+    case bib_lc_calln_step_cutter_initial:
+    case bib_lc_calln_step_word_initial:
+        return bib_lc_calln_completion_digit | bib_lc_calln_completion_end;
+    case bib_lc_calln_step_cutter_number:
+        return ((state->count < sizeof(bib_digit16_b) - 1) ? bib_lc_calln_completion_digit
+                                                           : bib_lc_calln_completion_none)
+             | bib_lc_calln_completion_letter | cutter_point
+             | bib_lc_calln_completion_space  | bib_lc_calln_completion_end;
+    case bib_lc_calln_step_cutter_letter:
+        return bib_lc_calln_completion_letter
+             | ((state->count == 0) ? bib_lc_calln_completion_digit | bib_lc_calln_completion_end
+                                    : bib_lc_calln_completion_none);
+    case bib_lc_calln_step_cutter_mark:
+        return ((state->count < sizeof(bib_mark_b) - 1) ? bib_lc_calln_completion_letter
+                                                        : bib_lc_calln_completion_none)
+             | bib_lc_calln_completion_space | bib_lc_calln_completion_end;
+    case bib_lc_calln_step_class_space:
+    case bib_lc_calln_step_subject_space:
+    case bib_lc_calln_step_caption:
+    case bib_lc_calln_step_cutter_space:
+    case bib_lc_calln_step_cutter_dateord:
+    case bib_lc_calln_step_dateord_point:
+    case bib_lc_calln_step_specification:
+        return bib_lc_calln_completion_word;
+    }
+    return bib_lc_calln_completion_none;
+}
+
+void bib_lc_calln_parse_state_init(bib_lc_calln_parse_state_t *const state)
+{
+    if (state != NULL) {
+        memset(state, 0, sizeof(bib_lc_calln_parse_state_t));
+    }
+}
+
+bib_lc_calln_completion_t bib_lc_calln_parse_state_completions(bib_lc_calln_parse_state_t const *const state)
+{
+    if (state == NULL || state->length >= BIB_LC_CALLN_PARSE_STATE_MAX) {
+        return bib_lc_calln_completion_none;
+    }
+    bib_lc_calln_completion_t const completions = bib_lc_calln_parse_step_completions(state)
+                                                | ((state->tentative) ? bib_lc_calln_completion_word
+                                                                      : bib_lc_calln_completion_none);
+    return (state->after_dateord) ? completions & ~bib_lc_calln_completion_end : completions;
+}
+
+bool bib_lc_calln_parse_state_push(bib_lc_calln_parse_state_t *const state, char const c)
+{
+    if (state == NULL || state->length >= BIB_LC_CALLN_PARSE_STATE_MAX) {
+        return false;
+    }
+    bib_lc_calln_completion_t const kind = bib_lc_calln_completion_for_char(c);
+    bool const is_letter = (kind == bib_lc_calln_completion_letter);
+    bool const is_digit  = (kind == bib_lc_calln_completion_digit);
+    bool const is_point  = (kind == bib_lc_calln_completion_point);
+    bool const is_space  = (kind == bib_lc_calln_completion_space);
+    bool const can_add_cutter = (state->cutters < 3);
+
+    // only a comma can separate the integer and decimal portions of the subclass
+    bool const is_separator = (state->step != bib_lc_calln_step_integer) || (kind != bib_lc_calln_completion_symbol)
+                           || (bib_char_class(c) == bib_char_class_comma);
+    if ((kind & bib_lc_calln_parse_step_completions(state)) == 0 || !is_separator) {
+        if (!state->tentative || kind == bib_lc_calln_completion_none) {
+            return false;
+        }
+        bib_lc_calln_parse_cancel_tentative(state);
+    }
+
+    switch ((bib_lc_calln_step_t)state->step) {
+    case bib_lc_calln_step_start:
+    case bib_lc_calln_step_class:
+        if (is_letter && state->count < sizeof(bib_alpah03_b) - 1) {
+            state->calln.letters[state->count] = bib_lc_calln_parse_upper(c);
+            state->count += 1;
+            state->step = bib_lc_calln_step_class;
+            state->component = bib_lc_calln_component_class;
+        } else if (is_letter) {
+            bib_lc_calln_parse_begin_cutter(state, c);
+            state->step = bib_lc_calln_step_cutter_initial;
+            state->component = bib_lc_calln_component_cutter;
+        } else if (is_digit) {
+            state->calln.integer[0] = c;
+            state->count = 1;
+            state->step = bib_lc_calln_step_integer;
+            state->component = bib_lc_calln_component_integer;
+        } else if (is_point) {
+            state->count = 1;
+            state->step = bib_lc_calln_step_cutter_point;
+            state->component = bib_lc_calln_component_cutter;
+        } else {
+            state->step = bib_lc_calln_step_class_space;
+        }
+        break;
+    case bib_lc_calln_step_class_space:
+        if (is_digit) {
+            bib_lc_calln_parse_begin_tentative(state, bib_lc_calln_tentative_subclass);
+            state->calln.integer[0] = c;
+            state->count = 1;
+            state->step = bib_lc_calln_step_integer;
+            state->component = bib_lc_calln_component_integer;
+            break;
+        }
+        // fallthrough
+    case bib_lc_calln_step_subject_space:
+        if (is_digit) {
+            state->after_dateord = true;
+            state->step = bib_lc_calln_step_caption;
+            state->component = bib_lc_calln_component_caption;
+            break;
+        }
+        // fallthrough
+    case bib_lc_calln_step_cutter_space:
+        if (is_letter && can_add_cutter) {
+            bib_lc_calln_parse_begin_tentative(state, bib_lc_calln_tentative_cutter);
+            bib_lc_calln_parse_begin_cutter(state, c);
+            state->step = bib_lc_calln_step_word_initial;
+            state->component = bib_lc_calln_component_cutter;
+        } else if (is_point && can_add_cutter) {
+            bib_lc_calln_parse_begin_tentative(state, bib_lc_calln_tentative_cutter);
+            state->count = 1;
+            state->step = bib_lc_calln_step_cutter_point;
+            state->component = bib_lc_calln_component_cutter;
+        } else if (is_digit && !state->cutter_dateord) {
+            state->cutter_dateord = true;
+            state->after_dateord = true;
+            state->step = bib_lc_calln_step_cutter_dateord;
+            state->component = bib_lc_calln_component_cutter_dateord;
+        } else if (!is_space) {
+            state->step = bib_lc_calln_step_specification;
+            state->component = bib_lc_calln_component_specification;
+        }
+        break;
+    case bib_lc_calln_step_integer:
+        if (is_digit) {
+            state->calln.integer[state->count] = c;
+            state->count += 1;
+        } else if (is_letter) {
+            bib_lc_calln_parse_begin_cutter(state, c);
+            state->step = bib_lc_calln_step_cutter_initial;
+            state->component = bib_lc_calln_component_cutter;
+        } else if (is_space) {
+            state->tentative = bib_lc_calln_tentative_none;
+            state->step = bib_lc_calln_step_subject_space;
+        } else {
+            state->count = !is_point;
+            state->step = bib_lc_calln_step_subject_point;
+            state->component = bib_lc_calln_component_decimal;
+        }
+        break;
+    case bib_lc_calln_step_subject_point:
+        if (is_digit) {
+            state->calln.decimal[0] = c;
+            state->count = 1;
+            state->step = bib_lc_calln_step_decimal;
+            break;
+        }
+        state->component = bib_lc_calln_component_cutter;
+        // fallthrough
+    case bib_lc_calln_step_cutter_point:
+        if (is_letter) {
+            bib_lc_calln_parse_begin_cutter(state, c);
+            state->step = bib_lc_calln_step_cutter_initial;
+        } else if (is_point) {
+            state->count = 2;
+            state->step = bib_lc_calln_step_cutter_point;
+        } else {
+            // a cutter section without any cutter numbers can only be followed by specification segments
+            state->tentative = bib_lc_calln_tentative_none;
+            state->step = bib_lc_calln_step_specification;
+            state->component = bib_lc_calln_component_specification;
+        }
+        break;
+    case bib_lc_calln_step_decimal:
+        if (is_digit) {
+            state->calln.decimal[state->count] = c;
+            state->count += 1;
+        } else if (is_letter) {
+            bib_lc_calln_parse_begin_cutter(state, c);
+            state->step = bib_lc_calln_step_cutter_initial;
+            state->component = bib_lc_calln_component_cutter;
+        } else if (is_point) {
+            state->count = 1;
+            state->step = bib_lc_calln_step_cutter_point;
+            state->component = bib_lc_calln_component_cutter;
+        } else {
+            state->tentative = bib_lc_calln_tentative_none;
+            state->step = bib_lc_calln_step_subject_space;
+        }
+        break;
+    case bib_lc_calln_step_cutter_initial:
+    case bib_lc_calln_step_word_initial:
+        bib_lc_calln_parse_cutter_digit(state, c);
+        state->step = bib_lc_calln_step_cutter_number;
+        break;
+    case bib_lc_calln_step_cutter_number:
+        if (is_digit) {
+            bib_lc_calln_parse_cutter_digit(state, c);
+        } else if (is_letter && can_add_cutter) {
+            bib_lc_calln_parse_begin_cutter(state, c);
+            state->step = bib_lc_calln_step_cutter_letter;
+        } else if (is_letter) {
+            state->step = bib_lc_calln_step_cutter_letter;
+        } else if (is_point) {
+            state->count = 1;
+            state->step = bib_lc_calln_step_cutter_point;
+        } else {
+            state->tentative = bib_lc_calln_tentative_none;
+            state->step = bib_lc_calln_step_cutter_space;
+        }
+        break;
+    case bib_lc_calln_step_cutter_letter:
+        if (is_digit) {
+            bib_lc_calln_parse_cutter_digit(state, c);
+            state->step = bib_lc_calln_step_cutter_number;
+        } else {
+            if (state->count == 0) {
+                bib_lc_calln_parse_cancel_cutter(state);
+            }
+            state->count = 2;
+            state->step = bib_lc_calln_step_cutter_mark;
+            state->component = bib_lc_calln_component_cutter_mark;
+        }
+        break;
+    case bib_lc_calln_step_cutter_mark:
+        if (is_letter) {
+            state->count += 1;
+        } else {
+            state->tentative = bib_lc_calln_tentative_none;
+            state->step = bib_lc_calln_step_cutter_space;
+        }
+        break;
+    case bib_lc_calln_step_caption:
+    case bib_lc_calln_step_cutter_dateord:
+        if (is_point) {
+            state->step = bib_lc_calln_step_dateord_point;
+        } else if (is_space) {
+            state->cutter_dateord = true;
+            state->step = bib_lc_calln_step_cutter_space;
+        }
+        break;
+    case bib_lc_calln_step_dateord_point:
+        if (is_letter && can_add_cutter) {
+            bib_lc_calln_parse_begin_tentative(state, bib_lc_calln_tentative_cutter);
+            bib_lc_calln_parse_begin_cutter(state, c);
+            state->step = bib_lc_calln_step_word_initial;
+            state->component = bib_lc_calln_component_cutter;
+        } else if (is_space) {
+            state->cutter_dateord = true;
+            state->step = bib_lc_calln_step_cutter_space;
+        } else if (!is_point) {
+            state->step = (state->component == bib_lc_calln_component_caption) ? bib_lc_calln_step_caption
+                                                                               : bib_lc_calln_step_cutter_dateord;
+        }
+        break;
+    case bib_lc_calln_step_specification:
+        break;
+    }
+    state->input[state->length] = c;
+    state->length += 1;
+    state->input[state->length] = '\0';
+    return true;
+}
+
+bool bib_lc_calln_parse_state_finish(bib_lc_calln_parse_state_t const *const state, bib_lc_calln_t *const calln)
+{
+    return state != NULL && bib_lc_calln_init(calln, state->input);
+}
@@ -23,6 +23,155 @@ __BEGIN_DECLS
 /// - postcondition: `calln` is set to a data structure representing the call number when parsing is successful.
 extern bool bib_parse_lc_calln(bib_lc_calln_t *calln, bib_strbuf_t *parser);
 
+/// Read a Library of Congress call number from the given input stream.
+/// - parameter calln: Allocated space for a structure representing the parsed call number.
+/// - parameter arena: The arena providing storage for the call number's remaining specification segments,
+///                    or `NULL` to allocate them on the heap.
+/// - parameter parser: Pointer to a string buffer object to parse from.
+/// - returns: `true` when a Library of Congress call number is successfully read from the input stream.
+/// - postcondition: `calln` is set to a data structure representing the call number when parsing is successful.
+extern bool bib_parse_lc_calln_arena(bib_lc_calln_t *calln, bib_lc_specification_arena_t *arena,
+                                     bib_strbuf_t *parser);
+
+#pragma mark - incremental parse
+
+/// The section of a Library of Congress call number that an incremental parser is reading.
+typedef enum bib_lc_calln_component {
+    /// No characters have been read.
+    bib_lc_calln_component_none = 0,
+
+    /// The subject class letters, such as `QA` in `QA76.76`.
+    bib_lc_calln_component_class,
+
+    /// The integer portion of the subject subclass, such as `76` in `QA76.76`.
+    bib_lc_calln_component_integer,
+
+    /// The decimal portion of the subject subclass, such as `.76` in `QA76.76`.
+    bib_lc_calln_component_decimal,
+
+    /// The date or ordinal value in the caption section, such as `1988` in `DR1879.5 1988`.
+    bib_lc_calln_component_caption,
+
+    /// A cutter number, such as `.C65` in `QA76.76.C65`.
+    bib_lc_calln_component_cutter,
+
+    /// The alphabetic mark attached to a cutter number, such as `a` in `QL737.C2C37a`.
+    bib_lc_calln_component_cutter_mark,
+
+    /// The date or ordinal value trailing a cutter number, such as `1986` in `QA76.76.C65 A37 1986`.
+    bib_lc_calln_component_cutter_dateord,
+
+    /// A specification segment following the cutter numbers, such as `vol. 1`.
+    bib_lc_calln_component_specification
+} bib_lc_calln_component_t;
+
+/// The kinds of characters that can follow the input read by an incremental parser.
+typedef enum bib_lc_calln_completion {
+    bib_lc_calln_completion_none   = 0,
+
+    /// An uppercase or lowercase ASCII latin alphabet character.
+    bib_lc_calln_completion_letter = 1 << 0,
+
+    /// A number from `0` to `9`.
+    bib_lc_calln_completion_digit  = 1 << 1,
+
+    /// Period character `'.'`.
+    bib_lc_calln_completion_point  = 1 << 2,
+
+    /// A whitespace character.
+    bib_lc_calln_completion_space  = 1 << 3,
+
+    /// Any other printable character, such as a comma, dash, or slash.
+    bib_lc_calln_completion_symbol = 1 << 4,
+
+    /// The end of the input.
+    ///
+    /// This is only reported when the input is known to be a complete call number without backtracking,
+    /// which is the case within the subject and cutter sections before any date or ordinal value. Any other
+    /// input can only be confirmed with `bib_lc_calln_parse_state_finish()`.
+    bib_lc_calln_completion_end    = 1 << 5
+} bib_lc_calln_completion_t;
+
+/// The largest amount of characters that an incremental parser can read.
+#define BIB_LC_CALLN_PARSE_STATE_MAX 255
+
+/// An incremental Library of Congress call number parser, which reads its input one character at a time.
+///
+/// Each character is read in constant time, regardless of how much input came before it, which makes the parser
+/// suitable for validating call numbers as they're typed. The subject and cutter sections are parsed as they're
+/// read into `calln`, so that the partial call number can be used as a bound in a range query. Date, ordinal, and
+/// specification values, which can't be parsed without backtracking, are only checked for the kinds of characters
+/// they contain until the input is finished with `bib_lc_calln_parse_state_finish()`.
+///
+/// The parser owns no heap storage, so it can be copied freely. Keep a copy of the state before each character to
+/// support deleting characters from the end of the input.
+typedef struct bib_lc_calln_parse_state {
+    /// The subject class and cutter numbers read so far, up to the first date or ordinal value.
+    ///
+    /// The date, ordinal, and specification fields are always empty, and the cutter marks are left out.
+    bib_lc_calln_t calln;
+
+    /// The characters read so far, terminated by a null character.
+    char input[BIB_LC_CALLN_PARSE_STATE_MAX + 1];
+
+    /// The amount of characters read so far.
+    size_t length;
+
+    /// The section of the call number containing the most recently read character.
+    bib_lc_calln_component_t component;
+
+    /// Private parser state.
+    unsigned char step;
+
+    /// Private parser state, counting the characters in the current run of letters or digits.
+    unsigned char count;
+
+    /// Private parser state, counting the cutter numbers read so far.
+    unsigned char cutters;
+
+    /// Private parser state, counting the cutter numbers read before the current tentative section.
+    unsigned char tentative_cutters;
+
+    /// Private parser state, set while reading a section that is read as a specification segment instead if it
+    /// turns out to be invalid.
+    unsigned char tentative;
+
+    /// Private parser state, set after the date or ordinal value within the current cutter segment.
+    bool cutter_dateord;
+
+    /// Private parser state, set after reading a date or ordinal value, whose end can't be found without
+    /// backtracking.
+    bool after_dateord;
+} bib_lc_calln_parse_state_t;
+
+/// Prepare an incremental parser for reading a new call number.
+/// - parameter state: The parser to reset.
+/// - postcondition: `state` has read no characters.
+extern void bib_lc_calln_parse_state_init(bib_lc_calln_parse_state_t *state);
+
+/// Read the next character of a call number.
+/// - parameter state: The parser reading the call number.
+/// - parameter c: The next character in the call number.
+/// - returns: `true` when the input can still be completed as a valid call number.
+///            `false` when the character can't appear at this position, in which case `state` is unchanged.
+extern bool bib_lc_calln_parse_state_push(bib_lc_calln_parse_state_t *state, char c);
+
+/// Get the kinds of characters that can follow the input read so far.
+/// - parameter state: The parser reading the call number.
+/// - returns: A bitmask of `bib_lc_calln_completion_t` values. Characters whose kind isn't in the returned set
+///            are rejected by `bib_lc_calln_parse_state_push()`.
+extern bib_lc_calln_completion_t bib_lc_calln_parse_state_completions(bib_lc_calln_parse_state_t const *state);
+
+/// Parse the complete input read by an incremental parser.
+/// - parameter state: The parser reading the call number.
+/// - parameter calln: Allocated space for a structure representing the parsed call number.
+/// - returns: `true` when the input read so far is a valid call number.
+/// - postcondition: `calln` is set to a data structure representing the call number when parsing is successful,
+///                  and must be deinitialized with `bib_lc_calln_deinit()`.
+///
+/// Unlike reading characters, this parses the entire input, and should only be done once the input is complete.
+extern bool bib_lc_calln_parse_state_finish(bib_lc_calln_parse_state_t const *state, bib_lc_calln_t *calln);
+
 #pragma mark - parse lc components
 
 /// Read the subject matter for a Library of Congress call number from the given input stream.
@@ -7,3 +7,660 @@
 //
 
 #include "bibtokenizer.h"
+#include <ctype.h>
+#include <string.h>
+
+/// The presence of this macro causes lowercase letters in the subject and cutters to
+/// autocorrect to their uppercase value instead of failing the lex/parse.
+#define BIB_LEX_AUTO_UPPERCASE
+
+#pragma mark - character classes
+
+#define BIB_CC_DIGIT bib_char_class_digit
+#define BIB_CC_UPPER bib_char_class_upper
+#define BIB_CC_LOWER bib_char_class_lower
+
+unsigned char const bib_char_classes[256] = {
+    [0x00] = bib_char_class_null,
+    [0x03] = bib_char_class_stop,
+    [0x1C] = bib_char_class_stop, [0x1D] = bib_char_class_stop,
+    [0x1E] = bib_char_class_stop, [0x1F] = bib_char_class_stop,
+    [0xFF] = bib_char_class_stop, // EOF when `char` is signed
+
+    ['\t'] = bib_char_class_space, ['\n'] = bib_char_class_space, ['\v'] = bib_char_class_space,
+    ['\f'] = bib_char_class_space, ['\r'] = bib_char_class_space, [' ']  = bib_char_class_space,
+
+    ['.'] = bib_char_class_point,
+    [','] = bib_char_class_comma,
+    ['-'] = bib_char_class_dash,
+    ['/'] = bib_char_class_slash,
+
+    ['0'] = BIB_CC_DIGIT, ['1'] = BIB_CC_DIGIT, ['2'] = BIB_CC_DIGIT, ['3'] = BIB_CC_DIGIT, ['4'] = BIB_CC_DIGIT,
+    ['5'] = BIB_CC_DIGIT, ['6'] = BIB_CC_DIGIT, ['7'] = BIB_CC_DIGIT, ['8'] = BIB_CC_DIGIT, ['9'] = BIB_CC_DIGIT,
+
+    ['A'] = BIB_CC_UPPER, ['B'] = BIB_CC_UPPER, ['C'] = BIB_CC_UPPER, ['D'] = BIB_CC_UPPER, ['E'] = BIB_CC_UPPER,
+    ['F'] = BIB_CC_UPPER, ['G'] = BIB_CC_UPPER, ['H'] = BIB_CC_UPPER, ['I'] = BIB_CC_UPPER, ['J'] = BIB_CC_UPPER,
+    ['K'] = BIB_CC_UPPER, ['L'] = BIB_CC_UPPER, ['M'] = BIB_CC_UPPER, ['N'] = BIB_CC_UPPER, ['O'] = BIB_CC_UPPER,
+    ['P'] = BIB_CC_UPPER, ['Q'] = BIB_CC_UPPER, ['R'] = BIB_CC_UPPER, ['S'] = BIB_CC_UPPER, ['T'] = BIB_CC_UPPER,
+    ['U'] = BIB_CC_UPPER, ['V'] = BIB_CC_UPPER, ['W'] = BIB_CC_UPPER, ['X'] = BIB_CC_UPPER, ['Y'] = BIB_CC_UPPER,
+    ['Z'] = BIB_CC_UPPER,
+
+    ['a'] = BIB_CC_LOWER, ['b'] = BIB_CC_LOWER, ['c'] = BIB_CC_LOWER, ['d'] = BIB_CC_LOWER, ['e'] = BIB_CC_LOWER,
+    ['f'] = BIB_CC_LOWER, ['g'] = BIB_CC_LOWER, ['h'] = BIB_CC_LOWER, ['i'] = BIB_CC_LOWER, ['j'] = BIB_CC_LOWER,
+    ['k'] = BIB_CC_LOWER, ['l'] = BIB_CC_LOWER, ['m'] = BIB_CC_LOWER, ['n'] = BIB_CC_LOWER, ['o'] = BIB_CC_LOWER,
+    ['p'] = BIB_CC_LOWER, ['q'] = BIB_CC_LOWER, ['r'] = BIB_CC_LOWER, ['s'] = BIB_CC_LOWER, ['t'] = BIB_CC_LOWER,
+    ['u'] = BIB_CC_LOWER, ['v'] = BIB_CC_LOWER, ['w'] = BIB_CC_LOWER, ['x'] = BIB_CC_LOWER, ['y'] = BIB_CC_LOWER,
+    ['z'] = BIB_CC_LOWER,
+};
+
+#undef BIB_CC_DIGIT
+#undef BIB_CC_UPPER
+#undef BIB_CC_LOWER
+
+/// The kind of token started by each character class.
+static bib_token_kind_t const bib_token_kinds[] = {
+    [bib_char_class_symbol] = bib_token_kind_symbol,
+    [bib_char_class_digit]  = bib_token_kind_digits,
+    [bib_char_class_upper]  = bib_token_kind_letters,
+    [bib_char_class_lower]  = bib_token_kind_letters,
+    [bib_char_class_space]  = bib_token_kind_space,
+    [bib_char_class_point]  = bib_token_kind_point,
+    [bib_char_class_comma]  = bib_token_kind_comma,
+    [bib_char_class_dash]   = bib_token_kind_dash,
+    [bib_char_class_slash]  = bib_token_kind_slash,
+    [bib_char_class_stop]   = bib_token_kind_stop,
+    [bib_char_class_null]   = bib_token_kind_stop
+};
+
+#pragma mark - tokens
+
+size_t bib_tokenize(bib_token_t *const tokens, size_t const capacity, char const *const str, size_t const len)
+{
+    if (str == NULL) {
+        return 0;
+    }
+    size_t count = 0;
+    size_t index = 0;
+    while (index < len) {
+        bib_char_class_t const cls = bib_char_class(str[index]);
+        bib_token_kind_t const kind = bib_token_kinds[cls];
+        size_t end = index + 1;
+        switch (kind) {
+            case bib_token_kind_digits:
+            case bib_token_kind_space:
+                while (end < len && bib_char_class(str[end]) == cls) {
+                    end += 1;
+                }
+                break;
+            case bib_token_kind_letters:
+                while (end < len && bib_token_kinds[bib_char_class(str[end])] == bib_token_kind_letters) {
+                    end += 1;
+                }
+                break;
+            default:
+                break;
+        }
+        if (tokens != NULL && count < capacity) {
+            tokens[count] = (bib_token_t){ .kind = kind, .str = &(str[index]), .len = end - index };
+        }
+        count += 1;
+        index = end;
+        if (cls == bib_char_class_null) {
+            break;
+        }
+    }
+    return count;
+}
+
+bool bib_token_list_init(bib_token_list_t *const list, char const *const str, size_t const len)
+{
+    if (list == NULL || str == NULL) {
+        return false;
+    }
+    list->buffer = list->storage;
+    list->length = bib_tokenize(list->storage, BIB_TOKEN_LIST_INLINE_CAPACITY, str, len);
+    if (list->length > BIB_TOKEN_LIST_INLINE_CAPACITY) {
+        list->buffer = malloc(list->length * sizeof(bib_token_t));
+        if (list->buffer == NULL) {
+            list->length = 0;
+            return false;
+        }
+        size_t __unused _ = bib_tokenize(list->buffer, list->length, str, len);
+    }
+    return true;
+}
+
+void bib_token_list_deinit(bib_token_list_t *const list)
+{
+    if (list == NULL) { return; }
+    if (list->buffer != list->storage) {
+        free(list->buffer);
+    }
+    list->buffer = NULL;
+    list->length = 0;
+}
+
+#pragma mark - token buffer
+
+bib_tokbuf_t bib_tokbuf(bib_token_list_t const *const list)
+{
+    return (bib_tokbuf_t){
+        .tok = (list == NULL) ? NULL : list->buffer,
+        .count = (list == NULL) ? 0 : list->length,
+        .pos = 0,
+        .offset = 0
+    };
+}
+
+/// Consume characters from the current token.
+/// - precondition: `len` is not larger than the amount of unread characters in the current token.
+static inline void bib_tokbuf_step(bib_tokbuf_t *const tokbuf, size_t const len)
+{
+    tokbuf->pos += len;
+    tokbuf->offset += len;
+    if (tokbuf->pos >= tokbuf->tok->len) {
+        tokbuf->tok += 1;
+        tokbuf->count -= 1;
+        tokbuf->pos = 0;
+    }
+}
+
+/// The amount of unread characters in the current token.
+static inline size_t bib_tokbuf_avail(bib_tokbuf_t const *const tokbuf)
+{
+    return (tokbuf->count == 0) ? 0 : tokbuf->tok->len - tokbuf->pos;
+}
+
+/// Pointer to the next unread character in the current token.
+static inline char const *bib_tokbuf_str(bib_tokbuf_t const *const tokbuf)
+{
+    return &(tokbuf->tok->str[tokbuf->pos]);
+}
+
+/// Does the next unread character belong to a token of the given kind?
+static inline bool bib_tokbuf_is(bib_tokbuf_t const *const tokbuf, bib_token_kind_t const kind)
+{
+    return (tokbuf->count > 0) && (tokbuf->tok->kind == kind);
+}
+
+bool bib_advance_tokbuf(bib_tokbuf_t *const tokbuf, bib_tokbuf_t const *const update)
+{
+    if (tokbuf == NULL || update == NULL || tokbuf->count == 0 || update->offset <= tokbuf->offset) {
+        return false;
+    }
+    *tokbuf = *update;
+    return true;
+}
+
+bool bib_tokbuf_skip(bib_tokbuf_t *const tokbuf, size_t len)
+{
+    if (tokbuf == NULL) {
+        return false;
+    }
+    bib_tokbuf_t t = *tokbuf;
+    while (len > 0 && t.count > 0) {
+        size_t const avail = bib_tokbuf_avail(&t);
+        size_t const step = (len < avail) ? len : avail;
+        bib_tokbuf_step(&t, step);
+        len -= step;
+    }
+    return (len == 0) && bib_advance_tokbuf(tokbuf, &t);
+}
+
+bib_strbuf_t bib_tokbuf_strbuf(bib_tokbuf_t const *const tokbuf)
+{
+    if (tokbuf == NULL || tokbuf->count == 0) {
+        return (bib_strbuf_t){ .str = NULL, .len = 0 };
+    }
+    bib_token_t const *const last = &(tokbuf->tok[tokbuf->count - 1]);
+    char const *const str = bib_tokbuf_str(tokbuf);
+    return (bib_strbuf_t){ .str = str, .len = (size_t)(&(last->str[last->len]) - str) };
+}
+
+#pragma mark - lex primitives
+
+size_t bib_token_lex_digit_n(char *const buffer, size_t const buffer_len, bib_tokbuf_t *const lexer)
+{
+    if (buffer == NULL || buffer_len < 1 || lexer == NULL) {
+        return 0;
+    }
+    if (!bib_tokbuf_is(lexer, bib_token_kind_digits) || buffer_len == 1) {
+        memset(buffer, 0, buffer_len);
+        return 0;
+    }
+    size_t const avail = bib_tokbuf_avail(lexer);
+    size_t const length = (avail < buffer_len - 1) ? avail : buffer_len - 1;
+    memcpy(buffer, bib_tokbuf_str(lexer), length);
+    buffer[length] = '\0';
+    bib_tokbuf_step(lexer, length);
+    return length;
+}
+
+/// Read up to `buffer_len-1` alphabetic characters from the token stream into the given buffer.
+static size_t bib_token_lex_alpha_n(char *const buffer, size_t const buffer_len, bib_tokbuf_t *const lexer)
+{
+    if (buffer == NULL || buffer_len < 1 || lexer == NULL) {
+        return 0;
+    }
+    if (!bib_tokbuf_is(lexer, bib_token_kind_letters) || buffer_len == 1) {
+        memset(buffer, 0, buffer_len);
+        return 0;
+    }
+    size_t const avail = bib_tokbuf_avail(lexer);
+    size_t const length = (avail < buffer_len - 1) ? avail : buffer_len - 1;
+    memcpy(buffer, bib_tokbuf_str(lexer), length);
+    buffer[length] = '\0';
+    bib_tokbuf_step(lexer, length);
+    return length;
+}
+
+/// Read up to `buffer_len-1` lowercase alphabetic characters from the token stream into the given buffer.
+static size_t bib_token_lex_lower_n(char *const buffer, size_t const buffer_len, bib_tokbuf_t *const lexer)
+{
+    if (buffer == NULL || buffer_len < 1 || lexer == NULL) {
+        return 0;
+    }
+    size_t length = 0;
+    if (bib_tokbuf_is(lexer, bib_token_kind_letters)) {
+        size_t const avail = bib_tokbuf_avail(lexer);
+        char const *const str = bib_tokbuf_str(lexer);
+        while (length < avail && length < buffer_len - 1 && bib_char_class(str[length]) == bib_char_class_lower) {
+            buffer[length] = str[length];
+            length += 1;
+        }
+    }
+    if (length == 0) {
+        memset(buffer, 0, buffer_len);
+        return 0;
+    }
+    buffer[length] = '\0';
+    bib_tokbuf_step(lexer, length);
+    return length;
+}
+
+#pragma mark - lex
+
+bool bib_token_lex_integer(bib_digit06_b buffer, bib_tokbuf_t *const lexer)
+{
+    if (buffer == NULL || lexer == NULL || lexer->count == 0) {
+        return false;
+    }
+    return bib_token_lex_digit_n(buffer, sizeof(bib_digit06_b), lexer) > 0;
+}
+
+bool bib_token_lex_digit16(bib_digit16_b buffer, bib_tokbuf_t *const lexer)
+{
+    if (buffer == NULL || lexer == NULL || lexer->count == 0) {
+        return false;
+    }
+    return bib_token_lex_digit_n(buffer, sizeof(bib_digit16_b), lexer) > 0;
+}
+
+bool bib_token_lex_decimal(bib_digit16_b buffer, bib_tokbuf_t *const lexer)
+{
+    if (buffer == NULL || lexer == NULL || lexer->count == 0) {
+        return false;
+    }
+    bib_tokbuf_t l = *lexer;
+    // The use of commas instead of periods is a common mistake in the official
+    // Library of Congress Classification schedule, so we'll allow it.
+    bool success = (bib_token_read_point(&l) || bib_token_read_comma(&l))
+                && bib_token_lex_digit16(buffer, &l)
+                && bib_advance_tokbuf(lexer, &l);
+    if (!success) {
+        memset(buffer, 0, sizeof(bib_digit16_b));
+    }
+    return success;
+}
+
+bool bib_token_lex_year(bib_year_b buffer, bib_tokbuf_t *const lexer)
+{
+    if (buffer == NULL || lexer == NULL || lexer->count == 0) {
+        return false;
+    }
+    bib_tokbuf_t l = *lexer;
+    size_t length = bib_token_lex_digit_n(buffer, sizeof(bib_year_b), &l);
+    bool success = (length == 4) && bib_advance_tokbuf(lexer, &l);
+    if (!success) {
+        memset(buffer, 0, sizeof(bib_year_b));
+    }
+    return success;
+}
+
+bool bib_token_lex_year_abv(bib_year_b buffer, bib_tokbuf_t *const lexer)
+{
+    if (buffer == NULL || lexer == NULL || lexer->count == 0) {
+        return false;
+    }
+    bib_tokbuf_t l = *lexer;
+    size_t length = bib_token_lex_digit_n(buffer, sizeof(char) * 3, &l);
+    bool success = (length == 2) && bib_advance_tokbuf(lexer, &l);
+    if (!success) {
+        memset(buffer, 0, sizeof(bib_year_b));
+    }
+    return success;
+}
+
+bool bib_token_lex_mark(bib_mark_b buffer, bib_tokbuf_t *const lexer)
+{
+    if (buffer == NULL || lexer == NULL || lexer->count == 0) {
+        return false;
+    }
+    bib_tokbuf_t l0 = *lexer;
+    bool alpha_success = bib_token_lex_alpha_n(buffer, sizeof(bib_mark_b), &l0);
+
+    bool break_success = alpha_success && bib_token_peek_break(&l0);
+
+    bool success = alpha_success && break_success && bib_advance_tokbuf(lexer, &l0);
+    if (!success) {
+        memset(buffer, 0, sizeof(bib_mark_b));
+    }
+    return success;
+}
+
+bool bib_token_lex_subclass(bib_alpah03_b buffer, bib_tokbuf_t *const lexer)
+{
+    if (buffer == NULL || lexer == NULL || lexer->count == 0) {
+        return false;
+    }
+    bib_tokbuf_t l = *lexer;
+
+    size_t length = 0;
+    static size_t const max_length = sizeof(bib_alpah03_b) - sizeof(char);
+    if (bib_tokbuf_is(&l, bib_token_kind_letters)) {
+        size_t const avail = bib_tokbuf_avail(&l);
+        char const *const str = bib_tokbuf_str(&l);
+        while ((length < max_length) && (length < avail)) {
+            char const current_char = str[length];
+            if (bib_char_class(current_char) == bib_char_class_upper) {
+                buffer[length] = current_char;
+#ifdef BIB_LEX_AUTO_UPPERCASE
+            } else if (bib_char_class(current_char) == bib_char_class_lower) {
+                buffer[length] = toupper(current_char);
+#endif
+            } else {
+                break;
+            }
+            length += 1;
+        }
+    }
+    buffer[length] = '\0';
+    if (length > 0) {
+        bib_tokbuf_step(&l, length);
+    }
+    bool success = (length > 0) && bib_advance_tokbuf(lexer, &l);
+    if (!success) {
+        memset(buffer, 0, sizeof(bib_alpah03_b));
+    }
+    return success;
+}
+
+bool bib_token_lex_initial(bib_initial_t *initial, bib_tokbuf_t *const lexer)
+{
+    if (initial == NULL) {
+        return false;
+    }
+
+#ifdef BIB_LEX_AUTO_UPPERCASE
+    bool success = bib_token_read_char(initial, bib_char_class_upper, lexer)
+                || bib_token_read_char(initial, bib_char_class_lower, lexer);
+    if (success) {
+        *initial = toupper(*initial);
+    }
+    return success;
+#else
+    return bib_token_read_char(initial, bib_char_class_upper, lexer);
+#endif
+}
+
+bool bib_token_lex_cutter_ordinal_suffix(bib_word_b buffer, bib_tokbuf_t *const lexer)
+{
+    if (buffer == NULL || lexer == NULL || lexer->count == 0) {
+        return false;
+    }
+
+    bib_tokbuf_t l0 = *lexer;
+    size_t alphalen = bib_token_lex_alpha_n(buffer, sizeof(bib_word_b), &l0);
+    bool alpha_success = (alphalen > 0);
+    bool break_success = alpha_success && bib_token_peek_break(&l0);
+
+    bool success = break_success && bib_advance_tokbuf(lexer, &l0);
+    if (!success) {
+        memset(buffer, 0, sizeof(bib_word_b));
+    }
+    return success;
+}
+
+bool bib_token_lex_caption_ordinal_suffix(bib_word_b buffer, bib_tokbuf_t *const lexer)
+{
+    if (buffer == NULL || lexer == NULL || lexer->count == 0) {
+        return false;
+    }
+
+    bib_tokbuf_t l0 = *lexer;
+    size_t alphalen = bib_token_lex_alpha_n(buffer, sizeof(bib_word_b), &l0);
+    bool alpha_success = (alphalen > 0);
+
+    // the suffix is followed by whitespace, a period, or the end of the input
+    bool follow_success = alpha_success && (bib_tokbuf_is(&l0, bib_token_kind_space)
+                                         || bib_tokbuf_is(&l0, bib_token_kind_point)
+                                         || bib_token_peek_break(&l0));
+
+    bool success = follow_success && bib_advance_tokbuf(lexer, &l0);
+    if (!success) {
+        memset(buffer, 0, sizeof(bib_word_b));
+    }
+    return success;
+}
+
+bool bib_token_lex_specification_ordinal_suffix(bib_word_b buffer, bib_tokbuf_t *const lexer)
+{
+    if (buffer == NULL || lexer == NULL || lexer->count == 0) {
+        return false;
+    }
+
+    bib_tokbuf_t l0 = *lexer;
+    memset(buffer, 0, sizeof(bib_word_b));
+
+    size_t outlen = bib_token_lex_alpha_n(buffer, sizeof(bib_word_b), &l0);
+    bool success = (outlen > 0);
+
+    // alternate between periods and letters until a period is followed by a word break
+    bool needs_point = true;
+    while ((l0.count > 0) && (outlen < sizeof(bib_word_b) - 1) && success) {
+        bib_tokbuf_t l1 = l0;
+        if (!needs_point && bib_token_read_space(&l1)) {
+            l0 = l1;
+            break;
+        }
+        if (!bib_token_read_point(&l1)) {
+            success = false;
+            break;
+        }
+        buffer[outlen] = '.';
+        outlen += 1;
+
+        size_t alphalen = bib_token_lex_alpha_n(&(buffer[outlen]), sizeof(bib_word_b) - outlen, &l1);
+        if (alphalen > 0) {
+            needs_point = true;
+            outlen += alphalen;
+            l0 = l1;
+        } else {
+            // trailing word-break required
+            success = bib_token_peek_break(&l1);
+            if (success) {
+                l0 = l1;
+            }
+            break;
+        }
+    }
+
+    bool final_success = success && bib_advance_tokbuf(lexer, &l0);
+    if (!final_success) {
+        memset(buffer, 0, sizeof(bib_word_b));
+    }
+    return final_success;
+}
+
+bool bib_token_lex_ordinal_suffix(bib_word_b buffer, bib_lex_word_f const lex_suffix, bib_tokbuf_t *const lexer)
+{
+    if (lex_suffix == bib_lex_cutter_ordinal_suffix) {
+        return bib_token_lex_cutter_ordinal_suffix(buffer, lexer);
+    } else if (lex_suffix == bib_lex_caption_ordinal_suffix) {
+        return bib_token_lex_caption_ordinal_suffix(buffer, lexer);
+    } else if (lex_suffix == bib_lex_specification_ordinal_suffix) {
+        return bib_token_lex_specification_ordinal_suffix(buffer, lexer);
+    }
+    if (buffer == NULL || lex_suffix == NULL || lexer == NULL || lexer->count == 0) {
+        return false;
+    }
+    bib_strbuf_t l = bib_tokbuf_strbuf(lexer);
+    size_t const len = l.len;
+    return lex_suffix(buffer, &l) && bib_tokbuf_skip(lexer, len - l.len);
+}
+
+bool bib_token_lex_volume_prefix(bib_word_b buffer, bib_tokbuf_t *const lexer)
+{
+    if (buffer == NULL || lexer == NULL || lexer->count == 0) {
+        return false;
+    }
+
+    bib_tokbuf_t l0 = *lexer;
+    size_t alphalen = bib_token_lex_lower_n(buffer, sizeof(bib_word_b), &l0);
+    bool alpha_success = (alphalen > 0);
+    bool point_success = alpha_success && bib_token_read_point(&l0);
+
+    bool success = point_success && bib_advance_tokbuf(lexer, &l0);
+    if (!success) {
+        memset(buffer, 0, sizeof(bib_word_b));
+    }
+    return success;
+}
+
+bool bib_token_lex_supplement_prefix(bib_word_b buffer, bib_tokbuf_t *const lexer)
+{
+    if (buffer == NULL || lexer == NULL || lexer->count == 0) {
+        return false;
+    }
+    bib_tokbuf_t l0 = *lexer;
+    bool success = bib_token_read_char(buffer, bib_char_class_upper, &l0);
+    if (success) {
+        size_t __unused _ = bib_token_lex_lower_n(&(buffer[1]), sizeof(bib_word_b) - 1, &l0);
+    }
+    success = success && bib_advance_tokbuf(lexer, &l0);
+    if (!success) {
+        memset(buffer, 0, sizeof(bib_word_b));
+    }
+    return success;
+}
+
+bool bib_token_lex_longword(bib_longword_b buffer, bib_tokbuf_t *const lexer)
+{
+    if (buffer == NULL || lexer == NULL || lexer->count == 0) {
+        return false;
+    }
+
+    bib_tokbuf_t l = *lexer;
+    size_t length = 0;
+    size_t const max_length = sizeof(bib_longword_b) - 1;
+    while (length < max_length && l.count > 0 && l.tok->kind != bib_token_kind_space) {
+        char const *const str = bib_tokbuf_str(&l);
+        if (str[0] == '\0') {
+            break;
+        }
+        size_t const avail = bib_tokbuf_avail(&l);
+        size_t const step = (avail < max_length - length) ? avail : max_length - length;
+        memcpy(&(buffer[length]), str, step);
+        length += step;
+        bib_tokbuf_step(&l, step);
+    }
+    buffer[length] = '\0';
+
+    bool success = (length > 0) && bib_advance_tokbuf(lexer, &l);
+    if (!success) {
+        memset(buffer, 0, sizeof(bib_longword_b));
+    }
+    return success;
+}
+
+#pragma mark - read
+
+bool bib_token_read_space(bib_tokbuf_t *const lexer)
+{
+    if (lexer == NULL || !bib_tokbuf_is(lexer, bib_token_kind_space)) {
+        return false;
+    }
+    bib_tokbuf_step(lexer, bib_tokbuf_avail(lexer));
+    return true;
+}
+
+bool bib_token_read_point(bib_tokbuf_t *const lexer)
+{
+    return bib_token_read_char(NULL, bib_char_class_point, lexer);
+}
+
+bool bib_token_read_dash(bib_tokbuf_t *const lexer)
+{
+    return bib_token_read_char(NULL, bib_char_class_dash, lexer);
+}
+
+bool bib_token_read_slash(bib_tokbuf_t *const lexer)
+{
+    return bib_token_read_char(NULL, bib_char_class_slash, lexer);
+}
+
+bool bib_token_read_comma(bib_tokbuf_t *const lexer)
+{
+    return bib_token_read_char(NULL, bib_char_class_comma, lexer);
+}
+
+bool bib_token_read_etc(bib_tokbuf_t *const lexer)
+{
+    if (lexer == NULL || lexer->count == 0) {
+        return false;
+    }
+    bib_tokbuf_t l = *lexer;
+    char word[4] = { 0, 0, 0, 0 };
+    bool comma_success = bib_token_read_comma(&l);
+    bool space_success = comma_success && bib_token_read_space(&l);
+    bool  word_success = space_success
+                      && (bib_token_lex_lower_n(word, sizeof(word), &l) > 0)
+                      && (strcmp(word, "etc") == 0);
+    bool point_success = word_success && bib_token_read_point(&l);
+    return point_success && bib_advance_tokbuf(lexer, &l);
+}
+
+bool bib_token_read_char(char *const c, bib_char_class_t const cls, bib_tokbuf_t *const lexer)
+{
+    if (lexer == NULL || lexer->count == 0) {
+        return false;
+    }
+    char const v = bib_tokbuf_str(lexer)[0];
+    if (bib_char_class(v) != cls) {
+        return false;
+    }
+    bib_tokbuf_step(lexer, 1);
+    if (c != NULL) {
+        *c = v;
+    }
+    return true;
+}
+
+#pragma mark - peek
+
+bib_token_t const *bib_token_peek(bib_tokbuf_t const *const lexer)
+{
+    return (lexer == NULL || lexer->count == 0) ? NULL : lexer->tok;
+}
+
+bool bib_token_peek_break(bib_tokbuf_t const *const lexer)
+{
+    if (lexer == NULL) { return false; }
+    if (lexer->count == 0) { return true; }
+    return (lexer->tok->kind == bib_token_kind_space) || (lexer->tok->kind == bib_token_kind_stop);
+}
+
+bool bib_token_peek_stop(bib_tokbuf_t const *const lexer)
+{
+    return (lexer != NULL) && bib_tokbuf_is(lexer, bib_token_kind_stop);
+}
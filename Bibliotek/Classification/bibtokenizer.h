@@ -9,6 +9,286 @@
 #ifndef bibtokenizer_h
 #define bibtokenizer_h
 
-#include <stdio.h>
+#include "bibtype.h"
+#include "biblex.h"
+
+__BEGIN_DECLS
+
+#pragma mark - character classes
+
+/// The lexical class of a single character in a call number string.
+typedef enum bib_char_class {
+    /// Any character without a more specific class, such as punctuation that isn't used as a separator.
+    bib_char_class_symbol = 0,
+
+    /// A number from `0` to `9`.
+    bib_char_class_digit,
+
+    /// An uppercase ASCII latin alphabet character.
+    bib_char_class_upper,
+
+    /// A lowercase ASCII latin alphabet character.
+    bib_char_class_lower,
+
+    /// A whitespace character.
+    bib_char_class_space,
+
+    /// Period character `'.'`.
+    bib_char_class_point,
+
+    /// Comma character `','`.
+    bib_char_class_comma,
+
+    /// Dash character `'-'`.
+    bib_char_class_dash,
+
+    /// Forward-slash character `'/'`.
+    bib_char_class_slash,
+
+    /// A character representing the end of data in a stream, other than the null terminator.
+    bib_char_class_stop,
+
+    /// The null terminator.
+    bib_char_class_null
+} bib_char_class_t;
+
+/// A table mapping every byte value to its `bib_char_class_t`.
+extern unsigned char const bib_char_classes[256];
+
+/// Get the lexical class of the given character.
+static inline bib_char_class_t bib_char_class(char const c)
+{
+    return (bib_char_class_t)bib_char_classes[(unsigned char)c];
+}
+
+#pragma mark - tokens
+
+/// The kind of characters that make up a token.
+typedef enum bib_token_kind {
+    /// A single character without a more specific kind.
+    bib_token_kind_symbol = 0,
+
+    /// A run of adjacent digits.
+    bib_token_kind_digits,
+
+    /// A run of adjacent uppercase and lowercase letters.
+    bib_token_kind_letters,
+
+    /// A run of adjacent whitespace characters.
+    bib_token_kind_space,
+
+    /// A single period character `'.'`.
+    bib_token_kind_point,
+
+    /// A single comma character `','`.
+    bib_token_kind_comma,
+
+    /// A single dash character `'-'`.
+    bib_token_kind_dash,
+
+    /// A single forward-slash character `'/'`.
+    bib_token_kind_slash,
+
+    /// A single character marking the end of data, including the null terminator.
+    bib_token_kind_stop
+} bib_token_kind_t;
+
+/// A run of characters from the input string sharing the same lexical class.
+typedef struct bib_token {
+    /// The kind of characters within the token.
+    bib_token_kind_t kind;
+
+    /// Pointer to the first character of the token within the input string.
+    char const *str;
+
+    /// The amount of characters in the token.
+    size_t len;
+} bib_token_t;
+
+/// Read the tokens from the given string in a single pass.
+/// - parameter tokens: Allocated space to write the tokens into. This may be `NULL` when `capacity` is zero.
+/// - parameter capacity: The amount of tokens that can be written into the `tokens` buffer.
+/// - parameter str: The input string to tokenize.
+/// - parameter len: The amount of bytes to read from the input string.
+/// - returns: The total amount of tokens in the input string, which may be larger than `capacity`.
+/// - postcondition: At most `capacity` tokens are written into the `tokens` buffer.
+///
+/// Tokenization stops after the null terminator, since no lexer can read past it.
+extern size_t bib_tokenize(bib_token_t *tokens, size_t capacity, char const *str, size_t len);
+
+/// The amount of tokens that a token list can hold without allocating memory.
+#define BIB_TOKEN_LIST_INLINE_CAPACITY 48
+
+/// A list of tokens read from an input string.
+typedef struct bib_token_list {
+    /// The tokens read from the input string. This is either `storage` or a heap-allocated buffer.
+    bib_token_t *buffer;
+
+    /// The amount of tokens within the list.
+    size_t length;
+
+    /// Space for short token lists, used to avoid heap allocations for typical call numbers.
+    bib_token_t storage[BIB_TOKEN_LIST_INLINE_CAPACITY];
+} bib_token_list_t;
+
+/// Read the tokens from the given string into a token list.
+/// - parameter list: Allocated space for the token list.
+/// - parameter str: The input string to tokenize.
+/// - parameter len: The amount of bytes to read from the input string.
+/// - returns: `true` when the token list is successfully created.
+/// - postcondition: `list` must be deinitialized with `bib_token_list_deinit()` when `true` is returned.
+extern bool bib_token_list_init(bib_token_list_t *list, char const *str, size_t len);
+
+/// Release any memory allocated for the given token list.
+extern void bib_token_list_deinit(bib_token_list_t *list);
+
+#pragma mark - token buffer
+
+/// An object holding the current reading position within a list of tokens.
+///
+/// Like `bib_strbuf_t`, this is small enough to be copied-by-value to implement look-ahead without
+/// needing to mutate the original token buffer.
+typedef struct bib_tokbuf {
+    /// The current token.
+    bib_token_t const *tok;
+
+    /// The amount of tokens remaining in the input stream, including the current token.
+    size_t count;
+
+    /// The amount of characters already read from the current token.
+    size_t pos;
+
+    /// The amount of characters read from the input stream.
+    size_t offset;
+} bib_tokbuf_t;
+
+/// Create a token buffer object reading from the start of the given token list.
+extern bib_tokbuf_t bib_tokbuf(bib_token_list_t const *list);
+
+/// Consume some amount of characters from the token stream.
+/// - parameter tokbuf: The token buffer to advance.
+/// - parameter update: A token buffer with the state that `tokbuf` should be advanced to.
+/// - returns: `true` when `tokbuf` is successfully able to consumed characters from the token stream
+///            to match the state of the `update` token buffer.
+///            `false` is returned when the token stream is empty, when `update` is `NULL`, or when
+///            `update` has not read further than `tokbuf`.
+extern bool bib_advance_tokbuf(bib_tokbuf_t *tokbuf, bib_tokbuf_t const *update);
+
+/// Consume the given amount of characters from the token stream, regardless of their tokens' boundaries.
+/// - parameter tokbuf: The token buffer to advance.
+/// - parameter len: The amount of characters to consume.
+/// - returns: `true` when `len` characters are consumed from the token stream.
+extern bool bib_tokbuf_skip(bib_tokbuf_t *tokbuf, size_t len);
+
+/// Create a string buffer reading the remaining characters in the token stream.
+extern bib_strbuf_t bib_tokbuf_strbuf(bib_tokbuf_t const *tokbuf);
+
+#pragma mark - lex
+
+/// Read between one and six digits from the token stream. See `bib_lex_integer()`.
+extern bool bib_token_lex_integer (bib_digit06_b buffer, bib_tokbuf_t *lexer);
+
+/// Read between one and 16 digits from the token stream. See `bib_lex_digit16()`.
+extern bool bib_token_lex_digit16 (bib_digit16_b buffer, bib_tokbuf_t *lexer);
+
+/// Read between one and 16 digits following a decimal point from the token stream. See `bib_lex_decimal()`.
+extern bool bib_token_lex_decimal (bib_digit16_b buffer, bib_tokbuf_t *lexer);
+
+/// Read a four-digit year from the token stream. See `bib_lex_year()`.
+extern bool bib_token_lex_year    (bib_year_b    buffer, bib_tokbuf_t *lexer);
+
+/// Read a two-digit abbreviated year from the token stream. See `bib_lex_year_abv()`.
+extern bool bib_token_lex_year_abv(bib_year_b    buffer, bib_tokbuf_t *lexer);
+
+/// Read a mark suffix with between one and four letters from the token stream. See `bib_lex_mark()`.
+extern bool bib_token_lex_mark    (bib_mark_b    buffer, bib_tokbuf_t *lexer);
+
+/// Read between one and three letters from the token stream. See `bib_lex_subclass()`.
+extern bool bib_token_lex_subclass(bib_alpah03_b buffer, bib_tokbuf_t *lexer);
+
+/// Read a single letter from the token stream. See `bib_lex_initial()`.
+extern bool bib_token_lex_initial (bib_initial_t *initial, bib_tokbuf_t *lexer);
+
+/// Read the suffix for a cutter segment's ordinal number from the token stream.
+/// See `bib_lex_cutter_ordinal_suffix()`.
+extern bool bib_token_lex_cutter_ordinal_suffix(bib_word_b buffer, bib_tokbuf_t *lexer);
+
+/// Read the suffix for the caption segment's ordinal number from the token stream.
+/// See `bib_lex_caption_ordinal_suffix()`.
+extern bool bib_token_lex_caption_ordinal_suffix(bib_word_b buffer, bib_tokbuf_t *lexer);
+
+/// Read the suffix for an ordinal number in the specification segment from the token stream.
+/// See `bib_lex_specification_ordinal_suffix()`.
+extern bool bib_token_lex_specification_ordinal_suffix(bib_word_b buffer, bib_tokbuf_t *lexer);
+
+/// Read an ordinal suffix from the token stream using the token equivalent of the given lexer function.
+/// - parameter buffer: Allocated space for an ordinal suffix. The written value will contain a null terminator.
+/// - parameter lex_suffix: A function defining the lexing strategy used for the ordinal's suffix value.
+/// - parameter lexer: Pointer to a token buffer object to read from.
+/// - returns: `true` when the suffix is successfully read from the token stream.
+///
+/// Lexer functions without a token equivalent are run directly on the remaining characters in the token stream.
+extern bool bib_token_lex_ordinal_suffix(bib_word_b buffer, bib_lex_word_f lex_suffix, bib_tokbuf_t *lexer);
+
+/// Read a volume prefix from the token stream. See `bib_lex_volume_prefix()`.
+extern bool bib_token_lex_volume_prefix(bib_word_b buffer, bib_tokbuf_t *lexer);
+
+/// Read a supplementary work prefix from the token stream. See `bib_lex_supplement_prefix()`.
+extern bool bib_token_lex_supplement_prefix(bib_word_b buffer, bib_tokbuf_t *lexer);
+
+/// Read the value of a long word from the token stream. See `bib_lex_longword()`.
+extern bool bib_token_lex_longword(bib_longword_b buffer, bib_tokbuf_t *lexer);
+
+/// Read up to `buffer_len-1` decimal digits from the token stream into the given buffer.
+/// - parameter buffer: Allocated space to write the lexed number string. The written value will contain a null terminator.
+/// - parameter buffer_len: The length of available space in the buffer.
+/// - parameter lexer: Pointer to a token buffer object to read from.
+/// - returns: The amount of characters read from the token stream. This does not include the null terminator.
+extern size_t bib_token_lex_digit_n(char *buffer, size_t buffer_len, bib_tokbuf_t *lexer);
+
+#pragma mark - read
+
+/// Consume all adjacent whitespace characters in the token stream. See `bib_read_space()`.
+extern bool bib_token_read_space(bib_tokbuf_t *lexer);
+
+/// Consume a single period character `'.'` from the token stream.
+extern bool bib_token_read_point(bib_tokbuf_t *lexer);
+
+/// Consume a single dash character `'-'` from the token stream.
+extern bool bib_token_read_dash (bib_tokbuf_t *lexer);
+
+/// Consume a single forward-slash character `'/'` from the token stream.
+extern bool bib_token_read_slash(bib_tokbuf_t *lexer);
+
+/// Consume a single comma character `','` from the token stream.
+extern bool bib_token_read_comma(bib_tokbuf_t *lexer);
+
+/// Consume the string ", etc." from the token stream.
+extern bool bib_token_read_etc(bib_tokbuf_t *lexer);
+
+/// Consume a single character of the given class from the token stream.
+/// - parameter c: Pointer to allocated space to set the read character.
+///                Pass `NULL` to ignore the consumed value.
+/// - parameter cls: The class of character to read.
+/// - parameter lexer: Pointer to a token buffer object to read from.
+/// - returns: `true` when a character of the given class is consumed from the token stream.
+extern bool bib_token_read_char(char *c, bib_char_class_t cls, bib_tokbuf_t *lexer);
+
+#pragma mark - peek
+
+/// Get the next token in the stream without consuming it.
+/// - parameter lexer: Pointer to a token buffer object to read from.
+/// - returns: The current token, or `NULL` when the token stream is empty.
+extern bib_token_t const *bib_token_peek(bib_tokbuf_t const *lexer);
+
+/// Check if the next character separates one word from another—such as whitespace, the null terminator, or EOF.
+/// See `bib_peek_break()`.
+extern bool bib_token_peek_break(bib_tokbuf_t const *lexer);
+
+/// Check if the next character represents the end of data in the token stream.
+/// - returns: `false` when the token stream is empty, matching `bib_peek_char()` with `bib_isstop()`.
+extern bool bib_token_peek_stop(bib_tokbuf_t const *lexer);
+
+__END_DECLS
 
 #endif /* bibtokenizer_h */
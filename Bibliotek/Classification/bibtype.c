@@ -8,19 +8,28 @@
 
 #include "bibtype.h"
 #include <assert.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <pthread.h>
+#include <unistd.h>
 #include "bibparse.h"
 
 #pragma mark lc calln
 
 bool bib_lc_calln_init(bib_lc_calln_t *const num, char const *const str)
+{
+    return bib_lc_calln_init_arena(num, str, NULL);
+}
+
+bool bib_lc_calln_init_arena(bib_lc_calln_t *const num, char const *const str,
+                             bib_lc_specification_arena_t *const arena)
 {
     if (num == NULL || str == NULL) { return false; }
     memset(num, 0, sizeof(bib_lc_calln_t));
     bib_strbuf_t strbuf = bib_strbuf(str, 0);
-    bool parse_success = bib_parse_lc_calln(num, &strbuf);
+    bool parse_success = bib_parse_lc_calln_arena(num, arena, &strbuf);
     bool total_success = parse_success && (strbuf.len == 1);
     if (parse_success && !total_success) {
         bib_lc_calln_deinit(num);
@@ -35,6 +44,316 @@ void bib_lc_calln_deinit(bib_lc_calln_t *const num)
     memset(num, 0, sizeof(bib_lc_calln_t));
 }
 
+#pragma mark - lc calln batch
+
+/// The smallest amount of strings given to a thread by `bib_lc_calln_init_batch()`.
+/// Parsing fewer strings than this takes less time than starting a thread.
+#define BIB_LC_CALLN_BATCH_MIN_COUNT 512
+
+/// The largest amount of threads used by `bib_lc_calln_init_batch()`.
+#define BIB_LC_CALLN_BATCH_MAX_THREADS 64
+
+/// The amount of threads used to process `n` items, giving each thread at least `min_count` items.
+/// - parameter threads: The maximum amount of threads, or `0` for one thread for each available processor.
+static size_t bib_lc_calln_thread_count(size_t const n, unsigned threads, size_t const min_count)
+{
+    if (threads == 0) {
+        long const processors = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (processors > 0) ? (unsigned)processors : 1;
+    }
+    size_t const max_threads = (n + min_count - 1) / min_count;
+    size_t const count = (threads < max_threads) ? threads : max_threads;
+    return (count < BIB_LC_CALLN_BATCH_MAX_THREADS) ? count : BIB_LC_CALLN_BATCH_MAX_THREADS;
+}
+
+/// A contiguous run of call number strings parsed by a single thread.
+typedef struct bib_lc_calln_batch {
+    bib_lc_calln_t *out;
+    char const *const *strs;
+    bool *ok;
+    size_t count;
+    size_t success_count;
+} bib_lc_calln_batch_t;
+
+static void *bib_lc_calln_batch_run(void *const context)
+{
+    bib_lc_calln_batch_t *const batch = context;
+    size_t success_count = 0;
+    for (size_t index = 0; index < batch->count; index += 1) {
+        bib_lc_calln_t *const num = &(batch->out[index]);
+        char const *const str = batch->strs[index];
+        bool const success = (str != NULL) && bib_lc_calln_init(num, str);
+        if (!success) {
+            memset(num, 0, sizeof(bib_lc_calln_t));
+        }
+        if (batch->ok != NULL) {
+            batch->ok[index] = success;
+        }
+        success_count += (success) ? 1 : 0;
+    }
+    batch->success_count = success_count;
+    return NULL;
+}
+
+size_t bib_lc_calln_init_batch(bib_lc_calln_t *const out, char const *const *const strs, size_t const n,
+                               bool *const ok, unsigned threads)
+{
+    if (out == NULL || strs == NULL || n == 0) {
+        return 0;
+    }
+    size_t const thread_count = bib_lc_calln_thread_count(n, threads, BIB_LC_CALLN_BATCH_MIN_COUNT);
+
+    bib_lc_calln_batch_t batches[BIB_LC_CALLN_BATCH_MAX_THREADS];
+    pthread_t workers[BIB_LC_CALLN_BATCH_MAX_THREADS];
+    bool started[BIB_LC_CALLN_BATCH_MAX_THREADS];
+    size_t offset = 0;
+    for (size_t index = 0; index < thread_count; index += 1) {
+        size_t const length = (n / thread_count) + ((index < n % thread_count) ? 1 : 0);
+        batches[index] = (bib_lc_calln_batch_t){
+            .out = &(out[offset]),
+            .strs = &(strs[offset]),
+            .ok = (ok == NULL) ? NULL : &(ok[offset]),
+            .count = length,
+            .success_count = 0
+        };
+        offset += length;
+    }
+
+    // The calling thread parses the first batch, and any batch whose thread can't be started.
+    for (size_t index = 1; index < thread_count; index += 1) {
+        started[index] = (pthread_create(&(workers[index]), NULL, bib_lc_calln_batch_run, &(batches[index])) == 0);
+    }
+    bib_lc_calln_batch_run(&(batches[0]));
+    size_t success_count = batches[0].success_count;
+    for (size_t index = 1; index < thread_count; index += 1) {
+        if (started[index]) {
+            pthread_join(workers[index], NULL);
+        } else {
+            bib_lc_calln_batch_run(&(batches[index]));
+        }
+        success_count += batches[index].success_count;
+    }
+    return success_count;
+}
+
+#pragma mark - lc calln sort
+
+/// The smallest amount of call numbers sorted by a thread in `bib_lc_calln_sort()`.
+/// Sorting fewer call numbers than this takes less time than starting a thread.
+#define BIB_LC_CALLN_SORT_MIN_COUNT 4096
+
+/// The length of the runs put in order with an insertion sort before they're merged together.
+#define BIB_LC_CALLN_SORT_RUN_LENGTH 16
+
+/// Compare the items at two indices.
+/// - returns: A negative number when the item at `left` is ordered before the item at `right`,
+///            a positive number when it's ordered after, and `0` when they're ordered the same.
+typedef int (*bib_lc_calln_sort_compare_fn)(void const *items, size_t left, size_t right);
+
+/// A range of indices sorted or merged by a single thread.
+typedef struct bib_lc_calln_sort_task {
+    void const *items;
+    bib_lc_calln_sort_compare_fn compare;
+    size_t *src;
+    size_t *dst;
+    size_t start;
+    size_t middle;
+    size_t end;
+} bib_lc_calln_sort_task_t;
+
+/// Merge two adjacent sorted runs of indices from `src[start..<middle]` and `src[middle..<end]` into `dst`.
+/// Indices from the left run are taken first when items are ordered the same, which keeps the sort stable.
+static void bib_lc_calln_sort_merge(bib_lc_calln_sort_task_t const *const task, size_t const *const src,
+                                    size_t *const dst, size_t const start, size_t const middle, size_t const end)
+{
+    size_t left = start;
+    size_t right = middle;
+    size_t index = start;
+    while (left < middle && right < end) {
+        if (task->compare(task->items, src[right], src[left]) < 0) {
+            dst[index++] = src[right++];
+        } else {
+            dst[index++] = src[left++];
+        }
+    }
+    memcpy(&(dst[index]), &(src[left]), (middle - left) * sizeof(size_t));
+    index += middle - left;
+    memcpy(&(dst[index]), &(src[right]), (end - right) * sizeof(size_t));
+}
+
+/// Sort the indices in `src[start..<end]` using `dst[start..<end]` as scratch space.
+/// - postcondition: The sorted indices are written to `src`.
+static void *bib_lc_calln_sort_task_sort(void *const context)
+{
+    bib_lc_calln_sort_task_t const *const task = context;
+    for (size_t run = task->start; run < task->end; run += BIB_LC_CALLN_SORT_RUN_LENGTH) {
+        size_t const run_end = (task->end - run < BIB_LC_CALLN_SORT_RUN_LENGTH) ? task->end
+                                                                                : run + BIB_LC_CALLN_SORT_RUN_LENGTH;
+        for (size_t index = run + 1; index < run_end; index += 1) {
+            size_t const value = task->src[index];
+            size_t position = index;
+            while (position > run && task->compare(task->items, value, task->src[position - 1]) < 0) {
+                task->src[position] = task->src[position - 1];
+                position -= 1;
+            }
+            task->src[position] = value;
+        }
+    }
+    size_t *src = task->src;
+    size_t *dst = task->dst;
+    for (size_t width = BIB_LC_CALLN_SORT_RUN_LENGTH; width < task->end - task->start; width *= 2) {
+        for (size_t start = task->start; start < task->end; start += 2 * width) {
+            size_t const middle = (task->end - start < width) ? task->end : start + width;
+            size_t const end = (task->end - middle < width) ? task->end : middle + width;
+            bib_lc_calln_sort_merge(task, src, dst, start, middle, end);
+        }
+        size_t *const swap = src;
+        src = dst;
+        dst = swap;
+    }
+    if (src != task->src) {
+        memcpy(&(task->src[task->start]), &(src[task->start]), (task->end - task->start) * sizeof(size_t));
+    }
+    return NULL;
+}
+
+/// Merge the sorted runs `src[start..<middle]` and `src[middle..<end]` into `dst[start..<end]`.
+static void *bib_lc_calln_sort_task_merge(void *const context)
+{
+    bib_lc_calln_sort_task_t const *const task = context;
+    bib_lc_calln_sort_merge(task, task->src, task->dst, task->start, task->middle, task->end);
+    return NULL;
+}
+
+/// Run each task on its own thread, with the calling thread running the first task,
+/// and any task whose thread can't be started.
+static void bib_lc_calln_sort_run(bib_lc_calln_sort_task_t *const tasks, size_t const count,
+                                  void *(*const run)(void *))
+{
+    pthread_t workers[BIB_LC_CALLN_BATCH_MAX_THREADS];
+    bool started[BIB_LC_CALLN_BATCH_MAX_THREADS];
+    for (size_t index = 1; index < count; index += 1) {
+        started[index] = (pthread_create(&(workers[index]), NULL, run, &(tasks[index])) == 0);
+    }
+    run(&(tasks[0]));
+    for (size_t index = 1; index < count; index += 1) {
+        if (started[index]) {
+            pthread_join(workers[index], NULL);
+        } else {
+            run(&(tasks[index]));
+        }
+    }
+}
+
+/// Stable sort the indices of `n` items using a parallel merge sort.
+/// - parameter order: Allocated space for `n` indices, which is set to the indices of the items in sorted order.
+/// - returns: `true` when the indices are sorted, or `false` when scratch space can't be allocated.
+static bool bib_lc_calln_sort_order(size_t *const order, void const *const items, size_t const n,
+                                    bib_lc_calln_sort_compare_fn const compare, unsigned const threads)
+{
+    for (size_t index = 0; index < n; index += 1) {
+        order[index] = index;
+    }
+    if (n < 2) {
+        return true;
+    }
+    size_t *const scratch = malloc(n * sizeof(size_t));
+    if (scratch == NULL) {
+        return false;
+    }
+
+    // Each thread sorts its own contiguous range of indices.
+    size_t const thread_count = bib_lc_calln_thread_count(n, threads, BIB_LC_CALLN_SORT_MIN_COUNT);
+    size_t bounds[BIB_LC_CALLN_BATCH_MAX_THREADS + 1];
+    bib_lc_calln_sort_task_t tasks[BIB_LC_CALLN_BATCH_MAX_THREADS];
+    bounds[0] = 0;
+    for (size_t index = 0; index < thread_count; index += 1) {
+        size_t const length = (n / thread_count) + ((index < n % thread_count) ? 1 : 0);
+        bounds[index + 1] = bounds[index] + length;
+        tasks[index] = (bib_lc_calln_sort_task_t){
+            .items = items, .compare = compare, .src = order, .dst = scratch,
+            .start = bounds[index], .middle = bounds[index + 1], .end = bounds[index + 1]
+        };
+    }
+    bib_lc_calln_sort_run(tasks, thread_count, bib_lc_calln_sort_task_sort);
+
+    // Adjacent sorted ranges are merged in pairs, halving the amount of ranges with each round.
+    size_t *src = order;
+    size_t *dst = scratch;
+    for (size_t width = 1; width < thread_count; width *= 2) {
+        size_t count = 0;
+        for (size_t index = 0; index < thread_count; index += 2 * width) {
+            size_t const middle = (index + width < thread_count) ? index + width : thread_count;
+            size_t const end = (middle + width < thread_count) ? middle + width : thread_count;
+            tasks[count++] = (bib_lc_calln_sort_task_t){
+                .items = items, .compare = compare, .src = src, .dst = dst,
+                .start = bounds[index], .middle = bounds[middle], .end = bounds[end]
+            };
+        }
+        bib_lc_calln_sort_run(tasks, count, bib_lc_calln_sort_task_merge);
+        size_t *const swap = src;
+        src = dst;
+        dst = swap;
+    }
+    if (src != order) {
+        memcpy(order, src, n * sizeof(size_t));
+    }
+    free(scratch);
+    return true;
+}
+
+static int bib_lc_calln_sort_compare(void const *const items, size_t const left, size_t const right)
+{
+    bib_lc_calln_t const *const arr = items;
+    return -(int)bib_lc_calln_compare(bib_calln_ordered_same, &(arr[left]), &(arr[right]), false);
+}
+
+static int bib_lc_calln_encoded_sort_compare(void const *const items, size_t const left, size_t const right)
+{
+    unsigned char const *const *const encodings = items;
+    return bib_lc_calln_encoded_compare(encodings[left], encodings[right]);
+}
+
+bool bib_lc_calln_sort(bib_lc_calln_t *const arr, size_t const n, unsigned const threads)
+{
+    if (arr == NULL || n < 2) {
+        return true;
+    }
+    size_t *const order = malloc(n * sizeof(size_t));
+    if (order == NULL || !bib_lc_calln_sort_order(order, arr, n, bib_lc_calln_sort_compare, threads)) {
+        free(order);
+        return false;
+    }
+
+    // Follow each cycle of the permutation to move every call number directly into its sorted position.
+    for (size_t start = 0; start < n; start += 1) {
+        if (order[start] == start) {
+            continue;
+        }
+        bib_lc_calln_t const first = arr[start];
+        size_t position = start;
+        while (order[position] != start) {
+            size_t const next = order[position];
+            arr[position] = arr[next];
+            order[position] = position;
+            position = next;
+        }
+        arr[position] = first;
+        order[position] = position;
+    }
+    free(order);
+    return true;
+}
+
+bool bib_lc_calln_encoded_sort(size_t *const order, unsigned char const *const *const encodings, size_t const n,
+                               unsigned const threads)
+{
+    if (order == NULL || encodings == NULL) {
+        return n == 0;
+    }
+    return bib_lc_calln_sort_order(order, encodings, n, bib_lc_calln_encoded_sort_compare, threads);
+}
+
 #pragma mark - date
 
 bool bib_date_init(bib_date_t *const date, char const *const str)
@@ -111,10 +430,61 @@ bool bib_lc_specification_is_empty(bib_lc_specification_t const *const spc)
     return (spc == NULL) || (spc->kind == 0);
 }
 
+void bib_lc_specification_arena_init(bib_lc_specification_arena_t *const arena,
+                                     bib_lc_specification_t *const buffer, size_t const capacity)
+{
+    if (arena == NULL) { return; }
+    arena->buffer = buffer;
+    arena->capacity = (buffer == NULL) ? 0 : capacity;
+    arena->length = 0;
+}
+
+void bib_lc_specification_arena_reset(bib_lc_specification_arena_t *const arena)
+{
+    if (arena == NULL) { return; }
+    arena->length = 0;
+}
+
+/// Is the list's buffer the most recent allocation from its arena?
+static bool bib_lc_specification_list_is_arena_top(bib_lc_specification_list_t const *const list)
+{
+    bib_lc_specification_arena_t const *const arena = list->arena;
+    return (list->buffer != NULL) && (list->buffer + list->length == arena->buffer + arena->length);
+}
+
+/// Make room for one more segment at the end of an arena-backed list.
+/// - returns: `false` when the arena doesn't have enough space left.
+static bool bib_lc_specification_list_grow_arena(bib_lc_specification_list_t *const list)
+{
+    bib_lc_specification_arena_t *const arena = list->arena;
+    size_t const available = arena->capacity - arena->length;
+    if (bib_lc_specification_list_is_arena_top(list)) {
+        if (available < 1) { return false; }
+        arena->length += 1;
+        return true;
+    }
+    // Another list took space after this one, so the segments have to move to the top of the arena.
+    if (available < list->length + 1) { return false; }
+    bib_lc_specification_t *const buffer = arena->buffer + arena->length;
+    if (list->length > 0) {
+        memcpy(buffer, list->buffer, list->length * sizeof(bib_lc_specification_t));
+    }
+    list->buffer = buffer;
+    arena->length += list->length + 1;
+    return true;
+}
+
 void bib_lc_specification_list_init(bib_lc_specification_list_t *list)
+{
+    bib_lc_specification_list_init_arena(list, NULL);
+}
+
+void bib_lc_specification_list_init_arena(bib_lc_specification_list_t *const list,
+                                          bib_lc_specification_arena_t *const arena)
 {
     if (list == NULL) { return; }
     memset(list, 0, sizeof(bib_lc_specification_list_t));
+    list->arena = (arena == NULL || arena->buffer == NULL) ? NULL : arena;
 }
 
 void bib_lc_specification_list_append(bib_lc_specification_list_t *list, bib_lc_specification_t *spc)
@@ -122,18 +492,40 @@ void bib_lc_specification_list_append(bib_lc_specification_list_t *list, bib_lc_
     if (list == NULL || spc == NULL) { return; }
     assert(list->buffer != NULL || list->length == 0);
     size_t const prev_end_index = list->length;
+    if (list->arena != NULL && !bib_lc_specification_list_grow_arena(list)) {
+        // Fall back to the heap once the arena is full, so that parsing never fails for lack of space.
+        bib_lc_specification_t *const buffer = malloc((prev_end_index + 1) * sizeof(bib_lc_specification_t));
+        if (prev_end_index > 0) {
+            memcpy(buffer, list->buffer, prev_end_index * sizeof(bib_lc_specification_t));
+        }
+        if (bib_lc_specification_list_is_arena_top(list)) {
+            list->arena->length -= prev_end_index;
+        }
+        list->buffer = buffer;
+        list->arena = NULL;
+    } else if (list->arena == NULL) {
+        list->buffer = (list->buffer == NULL)
+                     ? malloc(sizeof(bib_lc_specification_t))
+                     : realloc(list->buffer, (prev_end_index + 1) * sizeof(bib_lc_specification_t));
+    }
     list->length = prev_end_index + 1;
-    list->buffer = (list->buffer == NULL) ? malloc(sizeof(bib_lc_specification_t))
-                                          : realloc(list->buffer, list->length * sizeof(bib_lc_specification_t));
     list->buffer[prev_end_index] = *spc;
 }
 
 void bib_lc_specification_list_deinit(bib_lc_specification_list_t *const list)
 {
-    if (list == NULL || list->buffer == NULL) { return; }
-    free(list->buffer);
+    if (list == NULL) { return; }
+    if (list->arena != NULL) {
+        // Give the space back when nothing was taken from the arena after this list.
+        if (bib_lc_specification_list_is_arena_top(list)) {
+            list->arena->length -= list->length;
+        }
+    } else if (list->buffer != NULL) {
+        free(list->buffer);
+    }
     list->buffer = NULL;
     list->length = 0;
+    list->arena = NULL;
 }
 
 bool bib_lc_specification_list_is_empty(bib_lc_specification_list_t const *const list) {
@@ -204,6 +596,104 @@ bool bib_cuttseg_is_empty(bib_cuttseg_t const *const seg)
     return (seg == NULL) || bib_cutter_is_empty(&(seg->cutter));
 }
 
+#pragma mark - lc fingerprint
+
+/// Set in every calculated fingerprint, so that `0` can mean the fingerprint is unavailable.
+#define BIB_FINGERPRINT_VALID (UINT64_C(1) << 63)
+
+/// The fingerprint bits holding three five-bit class letters, where `0` marks the end of the letters.
+#define BIB_FINGERPRINT_LETTERS_SHIFT 48
+#define BIB_FINGERPRINT_LETTER_BITS 5
+#define BIB_FINGERPRINT_LETTER_MASK UINT64_C(0x1F)
+
+/// The fingerprint bits holding one more than the integer value, where `0` marks an empty integer.
+#define BIB_FINGERPRINT_INTEGER_SHIFT 28
+#define BIB_FINGERPRINT_INTEGER_MASK UINT64_C(0xFFFFF)
+
+/// The fingerprint bits holding seven four-bit decimal digits, each one more than the digit's value,
+/// where `0` marks the end of the decimal.
+#define BIB_FINGERPRINT_DECIMAL_DIGITS 7
+#define BIB_FINGERPRINT_DECIMAL_MASK UINT64_C(0xFFFFFFF)
+
+uint64_t bib_lc_calln_fingerprint(bib_lc_calln_t const *const num)
+{
+    if (num == NULL) { return 0; }
+    uint64_t letters = 0;
+    bool letters_end = false;
+    for (size_t index = 0; index < 3; index += 1) {
+        unsigned char const c = (letters_end) ? '\0' : (unsigned char)toupper((unsigned char)num->letters[index]);
+        letters_end = (c == '\0');
+        if (!letters_end && (c < 'A' || c > 'Z')) {
+            return 0;
+        }
+        letters = (letters << BIB_FINGERPRINT_LETTER_BITS) | ((letters_end) ? 0 : (uint64_t)(c - 'A' + 1));
+    }
+    uint64_t integer = 0;
+    if (num->integer[0] != '\0') {
+        for (size_t index = 0; num->integer[index] != '\0'; index += 1) {
+            if (!isdigit((unsigned char)num->integer[index])) {
+                return 0;
+            }
+            integer = (integer * 10) + (uint64_t)(num->integer[index] - '0');
+        }
+        integer += 1;
+        if (integer > BIB_FINGERPRINT_INTEGER_MASK) {
+            return 0;
+        }
+    }
+    uint64_t decimal = 0;
+    bool decimal_end = false;
+    for (size_t index = 0; index < BIB_FINGERPRINT_DECIMAL_DIGITS; index += 1) {
+        char const c = (decimal_end) ? '\0' : num->decimal[index];
+        decimal_end = (c == '\0');
+        if (!decimal_end && !isdigit((unsigned char)c)) {
+            return 0;
+        }
+        decimal = (decimal << 4) | ((decimal_end) ? 0 : (uint64_t)(c - '0' + 1));
+    }
+    return BIB_FINGERPRINT_VALID
+         | (letters << BIB_FINGERPRINT_LETTERS_SHIFT)
+         | (integer << BIB_FINGERPRINT_INTEGER_SHIFT)
+         | decimal;
+}
+
+/// Is one of the class letter strings summarized by the given fingerprints a prefix of the other?
+/// - precondition: The fingerprints have different class letters.
+static bool bib_fingerprint_letters_are_prefix(uint64_t const left, uint64_t const right)
+{
+    for (size_t index = 0; index < 3; index += 1) {
+        size_t const shift = BIB_FINGERPRINT_LETTERS_SHIFT + (2 - index) * BIB_FINGERPRINT_LETTER_BITS;
+        uint64_t const l = (left >> shift) & BIB_FINGERPRINT_LETTER_MASK;
+        uint64_t const r = (right >> shift) & BIB_FINGERPRINT_LETTER_MASK;
+        if (l != r) {
+            return (l == 0) || (r == 0);
+        }
+    }
+    return false;
+}
+
+bib_calln_comparison_t bib_lc_calln_fingerprint_compare(uint64_t const left, uint64_t const right, bool const specify)
+{
+    if (!(left & BIB_FINGERPRINT_VALID) || !(right & BIB_FINGERPRINT_VALID) || left == right) {
+        return bib_calln_ordered_same;
+    }
+    bib_calln_comparison_t const result = (left < right) ? bib_calln_ordered_ascending : bib_calln_ordered_descending;
+    if (!specify) {
+        // without specialization, prefixes and empty values are simply ordered first
+        return result;
+    }
+    // a prefix or empty value might specialize the other call number, which needs the full comparison
+    uint64_t const difference = left ^ right;
+    if (difference >> BIB_FINGERPRINT_LETTERS_SHIFT) {
+        return (bib_fingerprint_letters_are_prefix(left, right)) ? bib_calln_ordered_same : result;
+    }
+    uint64_t const mask = ((difference >> BIB_FINGERPRINT_INTEGER_SHIFT) & BIB_FINGERPRINT_INTEGER_MASK)
+                        ? (BIB_FINGERPRINT_INTEGER_MASK << BIB_FINGERPRINT_INTEGER_SHIFT)
+                        : BIB_FINGERPRINT_DECIMAL_MASK;
+    bool const has_empty = ((left & mask) == 0) || ((right & mask) == 0);
+    return (has_empty) ? bib_calln_ordered_same : result;
+}
+
 #pragma mark - lc comparison
 
 static inline bool bib_str_is_empty(char const *const str) { return str == NULL || str[0] == '\0'; }
@@ -246,6 +736,15 @@ bib_calln_comparison_t bib_lc_calln_compare(bib_calln_comparison_t const status,
     else if (left  == NULL) { return bib_calln_ordered_ascending; }
     else if (right == NULL) { return bib_calln_ordered_descending; }
 
+    if (status == bib_calln_ordered_same) {
+        // most call numbers can be ordered by their class and subclass alone
+        bib_calln_comparison_t const result = bib_lc_calln_fingerprint_compare(left->fingerprint,
+                                                                               right->fingerprint, specify);
+        if (result != bib_calln_ordered_same) {
+            return result;
+        }
+    }
+
     bib_calln_comparison_t result = status;
     // letters
     result = bib_string_specify_compare(result, left->letters, right->letters, specify);
@@ -638,6 +1137,553 @@ bib_calln_comparison_t bib_supplement_compare(bib_calln_comparison_t status,
     return result;
 }
 
+#pragma mark - lc sort key
+
+/// A cursor into the output buffer of a sort key.
+typedef struct bib_sortkey_buf {
+    /// The output buffer, which may be `NULL` when `len` is zero.
+    unsigned char *dst;
+
+    /// The size of the output buffer.
+    size_t len;
+
+    /// The total number of bytes in the sort key so far, which may exceed `len`.
+    size_t pos;
+} bib_sortkey_buf_t;
+
+/// Sort key tags marking the presence of a component. Empty components are ordered before any value.
+enum {
+    bib_sortkey_empty   = 0x00,
+    bib_sortkey_present = 0x01
+};
+
+static void bib_sortkey_put_byte(bib_sortkey_buf_t *const key, unsigned char const byte)
+{
+    if (key->pos < key->len) {
+        key->dst[key->pos] = byte;
+    }
+    key->pos += 1;
+}
+
+/// Write a null-terminated string, uppercased to match the case-insensitive string comparisons.
+static void bib_sortkey_put_string(bib_sortkey_buf_t *const key, char const *const str)
+{
+    for (size_t index = 0; str[index] != '\0'; index += 1) {
+        bib_sortkey_put_byte(key, toupper((unsigned char)str[index]));
+    }
+    bib_sortkey_put_byte(key, '\0');
+}
+
+/// Write an integer value so that the key is ordered by numeric value, like `atoi`, instead of by its digits.
+static void bib_sortkey_put_integer(bib_sortkey_buf_t *const key, char const *const str)
+{
+    if (bib_str_is_empty(str)) {
+        bib_sortkey_put_byte(key, bib_sortkey_empty);
+        return;
+    }
+    size_t start = 0;
+    while (str[start] == '0') {
+        start += 1;
+    }
+    size_t end = start;
+    while (isdigit((unsigned char)str[end])) {
+        end += 1;
+    }
+    bib_sortkey_put_byte(key, bib_sortkey_present);
+    bib_sortkey_put_byte(key, (unsigned char)(end - start));
+    for (size_t index = start; index < end; index += 1) {
+        bib_sortkey_put_byte(key, str[index]);
+    }
+}
+
+static void bib_sortkey_put_date(bib_sortkey_buf_t *const key, bib_date_t const *const date)
+{
+    if (bib_date_is_empty(date)) {
+        bib_sortkey_put_byte(key, bib_sortkey_empty);
+        return;
+    }
+    bib_sortkey_put_byte(key, bib_sortkey_present);
+    bib_sortkey_put_integer(key, date->year);
+    // spans are ordered before single years, which are ordered before full dates
+    if (date->isspan) {
+        bib_sortkey_put_byte(key, 0x01);
+        bib_sortkey_put_integer(key, date->span);
+    } else if (date->isdate) {
+        bib_sortkey_put_byte(key, 0x03);
+        bib_sortkey_put_byte(key, (unsigned char)date->month);
+        bib_sortkey_put_byte(key, date->day);
+    } else {
+        bib_sortkey_put_byte(key, 0x02);
+    }
+    bib_sortkey_put_string(key, date->mark);
+}
+
+static void bib_sortkey_put_ordinal(bib_sortkey_buf_t *const key, bib_ordinal_t const *const ord)
+{
+    if (bib_ordinal_is_empty(ord)) {
+        bib_sortkey_put_byte(key, bib_sortkey_empty);
+        return;
+    }
+    bib_sortkey_put_byte(key, bib_sortkey_present);
+    bib_sortkey_put_string(key, ord->number);
+    bib_sortkey_put_string(key, ord->suffix);
+}
+
+static void bib_sortkey_put_dateord(bib_sortkey_buf_t *const key, bib_dateord_t const *const dord)
+{
+    if (bib_dateord_is_empty(dord)) {
+        bib_sortkey_put_byte(key, bib_sortkey_empty);
+        return;
+    }
+    // ordinal values are ordered before dates
+    switch (dord->kind) {
+        case bib_dateord_kind_ordinal:
+            bib_sortkey_put_byte(key, 0x01);
+            bib_sortkey_put_ordinal(key, &(dord->ordinal));
+            break;
+        case bib_dateord_kind_date:
+            bib_sortkey_put_byte(key, 0x02);
+            bib_sortkey_put_date(key, &(dord->date));
+            break;
+    }
+}
+
+static void bib_sortkey_put_cuttseg(bib_sortkey_buf_t *const key, bib_cuttseg_t const *const seg)
+{
+    if (bib_cuttseg_is_empty(seg)) {
+        bib_sortkey_put_byte(key, bib_sortkey_empty);
+        return;
+    }
+    bib_sortkey_put_byte(key, bib_sortkey_present);
+    bib_sortkey_put_byte(key, toupper((unsigned char)seg->cutter.letter));
+    bib_sortkey_put_string(key, seg->cutter.number);
+    bib_sortkey_put_string(key, seg->cutter.mark);
+    bib_sortkey_put_dateord(key, &(seg->dateord));
+}
+
+/// Write a volume or supplement number, which share the same structure and ordering.
+static void bib_sortkey_put_volume(bib_sortkey_buf_t *const key, char const *const prefix, char const *const number,
+                                   bool const hasetc)
+{
+    if (bib_str_is_empty(prefix)) {
+        bib_sortkey_put_byte(key, bib_sortkey_empty);
+        return;
+    }
+    bib_sortkey_put_byte(key, bib_sortkey_present);
+    bib_sortkey_put_string(key, prefix);
+    bib_sortkey_put_string(key, number);
+    bib_sortkey_put_byte(key, (hasetc) ? 0x01 : 0x00);
+}
+
+static void bib_sortkey_put_specification(bib_sortkey_buf_t *const key, bib_lc_specification_t const *const spc)
+{
+    if (bib_lc_specification_is_empty(spc)) {
+        bib_sortkey_put_byte(key, bib_sortkey_empty);
+        return;
+    }
+    // dates are ordered before words, then ordinals, then volumes, then supplements
+    switch (spc->kind) {
+        case bib_lc_specification_kind_date:
+            bib_sortkey_put_byte(key, 0x01);
+            bib_sortkey_put_date(key, &(spc->date));
+            break;
+        case bib_lc_specification_kind_word:
+            bib_sortkey_put_byte(key, 0x02);
+            bib_sortkey_put_string(key, spc->word);
+            break;
+        case bib_lc_specification_kind_ordinal:
+            bib_sortkey_put_byte(key, 0x03);
+            bib_sortkey_put_ordinal(key, &(spc->ordinal));
+            break;
+        case bib_lc_specification_kind_volume:
+            bib_sortkey_put_byte(key, 0x04);
+            bib_sortkey_put_volume(key, spc->volume.prefix, spc->volume.number, spc->volume.hasetc);
+            break;
+        case bib_lc_specification_kind_supplement:
+            bib_sortkey_put_byte(key, 0x05);
+            bib_sortkey_put_volume(key, spc->supplement.prefix, spc->supplement.number, spc->supplement.hasetc);
+            break;
+    }
+}
+
+size_t bib_lc_calln_sortkey(unsigned char *const dst, size_t const len, bib_lc_calln_t const *const num)
+{
+    if (num == NULL) { return 0; }
+    bib_sortkey_buf_t key = { .dst = dst, .len = (dst == NULL) ? 0 : len, .pos = 0 };
+    bib_sortkey_put_string(&key, num->letters);
+    bib_sortkey_put_integer(&key, num->integer);
+    bib_sortkey_put_string(&key, num->decimal);
+    bib_sortkey_put_dateord(&key, &(num->dateord));
+    for (size_t index = 0; index < 3; index += 1) {
+        bib_sortkey_put_cuttseg(&key, &(num->cutters[index]));
+    }
+    for (size_t index = 0; index < 2; index += 1) {
+        bib_sortkey_put_specification(&key, &(num->specifications[index]));
+    }
+    // each remaining specification is tagged so that a shorter list is ordered before a longer one
+    for (size_t index = 0; index < num->remainder.length; index += 1) {
+        bib_sortkey_put_byte(&key, bib_sortkey_present);
+        bib_sortkey_put_specification(&key, &(num->remainder.buffer[index]));
+    }
+    bib_sortkey_put_byte(&key, bib_sortkey_empty);
+    return key.pos;
+}
+
+/// Hash a sort key with the 64-bit FNV-1a algorithm.
+static uint64_t bib_sortkey_hash(unsigned char const *const key, size_t const len)
+{
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for (size_t index = 0; index < len; index += 1) {
+        hash ^= key[index];
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+uint64_t bib_lc_calln_hash(bib_lc_calln_t const *const num)
+{
+    if (num == NULL) { return 0; }
+    unsigned char buffer[256];
+    size_t const len = bib_lc_calln_sortkey(buffer, sizeof(buffer), num);
+    if (len <= sizeof(buffer)) {
+        return bib_sortkey_hash(buffer, len);
+    }
+    unsigned char *const key = malloc(len);
+    size_t __unused _ = bib_lc_calln_sortkey(key, len, num);
+    uint64_t const hash = bib_sortkey_hash(key, len);
+    free(key);
+    return hash;
+}
+
+#pragma mark - lc calln encoding
+
+/// Flags marking the non-empty components of an encoded call number.
+enum {
+    bib_encoding_dateord        = 1 << 0,
+    bib_encoding_cutters        = 1 << 1, // one bit for each of the three cutter segments
+    bib_encoding_specifications = 1 << 4  // one bit for each of the two specification segments
+};
+
+/// A cursor into an encoded call number being decoded.
+typedef struct bib_encoding_buf {
+    unsigned char const *src;
+    size_t len;
+    size_t pos;
+} bib_encoding_buf_t;
+
+/// Write an unsigned integer using seven bits in each byte, with the high bit set on all but the last byte.
+static void bib_encoding_put_varint(bib_sortkey_buf_t *const buf, size_t value)
+{
+    while (value >= 0x80) {
+        bib_sortkey_put_byte(buf, (unsigned char)(value & 0x7F) | 0x80);
+        value >>= 7;
+    }
+    bib_sortkey_put_byte(buf, (unsigned char)value);
+}
+
+/// Write a null-terminated string exactly as it is.
+static void bib_encoding_put_string(bib_sortkey_buf_t *const buf, char const *const str)
+{
+    for (size_t index = 0; str[index] != '\0'; index += 1) {
+        bib_sortkey_put_byte(buf, (unsigned char)str[index]);
+    }
+    bib_sortkey_put_byte(buf, '\0');
+}
+
+static void bib_encoding_put_date(bib_sortkey_buf_t *const buf, bib_date_t const *const date)
+{
+    bib_encoding_put_string(buf, date->year);
+    bib_sortkey_put_byte(buf, (unsigned char)(date->isspan | (date->isdate << 1)));
+    if (date->isdate) {
+        bib_sortkey_put_byte(buf, (unsigned char)date->month);
+        bib_sortkey_put_byte(buf, date->day);
+    } else if (date->isspan) {
+        bib_sortkey_put_byte(buf, (unsigned char)date->separator);
+        bib_encoding_put_string(buf, date->span);
+    }
+    bib_encoding_put_string(buf, date->mark);
+}
+
+static void bib_encoding_put_ordinal(bib_sortkey_buf_t *const buf, bib_ordinal_t const *const ord)
+{
+    bib_encoding_put_string(buf, ord->number);
+    bib_encoding_put_string(buf, ord->suffix);
+}
+
+static void bib_encoding_put_dateord(bib_sortkey_buf_t *const buf, bib_dateord_t const *const dord)
+{
+    bib_sortkey_put_byte(buf, (unsigned char)dord->kind);
+    switch (dord->kind) {
+        case bib_dateord_kind_date: bib_encoding_put_date(buf, &(dord->date)); break;
+        case bib_dateord_kind_ordinal: bib_encoding_put_ordinal(buf, &(dord->ordinal)); break;
+    }
+}
+
+static void bib_encoding_put_cuttseg(bib_sortkey_buf_t *const buf, bib_cuttseg_t const *const seg)
+{
+    bib_sortkey_put_byte(buf, (unsigned char)seg->cutter.letter);
+    bib_encoding_put_string(buf, seg->cutter.number);
+    bib_encoding_put_string(buf, seg->cutter.mark);
+    bib_encoding_put_dateord(buf, &(seg->dateord));
+}
+
+static void bib_encoding_put_specification(bib_sortkey_buf_t *const buf, bib_lc_specification_t const *const spc)
+{
+    bib_sortkey_put_byte(buf, (unsigned char)spc->kind);
+    switch (spc->kind) {
+        case bib_lc_specification_kind_date:
+            bib_encoding_put_date(buf, &(spc->date));
+            break;
+        case bib_lc_specification_kind_ordinal:
+            bib_encoding_put_ordinal(buf, &(spc->ordinal));
+            break;
+        case bib_lc_specification_kind_supplement:
+            bib_encoding_put_string(buf, spc->supplement.prefix);
+            bib_encoding_put_string(buf, spc->supplement.number);
+            bib_sortkey_put_byte(buf, (unsigned char)(spc->supplement.hasetc | (spc->supplement.isabbr << 1)));
+            break;
+        case bib_lc_specification_kind_volume:
+            bib_encoding_put_string(buf, spc->volume.prefix);
+            bib_encoding_put_string(buf, spc->volume.number);
+            bib_sortkey_put_byte(buf, (unsigned char)spc->volume.hasetc);
+            break;
+        case bib_lc_specification_kind_word:
+            bib_encoding_put_string(buf, spc->word);
+            break;
+    }
+}
+
+size_t bib_lc_calln_encode(unsigned char *const dst, size_t const len, bib_lc_calln_t const *const num)
+{
+    if (num == NULL) { return 0; }
+    bib_sortkey_buf_t buf = { .dst = dst, .len = (dst == NULL) ? 0 : len, .pos = 0 };
+    size_t const key_len = bib_lc_calln_sortkey(NULL, 0, num);
+    bib_encoding_put_varint(&buf, key_len);
+    size_t const key_pos = buf.pos;
+    buf.pos += bib_lc_calln_sortkey((key_pos < buf.len) ? buf.dst + key_pos : NULL,
+                                    (key_pos < buf.len) ? buf.len - key_pos : 0, num);
+
+    unsigned char flags = (bib_dateord_is_empty(&(num->dateord))) ? 0 : bib_encoding_dateord;
+    for (size_t index = 0; index < 3; index += 1) {
+        flags |= (bib_cuttseg_is_empty(&(num->cutters[index]))) ? 0 : (bib_encoding_cutters << index);
+    }
+    for (size_t index = 0; index < 2; index += 1) {
+        flags |= (bib_lc_specification_is_empty(&(num->specifications[index])))
+               ? 0 : (bib_encoding_specifications << index);
+    }
+    bib_sortkey_put_byte(&buf, flags);
+    bib_encoding_put_string(&buf, num->letters);
+    bib_encoding_put_string(&buf, num->integer);
+    bib_encoding_put_string(&buf, num->decimal);
+    if (flags & bib_encoding_dateord) {
+        bib_encoding_put_dateord(&buf, &(num->dateord));
+    }
+    for (size_t index = 0; index < 3; index += 1) {
+        if (flags & (bib_encoding_cutters << index)) {
+            bib_encoding_put_cuttseg(&buf, &(num->cutters[index]));
+        }
+    }
+    for (size_t index = 0; index < 2; index += 1) {
+        if (flags & (bib_encoding_specifications << index)) {
+            bib_encoding_put_specification(&buf, &(num->specifications[index]));
+        }
+    }
+    bib_encoding_put_varint(&buf, num->remainder.length);
+    for (size_t index = 0; index < num->remainder.length; index += 1) {
+        bib_encoding_put_specification(&buf, &(num->remainder.buffer[index]));
+    }
+    return buf.pos;
+}
+
+static bool bib_encoding_get_byte(bib_encoding_buf_t *const buf, unsigned char *const byte)
+{
+    if (buf->pos >= buf->len) { return false; }
+    *byte = buf->src[buf->pos];
+    buf->pos += 1;
+    return true;
+}
+
+static bool bib_encoding_get_varint(bib_encoding_buf_t *const buf, size_t *const value)
+{
+    *value = 0;
+    for (size_t shift = 0; shift < sizeof(size_t) * 8; shift += 7) {
+        unsigned char byte = 0;
+        if (!bib_encoding_get_byte(buf, &byte)) { return false; }
+        *value |= (size_t)(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) { return true; }
+    }
+    return false;
+}
+
+/// Read a null-terminated string into a buffer that can hold `size` characters, including the terminator.
+static bool bib_encoding_get_string(bib_encoding_buf_t *const buf, char *const str, size_t const size)
+{
+    for (size_t index = 0; index < size; index += 1) {
+        unsigned char byte = 0;
+        if (!bib_encoding_get_byte(buf, &byte)) { return false; }
+        str[index] = (char)byte;
+        if (byte == '\0') { return true; }
+    }
+    return false;
+}
+
+static bool bib_encoding_get_date(bib_encoding_buf_t *const buf, bib_date_t *const date)
+{
+    unsigned char flags = 0;
+    bool success = bib_encoding_get_string(buf, date->year, sizeof(bib_year_b))
+                && bib_encoding_get_byte(buf, &flags);
+    date->isspan = (flags & 1) != 0;
+    date->isdate = (flags & 2) != 0;
+    if (success && date->isdate) {
+        unsigned char month = 0;
+        success = bib_encoding_get_byte(buf, &month) && bib_encoding_get_byte(buf, &(date->day));
+        date->month = month;
+    } else if (success && date->isspan) {
+        unsigned char separator = 0;
+        success = bib_encoding_get_byte(buf, &separator)
+               && bib_encoding_get_string(buf, date->span, sizeof(bib_year_b));
+        date->separator = (char)separator;
+    }
+    return success && bib_encoding_get_string(buf, date->mark, sizeof(bib_mark_b));
+}
+
+static bool bib_encoding_get_ordinal(bib_encoding_buf_t *const buf, bib_ordinal_t *const ord)
+{
+    return bib_encoding_get_string(buf, ord->number, sizeof(bib_digit16_b))
+        && bib_encoding_get_string(buf, ord->suffix, sizeof(bib_word_b));
+}
+
+static bool bib_encoding_get_dateord(bib_encoding_buf_t *const buf, bib_dateord_t *const dord)
+{
+    unsigned char kind = 0;
+    if (!bib_encoding_get_byte(buf, &kind)) { return false; }
+    dord->kind = kind;
+    switch (kind) {
+        case 0: return true;
+        case bib_dateord_kind_date: return bib_encoding_get_date(buf, &(dord->date));
+        case bib_dateord_kind_ordinal: return bib_encoding_get_ordinal(buf, &(dord->ordinal));
+        default: return false;
+    }
+}
+
+static bool bib_encoding_get_cuttseg(bib_encoding_buf_t *const buf, bib_cuttseg_t *const seg)
+{
+    unsigned char letter = 0;
+    bool const success = bib_encoding_get_byte(buf, &letter)
+                      && bib_encoding_get_string(buf, seg->cutter.number, sizeof(bib_digit16_b))
+                      && bib_encoding_get_string(buf, seg->cutter.mark, sizeof(bib_mark_b))
+                      && bib_encoding_get_dateord(buf, &(seg->dateord));
+    seg->cutter.letter = (char)letter;
+    return success;
+}
+
+static bool bib_encoding_get_specification(bib_encoding_buf_t *const buf, bib_lc_specification_t *const spc)
+{
+    unsigned char kind = 0;
+    unsigned char flags = 0;
+    if (!bib_encoding_get_byte(buf, &kind)) { return false; }
+    spc->kind = kind;
+    switch (kind) {
+        case bib_lc_specification_kind_date:
+            return bib_encoding_get_date(buf, &(spc->date));
+        case bib_lc_specification_kind_ordinal:
+            return bib_encoding_get_ordinal(buf, &(spc->ordinal));
+        case bib_lc_specification_kind_supplement:
+            if (bib_encoding_get_string(buf, spc->supplement.prefix, sizeof(bib_word_b))
+                && bib_encoding_get_string(buf, spc->supplement.number, sizeof(bib_digit16_b))
+                && bib_encoding_get_byte(buf, &flags)) {
+                spc->supplement.hasetc = (flags & 1) != 0;
+                spc->supplement.isabbr = (flags & 2) != 0;
+                return true;
+            }
+            return false;
+        case bib_lc_specification_kind_volume:
+            if (bib_encoding_get_string(buf, spc->volume.prefix, sizeof(bib_word_b))
+                && bib_encoding_get_string(buf, spc->volume.number, sizeof(bib_digit16_b))
+                && bib_encoding_get_byte(buf, &flags)) {
+                spc->volume.hasetc = (flags & 1) != 0;
+                return true;
+            }
+            return false;
+        case bib_lc_specification_kind_word:
+            return bib_encoding_get_string(buf, spc->word, sizeof(bib_longword_b));
+        default:
+            return false;
+    }
+}
+
+bool bib_lc_calln_decode(bib_lc_calln_t *const num, unsigned char const *const src, size_t const len)
+{
+    if (num == NULL || src == NULL) { return false; }
+    memset(num, 0, sizeof(bib_lc_calln_t));
+    bib_encoding_buf_t buf = { .src = src, .len = len, .pos = 0 };
+    size_t key_len = 0;
+    unsigned char flags = 0;
+    bool success = bib_encoding_get_varint(&buf, &key_len) && (key_len <= len - buf.pos);
+    buf.pos += (success) ? key_len : 0;
+    success = success
+           && bib_encoding_get_byte(&buf, &flags)
+           && bib_encoding_get_string(&buf, num->letters, sizeof(bib_alpah03_b))
+           && bib_encoding_get_string(&buf, num->integer, sizeof(bib_digit06_b))
+           && bib_encoding_get_string(&buf, num->decimal, sizeof(bib_digit16_b));
+    if (success && (flags & bib_encoding_dateord)) {
+        success = bib_encoding_get_dateord(&buf, &(num->dateord));
+    }
+    for (size_t index = 0; success && index < 3; index += 1) {
+        if (flags & (bib_encoding_cutters << index)) {
+            success = bib_encoding_get_cuttseg(&buf, &(num->cutters[index]));
+        }
+    }
+    for (size_t index = 0; success && index < 2; index += 1) {
+        if (flags & (bib_encoding_specifications << index)) {
+            success = bib_encoding_get_specification(&buf, &(num->specifications[index]));
+        }
+    }
+    size_t rem_len = 0;
+    success = success && bib_encoding_get_varint(&buf, &rem_len) && (rem_len <= len - buf.pos);
+    for (size_t index = 0; success && index < rem_len; index += 1) {
+        bib_lc_specification_t spc = {};
+        success = bib_encoding_get_specification(&buf, &spc);
+        if (success) {
+            bib_lc_specification_list_append(&(num->remainder), &spc);
+        }
+    }
+    if (success) {
+        num->fingerprint = bib_lc_calln_fingerprint(num);
+    } else {
+        bib_lc_calln_deinit(num);
+    }
+    return success;
+}
+
+unsigned char const *bib_lc_calln_encoded_sortkey(unsigned char const *const src, size_t *const len)
+{
+    bib_encoding_buf_t buf = { .src = src, .len = SIZE_MAX, .pos = 0 };
+    size_t key_len = 0;
+    bool __unused _ = bib_encoding_get_varint(&buf, &key_len);
+    if (len != NULL) {
+        *len = key_len;
+    }
+    return src + buf.pos;
+}
+
+int bib_lc_calln_encoded_compare(unsigned char const *const left, unsigned char const *const right)
+{
+    size_t left_len = 0;
+    size_t right_len = 0;
+    unsigned char const *const left_key = bib_lc_calln_encoded_sortkey(left, &left_len);
+    unsigned char const *const right_key = bib_lc_calln_encoded_sortkey(right, &right_len);
+    int const result = memcmp(left_key, right_key, (left_len < right_len) ? left_len : right_len);
+    return (result != 0) ? result : (left_len > right_len) - (left_len < right_len);
+}
+
+uint64_t bib_lc_calln_encoded_hash(unsigned char const *const src)
+{
+    size_t len = 0;
+    unsigned char const *const key = bib_lc_calln_encoded_sortkey(src, &len);
+    return bib_sortkey_hash(key, len);
+}
+
 #pragma mark - string comparison
 
 static bib_calln_comparison_t bib_string_specify_compare_base(bib_calln_comparison_t status,
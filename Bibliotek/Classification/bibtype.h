@@ -11,8 +11,14 @@
 
 #include <stdlib.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <stdbool.h>
 
+/// Mark a variable as intentionally unused. This is provided by `<sys/cdefs.h>` on Apple platforms.
+#ifndef __unused
+#define __unused __attribute__((unused))
+#endif
+
 __BEGIN_DECLS
 
 #pragma mark -
@@ -208,16 +214,56 @@ extern void bib_lc_specification_init(bib_lc_specification_t *spc, bib_lc_specif
 extern void bib_lc_specification_deinit(bib_lc_specification_t *spc);
 extern bool bib_lc_specification_is_empty(bib_lc_specification_t const *spc);
 
+/// Caller-owned storage for the specification segments of many call numbers.
+///
+/// Lists backed by an arena take their segments from the arena's buffer instead of the heap, and all of those
+/// segments are released together by resetting or discarding the arena. An arena is not thread-safe, and its
+/// buffer must outlive every list that uses it.
+typedef struct bib_lc_specification_arena {
+    /// The caller-owned buffer providing space for specification segments.
+    bib_lc_specification_t *buffer;
+
+    /// The total amount of specification segments that fit in the buffer.
+    size_t capacity;
+
+    /// The amount of specification segments in the buffer given to lists.
+    size_t length;
+} bib_lc_specification_arena_t;
+
+/// Prepare an arena that gives out specification segments from the given buffer.
+/// - parameter arena: The arena to initialize.
+/// - parameter buffer: Caller-owned space for `capacity` specification segments.
+/// - parameter capacity: The amount of specification segments that fit in `buffer`.
+extern void bib_lc_specification_arena_init(bib_lc_specification_arena_t *arena, bib_lc_specification_t *buffer,
+                                            size_t capacity);
+
+/// Release every specification segment given out by the arena at once.
+/// - parameter arena: The arena to reset.
+/// - postcondition: Lists using segments from the arena must no longer be used.
+extern void bib_lc_specification_arena_reset(bib_lc_specification_arena_t *arena);
+
 /// A list of specification segment values.
 typedef struct bib_lc_specification_list {
-    /// The raw heap-allocated buffer containing the heap-allocated segments.
+    /// The raw buffer containing the segments, which is heap-allocated when `arena` is `NULL`.
     bib_lc_specification_t *buffer;
 
     /// The amount of specification segments within this list.
     size_t            length;
+
+    /// The arena providing the storage for `buffer`, or `NULL` when the list owns its buffer.
+    bib_lc_specification_arena_t *arena;
 } bib_lc_specification_list_t;
 
 extern void bib_lc_specification_list_init  (bib_lc_specification_list_t *list);
+
+/// Prepare an empty list whose segments are stored within the given arena.
+/// - parameter list: The list to initialize.
+/// - parameter arena: The arena providing storage for the list, or `NULL` to store segments on the heap.
+///
+/// Segments are moved to the heap when the arena runs out of space.
+extern void bib_lc_specification_list_init_arena(bib_lc_specification_list_t *list,
+                                                 bib_lc_specification_arena_t *arena);
+
 extern void bib_lc_specification_list_append(bib_lc_specification_list_t *list, bib_lc_specification_t *spc);
 extern void bib_lc_specification_list_deinit(bib_lc_specification_list_t *list);
 extern bool bib_lc_specification_list_is_empty(bib_lc_specification_list_t const *list);
@@ -299,11 +345,59 @@ typedef struct bib_lc_calln {
 
     /// The remaining sepcifiation segments.
     bib_lc_specification_list_t remainder;
+
+    /// A packed summary of the subject class letters, integer, and leading decimal digits, used to order most
+    /// call numbers without comparing their strings. This is set when the call number is parsed or decoded,
+    /// and is `0` when it hasn't been calculated. See `bib_lc_calln_fingerprint()`.
+    uint64_t fingerprint;
 } bib_lc_calln_t;
 
 extern bool bib_lc_calln_init  (bib_lc_calln_t *num, char const *str);
 extern void bib_lc_calln_deinit(bib_lc_calln_t *num);
 
+/// Parse a call number whose remaining specification segments are stored within the given arena.
+/// - parameter num: Allocated space for the parsed call number.
+/// - parameter str: The call number string to parse.
+/// - parameter arena: The arena providing storage for the call number's `remainder` list.
+///                    Pass `NULL` to store the list on the heap, as with `bib_lc_calln_init()`.
+/// - returns: `true` when the string is a valid call number.
+/// - postcondition: `num` is valid until `arena` is reset. Calling `bib_lc_calln_deinit()` is unnecessary,
+///                  but remains safe, when the arena doesn't run out of space.
+///
+/// Parsing many call numbers into the same arena avoids heap allocations entirely, and releases the whole
+/// batch at once when the arena is reset.
+extern bool bib_lc_calln_init_arena(bib_lc_calln_t *num, char const *str, bib_lc_specification_arena_t *arena);
+
+/// Parse many call numbers at once, splitting the work across several threads.
+/// - parameter out: Allocated space for `n` call number structures.
+/// - parameter strs: The `n` call number strings to parse. `NULL` entries are treated as invalid call numbers.
+/// - parameter n: The amount of call number strings to parse.
+/// - parameter ok: Allocated space for `n` flags, set to `true` when the string at the same index is parsed.
+///                 Pass `NULL` to ignore individual results.
+/// - parameter threads: The maximum amount of threads used to parse the input.
+///                      Pass `0` to use one thread for each available processor.
+/// - returns: The amount of strings successfully parsed.
+/// - postcondition: Each `out[i]` is the result of `bib_lc_calln_init(&(out[i]), strs[i])`, and must be
+///                  deinitialized with `bib_lc_calln_deinit()` when parsing is successful.
+///
+/// Each thread parses a contiguous run of the input, so results are always written in input order.
+/// Small inputs are parsed on fewer threads, or entirely on the calling thread.
+extern size_t bib_lc_calln_init_batch(bib_lc_calln_t *out, char const *const *strs, size_t n, bool *ok,
+                                      unsigned threads);
+
+/// Sort call numbers in shelf order, splitting the work across several threads.
+/// - parameter arr: The `n` call numbers to sort.
+/// - parameter n: The amount of call numbers in `arr`.
+/// - parameter threads: The maximum amount of threads used to sort the call numbers.
+///                      Pass `0` to use one thread for each available processor.
+/// - returns: `true` when the call numbers are sorted, or `false` when temporary storage can't be allocated,
+///            in which case `arr` is unchanged.
+/// - postcondition: `arr` is ordered by `bib_lc_calln_compare()` without specialization ordering.
+///
+/// The sort is stable, so equivalent call numbers keep their relative order. Call numbers are compared
+/// with `bib_lc_calln_compare()` and each one is moved into its sorted position only once.
+extern bool bib_lc_calln_sort(bib_lc_calln_t *arr, size_t n, unsigned threads);
+
 #pragma mark - lc comparison
 
 /// The ordering relationship between two call number components.
@@ -340,6 +434,106 @@ extern bib_calln_comparison_t bib_lc_calln_compare(bib_calln_comparison_t status
                                                    bib_lc_calln_t const *left, bib_lc_calln_t const *right,
                                                    bool specify);
 
+/// Calculate the prefix fingerprint for the given call number.
+/// - parameter num: The call number to summarize.
+/// - returns: The class letters, integer value, and first seven decimal digits of the call number packed into
+///            a single integer, or `0` when the call number's subject contains unexpected characters.
+///
+/// Fingerprints are ordered the same way as the subject portions of their call numbers, so comparing them
+/// is enough to order two call numbers whose class or subclass differ.
+extern uint64_t bib_lc_calln_fingerprint(bib_lc_calln_t const *num);
+
+/// Get the ordering relationship between two call numbers from their prefix fingerprints alone.
+/// - parameter left: The fingerprint of the call number at the first location.
+/// - parameter right: The fingerprint of the call number at the last location.
+/// - parameter specify: Pass `true` when the comparison should include specialization ordering.
+/// - returns: The result `bib_lc_calln_compare()` would give for the call numbers when starting from
+///            `bib_calln_ordered_same`, or `bib_calln_ordered_same` when the fingerprints aren't enough
+///            to decide the order and the full comparison is needed.
+extern bib_calln_comparison_t bib_lc_calln_fingerprint_compare(uint64_t left, uint64_t right, bool specify);
+
+/// Write a binary sort key for the given call number.
+/// - parameter dst: The buffer that the sort key is written into. This may be `NULL` when `len` is zero.
+/// - parameter len: The size of the `dst` buffer in bytes.
+/// - parameter num: The call number used to create the sort key.
+/// - returns: The total length of the sort key in bytes, which may be larger than `len`.
+/// - postcondition: At most `len` bytes of the sort key are written into `dst`.
+///
+/// Comparing the sort keys of two call numbers with `memcmp`, shorter keys ordered first when one is a
+/// prefix of the other, gives the same ordering as `bib_lc_calln_compare` without specialization ordering.
+/// Call numbers that compare as `bib_calln_ordered_same` have identical sort keys.
+///
+/// Similar to `snprintf`, calling this function with a `NULL` buffer and zero length gets the size needed
+/// to hold the complete key.
+extern size_t bib_lc_calln_sortkey(unsigned char *dst, size_t len, bib_lc_calln_t const *num);
+
+/// Get a hash value for the given call number.
+/// - parameter num: The call number to hash.
+/// - returns: A hash value that is the same for any two call numbers that compare as `bib_calln_ordered_same`
+///            with `bib_lc_calln_compare()` without specialization ordering.
+///
+/// The hash is calculated from the call number's sort key, so it's always equal to the value returned by
+/// `bib_lc_calln_encoded_hash()` for the call number's encoding.
+extern uint64_t bib_lc_calln_hash(bib_lc_calln_t const *num);
+
+#pragma mark - lc calln encoding
+
+/// Write a compact, variable-length encoding of the given call number.
+/// - parameter dst: The buffer that the encoded call number is written into. This may be `NULL` when `len` is zero.
+/// - parameter len: The size of the `dst` buffer in bytes.
+/// - parameter num: The call number to encode.
+/// - returns: The total length of the encoded call number in bytes, which may be larger than `len`.
+/// - postcondition: At most `len` bytes of the encoded call number are written into `dst`.
+///
+/// The encoding begins with the call number's sort key, so encoded call numbers can be ordered without
+/// decoding them, followed by each non-empty component of the call number. Empty components take at most
+/// one byte, which makes the encoding a small fraction of the size of a `bib_lc_calln_t` structure.
+///
+/// Similar to `snprintf`, calling this function with a `NULL` buffer and zero length gets the size needed
+/// to hold the complete encoding.
+extern size_t bib_lc_calln_encode(unsigned char *dst, size_t len, bib_lc_calln_t const *num);
+
+/// Read a call number from its compact encoding.
+/// - parameter num: Allocated space for the decoded call number.
+/// - parameter src: A call number encoded by `bib_lc_calln_encode()`.
+/// - parameter len: The size of the `src` buffer in bytes.
+/// - returns: `true` when `src` contains a complete, well-formed call number encoding.
+/// - postcondition: `num` must be deinitialized with `bib_lc_calln_deinit()` when decoding is successful.
+extern bool bib_lc_calln_decode(bib_lc_calln_t *num, unsigned char const *src, size_t len);
+
+/// Get the sort key embedded at the start of an encoded call number.
+/// - parameter src: A call number encoded by `bib_lc_calln_encode()`.
+/// - parameter len: Set to the length of the sort key in bytes.
+/// - returns: A pointer to the sort key within `src`.
+extern unsigned char const *bib_lc_calln_encoded_sortkey(unsigned char const *src, size_t *len);
+
+/// Get the linear ordering of two encoded call numbers without decoding them.
+/// - parameter left: The call number at the first location, encoded by `bib_lc_calln_encode()`.
+/// - parameter right: The call number at the last location, encoded by `bib_lc_calln_encode()`.
+/// - returns: A negative value when `left` is ordered before `right`, zero when the call numbers are equivalent,
+///            and a positive value when `left` is ordered after `right`.
+///
+/// This is the same ordering given by `bib_lc_calln_compare()` without specialization ordering, where
+/// ascending and specifying results are negative values.
+extern int bib_lc_calln_encoded_compare(unsigned char const *left, unsigned char const *right);
+
+/// Get a hash value for an encoded call number without decoding it.
+/// - parameter src: A call number encoded by `bib_lc_calln_encode()`.
+/// - returns: The same value returned by `bib_lc_calln_hash()` for the decoded call number.
+extern uint64_t bib_lc_calln_encoded_hash(unsigned char const *src);
+
+/// Find the shelf order of encoded call numbers, splitting the work across several threads.
+/// - parameter order: Allocated space for `n` indices, which is set to the indices of `encodings` in sorted order.
+/// - parameter encodings: The `n` call numbers to sort, each encoded by `bib_lc_calln_encode()`.
+/// - parameter n: The amount of call numbers in `encodings`.
+/// - parameter threads: The maximum amount of threads used to sort the call numbers.
+///                      Pass `0` to use one thread for each available processor.
+/// - returns: `true` when the call numbers are sorted, or `false` when temporary storage can't be allocated.
+///
+/// The sort is stable, and uses the ordering given by `bib_lc_calln_encoded_compare()`.
+extern bool bib_lc_calln_encoded_sort(size_t *order, unsigned char const *const *encodings, size_t n,
+                                      unsigned threads);
+
 /// Get the ordering relationship between two cutter segments.
 /// - parameter left: The cutter segment at the first location.
 /// - parameter right: The cutter segment at the last location.
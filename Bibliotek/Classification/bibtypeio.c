@@ -26,6 +26,11 @@ static inline char *restrict strtail(char *restrict str, size_t len, size_t loc)
     return &(str[MIN(MAX(loc, 0), len - 1)]);
 }
 
+/// The amount of space left in a buffer of length `len` after `loc` characters have been written.
+static inline size_t strrem(size_t len, size_t loc) {
+    return (loc < len) ? len - loc : 0;
+}
+
 size_t bib_snprint_cutt(char *restrict const dst, size_t const len, bib_cutter_t  const *restrict const cutt) {
     return bib_cutter_is_empty(cutt)
          ? snprintf(dst, len, "")
@@ -72,7 +77,7 @@ size_t bib_snprint_supl(char *restrict const dst, size_t const len, bib_suppleme
                  : snprintf(dst, len, "%s", supl->prefix);
     if (supl->number[0] != '\0') {
         char const *const suffix = (supl->hasetc) ? ", etc." : "";
-        count += snprintf(strtail(dst, len, count), MAX(len - count, 0), " %s%s", supl->number, suffix);
+        count += snprintf(strtail(dst, len, count), strrem(len, count), " %s%s", supl->number, suffix);
     }
     return count;
 }
@@ -93,14 +98,11 @@ static size_t bib_snprint_cuttseg_(char *restrict const dst, size_t const len,
     if (bib_cuttseg_is_empty(seg)) {
         return snprintf(dst, len, "");
     }
-    if (len == 0 && dst == NULL) {
-        return bib_snprint_cutt(NULL, 0, &(seg->cutter)) + 1 + bib_snprint_dord(NULL, 0, &(seg->dateord));
-    }
     size_t count = 0;
     count += bib_snprint_cutt(dst, len, &(seg->cutter));
     if (!bib_dateord_is_empty(&(seg->dateord))) {
-        count += snprintf(strtail(dst, len, count), MAX(len - count, 0), "%c", style.separator);
-        count += bib_snprint_dord(strtail(dst, len, count), MAX(len - count, 0), &(seg->dateord));
+        count += snprintf(strtail(dst, len, count), strrem(len, count), "%c", style.separator);
+        count += bib_snprint_dord(strtail(dst, len, count), strrem(len, count), &(seg->dateord));
     }
     return count;
 }
@@ -145,16 +147,16 @@ static size_t bib_snprint_cuttseg_lst(char *restrict const dst, size_t const len
         if (!bib_cuttseg_is_empty(seg)) {
             if (needs_period) {
                 if (needs_separator) {
-                    count += snprintf(strtail(dst, len, count), MAX(len - count, 0), "%c.", style.separator);
+                    count += snprintf(strtail(dst, len, count), strrem(len, count), "%c.", style.separator);
                     needs_separator = false;
                 } else {
-                    count += snprintf(strtail(dst, len, count), MAX(len - count, 0), ".");
+                    count += snprintf(strtail(dst, len, count), strrem(len, count), ".");
                 }
                 needs_period = false;
             } else if (needs_separator) {
-                count += snprintf(strtail(dst, len, count), MAX(len - count, 0), "%c", style.separator);
+                count += snprintf(strtail(dst, len, count), strrem(len, count), "%c", style.separator);
             }
-            count += bib_snprint_cuttseg_(strtail(dst, len, count), MAX(len - count, 0), seg, style);
+            count += bib_snprint_cuttseg_(strtail(dst, len, count), strrem(len, count), seg, style);
             bool has_date = !bib_dateord_is_empty(&(seg->dateord));
             needs_separator = style.split_cutters || (has_date && (!style.extra_cutpoint || style.split_sections));
             needs_period = has_date && style.extra_cutpoint;
@@ -174,8 +176,8 @@ static size_t bib_snprint_spfcseg_lst(char *restrict const dst, size_t const len
     for (size_t index = 0; index < seglen; index += 1) {
         bib_lc_specification_t const *restrict const seg = &(seglst[index]);
         if (!bib_lc_specification_is_empty(seg)) {
-            count += snprintf(strtail(dst, len, count), MAX(len - count, 0), "%c", style.separator);
-            count += bib_snprint_spfcseg(strtail(dst, len, count), MAX(len - count, 0), seg);
+            count += snprintf(strtail(dst, len, count), strrem(len, count), "%c", style.separator);
+            count += bib_snprint_spfcseg(strtail(dst, len, count), strrem(len, count), seg);
         }
     }
     return count;
@@ -190,21 +192,36 @@ size_t bib_snprint_lc_calln(char *restrict const dst, size_t const len,
     size_t count = snprintf(dst, len, "%s", calln->letters);
     if (calln->integer[0] != '\0') {
         if (style.split_subject) {
-            count += snprintf(strtail(dst, len, count), MAX(len - count, 0), "%c", style.separator);
+            count += snprintf(strtail(dst, len, count), strrem(len, count), "%c", style.separator);
         }
-        size_t const taillen = MAX(len - count, 0);
+        size_t const taillen = strrem(len, count);
         char *restrict const tail = strtail(dst, len, count);
         count += (calln->decimal[0] == '\0')
                ? snprintf(tail, taillen, "%s", calln->integer)
                : snprintf(tail, taillen, "%s.%s", calln->integer,  calln->decimal);
     }
     if (!bib_dateord_is_empty(&(calln->dateord))) {
-        count += snprintf(strtail(dst, len, count), MAX(len - count, 0), "%c", style.separator);
-        count += bib_snprint_dord(strtail(dst, len, count), MAX(len - count, 0), &(calln->dateord));
+        count += snprintf(strtail(dst, len, count), strrem(len, count), "%c", style.separator);
+        count += bib_snprint_dord(strtail(dst, len, count), strrem(len, count), &(calln->dateord));
     }
-    count += bib_snprint_cuttseg_lst(strtail(dst, len, count), MAX(len - count, 0), calln->cutters, 3, style);
-    count += bib_snprint_spfcseg_lst(strtail(dst, len, count), MAX(len - count, 0), calln->specifications, 2, style);
-    count += bib_snprint_spfcseg_lst(strtail(dst, len, count), MAX(len - count, 0),
+    count += bib_snprint_cuttseg_lst(strtail(dst, len, count), strrem(len, count), calln->cutters, 3, style);
+    count += bib_snprint_spfcseg_lst(strtail(dst, len, count), strrem(len, count), calln->specifications, 2, style);
+    count += bib_snprint_spfcseg_lst(strtail(dst, len, count), strrem(len, count),
                                      calln->remainder.buffer, calln->remainder.length, style);
     return count;
 }
+
+size_t bib_lc_calln_format_batch(char *restrict const dst, size_t const len, size_t *restrict const offsets,
+                                 bib_lc_calln_t const *restrict const callns, size_t const n,
+                                 bib_lc_calln_style_t const style) {
+    size_t count = 0;
+    for (size_t index = 0; index < n; index += 1) {
+        offsets[index] = count;
+        if (count < len) {
+            count += bib_snprint_lc_calln(&(dst[count]), len - count, &(callns[index]), style) + 1;
+        } else {
+            count += bib_snprint_lc_calln(NULL, 0, &(callns[index]), style) + 1;
+        }
+    }
+    return count;
+}
@@ -111,5 +111,22 @@ extern size_t bib_snprint_spfcseg(char *restrict dst, size_t len, bib_lc_specifi
 extern size_t bib_snprint_lc_calln(char *restrict dst, size_t len, bib_lc_calln_t const *restrict calln,
                                    bib_lc_calln_style_t style);
 
+/// Write the string values of many call numbers one after another into the `dst` buffer.
+/// - parameter dst: The buffer to write the call numbers into.
+/// - parameter len: The length of the `dst` buffer.
+/// - parameter offsets: Allocated space for `n` offsets, which are set to the location of each call number's
+///                      string value within the `dst` buffer.
+/// - parameter callns: The `n` call numbers to write into the buffer.
+/// - parameter n: The amount of call numbers to write into the buffer.
+/// - parameter style: The format used for every call number.
+/// - returns: The total length of the values written to the `dst` buffer, including each terminating null character.
+///            When `len` is set to zero and `dst` is set to the `NULL` pointer, the total amount of space
+///            necessary to write every string value is returned, and `offsets` is still set.
+/// - postcondition: Each string value is terminated by a null character. Nothing is written past `len` characters,
+///                  so when the returned length is larger than `len`, the call numbers with an offset beyond
+///                  `len - 1` are missing and the last one written may be truncated.
+extern size_t bib_lc_calln_format_batch(char *restrict dst, size_t len, size_t *restrict offsets,
+                                        bib_lc_calln_t const *restrict callns, size_t n, bib_lc_calln_style_t style);
+
 
 #endif /* bibtypeio_h */
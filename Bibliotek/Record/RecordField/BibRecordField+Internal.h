@@ -0,0 +1,30 @@
+//
+//  BibRecordField+Internal.h
+//  Bibliotek
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+
+#import "BibRecordField.h"
+#import "BibCharacterConversion.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface BibRecordField (Internal)
+
+/// Create a control field whose value is converted from its raw MARC 21 data the first time it's read.
+/// - parameter fieldTag: The tag identifying the control field.
+/// - parameter data: The raw data of the record containing the control field.
+///                   It's kept by the field until its control value has been converted.
+/// - parameter range: The location of the field's control value within `data`.
+/// - parameter encoding: The character encoding of the field's raw control value.
+/// - throws: `NSInvalidArgumentException` when `fieldTag` isn't a control field tag.
+- (instancetype)initWithFieldTag:(BibFieldTag *)fieldTag
+                      recordData:(NSData *)data
+               controlValueRange:(NSRange)range
+                        encoding:(bib_char_encoding_t)encoding;
+
+@end
+
+NS_ASSUME_NONNULL_END
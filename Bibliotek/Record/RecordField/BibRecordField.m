@@ -7,12 +7,15 @@
 //
 
 #import "BibRecordField.h"
+#import "BibRecordField+Internal.h"
 #import "BibFieldTag.h"
 #import "BibFieldIndicator.h"
 #import "Bibliotek+Internal.h"
 #import "BibHasher.h"
 #import "BibSubfield.h"
 
+#import <os/lock.h>
+
 /// Overrides `copyWithZone:` to return `self` as an optimization.
 @interface _BibIRecordField : BibRecordField
 @end
@@ -24,6 +27,12 @@
     BibFieldIndicator *_firstIndicator;
     BibFieldIndicator *_secondIndicator;
     NSArray<BibSubfield *> *_subfields;
+
+    // a raw control value that hasn't been converted yet
+    NSData *_recordData;
+    NSRange _controlValueRange;
+    bib_char_encoding_t _encoding;
+    os_unfair_lock _controlValueLock;
 }
 @end
 
@@ -89,6 +98,18 @@
     return self;
 }
 
+- (NSString *)controlValue {
+    os_unfair_lock_lock(&_controlValueLock);
+    if (_recordData != nil) {
+        char const *const bytes = (char const *)[_recordData bytes] + _controlValueRange.location;
+        _controlValue = bib_char_decode_bytes(_encoding, bytes, _controlValueRange.length);
+        _recordData = nil;
+    }
+    NSString *const controlValue = _controlValue;
+    os_unfair_lock_unlock(&_controlValueLock);
+    return controlValue;
+}
+
 - (BOOL)isControlField {
     return [[self fieldTag] isControlTag];
 }
@@ -152,6 +173,25 @@
 
 @end
 
+#pragma mark - Internal
+
+@implementation BibRecordField (Internal)
+
+- (instancetype)initWithFieldTag:(BibFieldTag *)fieldTag
+                      recordData:(NSData *)data
+               controlValueRange:(NSRange)range
+                        encoding:(bib_char_encoding_t)encoding {
+    if (self = [self initWithFieldTag:fieldTag controlValue:@""]) {
+        _controlValue = nil;
+        _recordData = data;
+        _controlValueRange = range;
+        _encoding = encoding;
+    }
+    return self;
+}
+
+@end
+
 #pragma mark - Equality
 
 @implementation BibRecordField (Equality)
@@ -276,6 +316,7 @@
 }
 
 - (void)setControlValue:(NSString *)controlValue {
+    os_unfair_lock_lock(&_controlValueLock);
     if ([self isControlField]) {
         if (_controlValue != controlValue) {
             _controlValue = [controlValue copy] ?: @"";
@@ -283,6 +324,8 @@
     } else {
         _controlValue = nil;
     }
+    _recordData = nil;
+    os_unfair_lock_unlock(&_controlValueLock);
 }
 
 - (void)setFirstIndicator:(BibFieldIndicator *)firstIndicator {
@@ -0,0 +1,29 @@
+//
+//  BibSubfield+Internal.h
+//  Bibliotek
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+
+#import "BibSubfield.h"
+#import "BibCharacterConversion.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface BibSubfield (Internal)
+
+/// Create a subfield whose content is converted from its raw MARC 21 data the first time it's read.
+/// - parameter subfieldCode: An alphanumeric identifier for semantic purpose of the subfield's content.
+/// - parameter data: The raw data of the record containing the subfield.
+///                   It's kept by the subfield until its content has been converted.
+/// - parameter range: The location of the subfield's content within `data`.
+/// - parameter encoding: The character encoding of the subfield's raw content.
+- (instancetype)initWithCode:(BibSubfieldCode)subfieldCode
+                  recordData:(NSData *)data
+                contentRange:(NSRange)range
+                    encoding:(bib_char_encoding_t)encoding;
+
+@end
+
+NS_ASSUME_NONNULL_END
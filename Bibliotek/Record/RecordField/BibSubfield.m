@@ -7,14 +7,23 @@
 //
 
 #import "BibSubfield.h"
+#import "BibSubfield+Internal.h"
 #import "BibHasher.h"
 
 #import "Bibliotek+Internal.h"
 
+#import <os/lock.h>
+
 @implementation BibSubfield {
 @protected
     BibSubfieldCode _subfieldCode;
     NSString *_content;
+
+    // raw content that hasn't been converted yet
+    NSData *_recordData;
+    NSRange _contentRange;
+    bib_char_encoding_t _encoding;
+    os_unfair_lock _contentLock;
 }
 
 @synthesize subfieldCode = _subfieldCode;
@@ -32,6 +41,18 @@
     return [self initWithCode:@"a" content:@""];
 }
 
+- (NSString *)content {
+    os_unfair_lock_lock(&_contentLock);
+    if (_recordData != nil) {
+        char const *const bytes = (char const *)[_recordData bytes] + _contentRange.location;
+        _content = bib_char_decode_bytes(_encoding, bytes, _contentRange.length);
+        _recordData = nil;
+    }
+    NSString *const content = _content;
+    os_unfair_lock_unlock(&_contentLock);
+    return content;
+}
+
 - (NSString *)description {
     return [NSString stringWithFormat:@"\u2021%@%@", [self subfieldCode], [self content]];
 }
@@ -42,6 +63,25 @@
 
 @end
 
+#pragma mark - Internal
+
+@implementation BibSubfield (Internal)
+
+- (instancetype)initWithCode:(BibSubfieldCode)subfieldCode
+                  recordData:(NSData *)data
+                contentRange:(NSRange)range
+                    encoding:(bib_char_encoding_t)encoding {
+    if (self = [self initWithCode:subfieldCode content:@""]) {
+        _content = nil;
+        _recordData = data;
+        _contentRange = range;
+        _encoding = encoding;
+    }
+    return self;
+}
+
+@end
+
 #pragma mark - Copying
 
 @implementation BibSubfield (Copying)
@@ -109,9 +149,12 @@
 
 @dynamic content;
 - (void)setContent:(NSString *)content {
+    os_unfair_lock_lock(&_contentLock);
     if (_content != content) {
         _content = [content copy];
     }
+    _recordData = nil;
+    os_unfair_lock_unlock(&_contentLock);
 }
 
 @end
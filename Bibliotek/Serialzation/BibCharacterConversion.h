@@ -29,5 +29,28 @@ extern int bib_char_converter_error(bib_char_converter_t converter);
 ///                  returned.
 extern char *bib_char_convert(bib_char_converter_t converter, char const *string);
 
+/// Convert a run of bytes to another encoding, using the given converter.
+/// - parameter converter: The iconv converter handle provided by yaz.
+/// - parameter bytes: A run of characters to represent using an alternate encoding scheme.
+///                    This buffer doesn't need to be null-terminated.
+/// - parameter length: The amount of bytes to convert.
+/// - returns: The null-terminated converted string value of the given bytes. This value must be freed
+///            by the caller. `NULL` is returned when there is an error converting the given bytes.
+extern char *bib_char_convert_bytes(bib_char_converter_t converter, char const *bytes, size_t length);
+
 extern NSString *bib_char_convert_marc8(bib_char_converter_t converter, char const *string) NS_RETURNS_RETAINED;
+extern NSString *bib_char_convert_marc8_bytes(bib_char_converter_t converter,
+                                              char const *bytes, size_t length) NS_RETURNS_RETAINED;
 extern char *bib_char_convert_utf8(bib_char_converter_t converter, NSString *string);
+
+/// Convert a run of bytes to a UTF-8 string, using a converter kept for the calling thread.
+///
+/// Opening a converter is expensive compared to converting a single field's content. Content that's converted
+/// one field at a time, such as the content of lazily decoded records, shares a converter for each thread
+/// instead of opening a new one for every field.
+/// - parameter from: The encoding of the given bytes.
+/// - parameter bytes: A run of characters in the `from` encoding. This buffer doesn't need to be null-terminated.
+/// - parameter length: The amount of bytes to convert.
+/// - returns: A string with the converted characters.
+extern NSString *bib_char_decode_bytes(bib_char_encoding_t from,
+                                       char const *bytes, size_t length) NS_RETURNS_RETAINED;
@@ -8,6 +8,7 @@
 
 #import "BibCharacterConversion.h"
 #import <yaz/yaz-iconv.h>
+#import <pthread.h>
 
 bib_char_encoding_t const bib_char_encoding_utf8 = "utf8";
 bib_char_encoding_t const bib_char_encoding_marc8 = "marc8";
@@ -49,7 +50,8 @@ typedef struct bib_char_conversion_context {
     size_t expansion_factor;
 } bib_char_conversion_context_t;
 
-static void bib_char_conversion_context_init(bib_char_conversion_context_t *context, char const *string);
+static void bib_char_conversion_context_init(bib_char_conversion_context_t *context,
+                                             char const *bytes, size_t length);
 static void bib_char_conversion_context_finalize(bib_char_conversion_context_t *context);
 static void bib_char_conversion_context_expand(bib_char_conversion_context_t *context);
 
@@ -64,9 +66,15 @@ static bool bib_char_converter_handle_error(bib_char_converter_t converter,
 ///            `NULL` is returned when there is an error converting the given string.
 /// - postcondition: Call `yaz_iconv_error()` to get the error code when `NULL` is returned.
 char *bib_char_convert(bib_char_converter_t const converter, char const *const string)
+{
+    // include the null terminator in the conversion
+    return bib_char_convert_bytes(converter, string, strlen(string) + 1);
+}
+
+char *bib_char_convert_bytes(bib_char_converter_t const converter, char const *const bytes, size_t const length)
 {
     bib_char_conversion_context_t context;
-    bib_char_conversion_context_init(&context, string);
+    bib_char_conversion_context_init(&context, bytes, length);
 
     size_t conversion_count;
     do {
@@ -104,6 +112,54 @@ NSString *bib_char_convert_marc8(bib_char_converter_t const converter, char cons
                                         encoding:NSUTF8StringEncoding freeWhenDone:YES];
 }
 
+NSString *bib_char_convert_marc8_bytes(bib_char_converter_t const converter,
+                                       char const *const bytes, size_t const length)
+{
+    char *const result = bib_char_convert_bytes(converter, bytes, length);
+    NSCAssert(result != NULL, @"Error converting MARC8 string to UTF8: %s", strerror(converter->errorno));
+    return [[NSString alloc] initWithBytesNoCopy:result length:strlen(result)
+                                        encoding:NSUTF8StringEncoding freeWhenDone:YES];
+}
+
+/// Converters to UTF-8 that belong to a single thread.
+typedef struct bib_char_thread_converters {
+    bib_char_converter_t marc8;
+    bib_char_converter_t utf8;
+} bib_char_thread_converters_t;
+
+static pthread_key_t bib_char_thread_converters_key;
+
+static void bib_char_thread_converters_destroy(void *const value)
+{
+    bib_char_thread_converters_t *const converters = value;
+    if (converters->marc8 != NULL) {
+        bib_char_converter_close(converters->marc8);
+    }
+    if (converters->utf8 != NULL) {
+        bib_char_converter_close(converters->utf8);
+    }
+    free(converters);
+}
+
+NSString *bib_char_decode_bytes(bib_char_encoding_t const from, char const *const bytes, size_t const length)
+{
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        pthread_key_create(&bib_char_thread_converters_key, bib_char_thread_converters_destroy);
+    });
+    bib_char_thread_converters_t *converters = pthread_getspecific(bib_char_thread_converters_key);
+    if (converters == NULL) {
+        converters = calloc(1, sizeof(bib_char_thread_converters_t));
+        pthread_setspecific(bib_char_thread_converters_key, converters);
+    }
+    bool const isMARC8 = (strcmp(from, bib_char_encoding_marc8) == 0);
+    bib_char_converter_t *const converter = (isMARC8) ? &(converters->marc8) : &(converters->utf8);
+    if (*converter == NULL) {
+        *converter = bib_char_converter_open(bib_char_encoding_utf8, from);
+    }
+    return bib_char_convert_marc8_bytes(*converter, bytes, length);
+}
+
 char *bib_char_convert_utf8(bib_char_converter_t const converter, NSString *const string)
 {
     char *const result = bib_char_convert(converter, [string UTF8String]);
@@ -111,15 +167,15 @@ char *bib_char_convert_utf8(bib_char_converter_t const converter, NSString *cons
     return result;
 }
 
-static void bib_char_conversion_context_init(bib_char_conversion_context_t *const context, char const *const string)
+static void bib_char_conversion_context_init(bib_char_conversion_context_t *const context,
+                                             char const *const bytes, size_t const length)
 {
-    size_t const string_len = strlen(string) + 1;
-
-    context->in_buffer = string;
-    context->in_length = string_len;
+    context->in_buffer = bytes;
+    context->in_length = length;
 
-    context->result_buffer = malloc(string_len);
-    context->result_length = string_len;
+    // leave room for a null terminator, which may not be part of the input
+    context->result_buffer = malloc(length + 1);
+    context->result_length = length + 1;
 
     context->out_buffer = context->result_buffer;
     context->out_length = context->result_length;
@@ -131,7 +187,7 @@ static void bib_char_conversion_context_finalize(bib_char_conversion_context_t *
 {
     // make sure the result is null-terminated
     size_t const final_length = context->result_length - context->out_length;
-    if (context->result_buffer[final_length - 1] != '\0') {
+    if (final_length == 0 || context->result_buffer[final_length - 1] != '\0') {
         if (context->out_length == 0) {
             context->result_buffer = realloc(context->result_buffer, final_length + 1);
             context->result_buffer[final_length] = '\0';
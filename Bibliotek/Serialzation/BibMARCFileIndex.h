@@ -0,0 +1,87 @@
+//
+//  BibMARCFileIndex.h
+//  Bibliotek
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <Bibliotek/BibAttributes.h>
+
+@class BibFieldPath;
+@class BibMARCMappedFile;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A compact index of the records in a MARC 21 file, which is saved in a sidecar file next to it.
+///
+/// The index holds the location and length of every record in the file, so that a ``BibMARCMappedFile`` can be
+/// opened without scanning the whole file for record boundaries. It can also hold a key for each record, such as
+/// its control number in field `001` or its system control numbers in subfield `035$a`. Keys are kept sorted, so
+/// finding a record by its key takes logarithmic time.
+///
+/// Index files are mapped into memory rather than read, so opening an index is fast even for very large files.
+NS_SWIFT_NAME(MARCFileIndex) NS_SWIFT_SENDABLE
+@interface BibMARCFileIndex : NSObject
+
+/// The amount of records in the indexed file.
+@property (nonatomic, readonly) NSUInteger count;
+
+/// The size in bytes of the indexed file when the index was written.
+@property (nonatomic, readonly) unsigned long long fileSize;
+
+/// The control field or subfield from which each record's keys were read,
+/// or `nil` when the index has no keys.
+@property (nonatomic, readonly, copy, nullable) BibFieldPath *keyPath;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Open a record index previously written with ``writeIndexForFile:keyPath:toPath:error:``.
+/// - parameter path: The path of the index file.
+/// - parameter error: A pointer to an `NSError` variable that can be used to return an
+///                    error value when `nil` is returned.
+/// - returns: The index saved at `path`, or `nil` when it can't be read or isn't a record index.
+- (nullable instancetype)initWithContentsOfFile:(NSString *)path
+                                          error:(out NSError *_Nullable __autoreleasing *_Nullable)error
+    NS_DESIGNATED_INITIALIZER;
+
+/// The conventional location of the sidecar index for a MARC 21 file, next to the file itself.
+/// - parameter path: The path of a MARC 21 file, such as `records.mrc`.
+/// - returns: The path of the file's index, such as `records.mrc.idx`.
++ (NSString *)indexPathForFileAtPath:(NSString *)path NS_SWIFT_NAME(indexPath(forFileAt:));
+
+/// Write an index of the records in a mapped MARC 21 file.
+/// - parameter file: The mapped file whose records should be indexed.
+/// - parameter keyPath: A control field, such as `001`, or a subfield, such as `035$a`, whose content is used
+///                      as each record's key. Records have a key for each matching field or subfield, and records
+///                      without any are only indexed by position. Pass `nil` to index records only by position.
+/// - parameter path: The path where the index should be written.
+/// - parameter error: A pointer to an `NSError` variable that can be used to return an
+///                    error value when `NO` is returned.
+/// - returns: `YES` when the index was written successfully.
+/// - throws: `NSInvalidArgumentException` when `keyPath` refers to a data field instead of one of its subfields.
++ (BOOL)writeIndexForFile:(BibMARCMappedFile *)file
+                  keyPath:(nullable BibFieldPath *)keyPath
+                   toPath:(NSString *)path
+                    error:(out NSError *_Nullable __autoreleasing *_Nullable)error;
+
+/// Get the location and length in bytes of the record at the given index.
+/// - parameter index: The index of the record in the indexed file.
+/// - returns: The range of bytes within the indexed file, including the record's leader and record terminator.
+/// - throws: `NSRangeException` when `index` isn't less than ``count``.
+- (NSRange)byteRangeOfRecordAtIndex:(NSUInteger)index;
+
+/// Find the first record with the given key.
+/// - parameter key: The key of the record. Leading and trailing spaces are ignored.
+/// - returns: The index of the first record in the file with the given key, or `NSNotFound` when no record has it.
+- (NSUInteger)indexOfRecordWithKey:(NSString *)key NS_SWIFT_NAME(indexOfRecord(withKey:));
+
+/// Find all of the records with the given key.
+/// - parameter key: The key of the records. Leading and trailing spaces are ignored.
+/// - returns: The indexes of every record in the file with the given key.
+- (NSIndexSet *)indexesOfRecordsWithKey:(NSString *)key NS_SWIFT_NAME(indexesOfRecords(withKey:));
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,363 @@
+//
+//  BibMARCFileIndex.m
+//  Bibliotek
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+
+#import "BibMARCFileIndex.h"
+#import "BibMARCMappedFile.h"
+#import "BibFieldPath.h"
+#import "BibFieldTag.h"
+#import "BibSerializationError.h"
+#import "BibCharacterConversion.h"
+#import "BibMarcIO.h"
+
+#define BibAssert(condition, exception, message, ...) ({ \
+    if (!(condition)) { \
+        [NSException raise:exception format:message, ## __VA_ARGS__]; \
+    } \
+})
+
+#pragma mark - File Format
+
+/// The header at the start of an index file.
+///
+/// The header is followed by a record entry for each record, a key entry for each key sorted by the key's bytes,
+/// and finally the UTF-8 bytes of every key. All integers are stored in little-endian byte order.
+typedef struct BibMARCFileIndexHeader {
+    char     magic[8];
+    uint32_t version;
+    char     keyTag[3]; // All zeros when the index has no keys.
+    char     keyCode;   // Zero when keys are read from control fields.
+    uint64_t recordCount;
+    uint64_t keyCount;
+    uint64_t fileSize;
+    uint64_t keyBytesLength;
+} BibMARCFileIndexHeader;
+
+/// The location of a record within the indexed file.
+typedef struct BibMARCFileIndexRecordEntry {
+    uint64_t location;
+    uint32_t length;
+    uint32_t reserved;
+} BibMARCFileIndexRecordEntry;
+
+/// A key and the index of the record it belongs to.
+typedef struct BibMARCFileIndexKeyEntry {
+    uint64_t keyLocation; // Location of the key relative to the start of the key bytes.
+    uint32_t keyLength;
+    uint32_t recordIndex;
+} BibMARCFileIndexKeyEntry;
+
+_Static_assert(sizeof(BibMARCFileIndexHeader) == 48, "index headers must be tightly packed");
+_Static_assert(sizeof(BibMARCFileIndexRecordEntry) == 16, "record entries must be tightly packed");
+_Static_assert(sizeof(BibMARCFileIndexKeyEntry) == 16, "key entries must be tightly packed");
+
+static char const BibMARCFileIndexMagic[8] = { 'B', 'i', 'b', 'M', 'A', 'R', 'C', 'x' };
+static uint32_t const BibMARCFileIndexVersion = 1;
+
+static NSError *BibMARCFileIndexMakeMalformedDataError(NSString *path);
+
+#pragma mark - Keys
+
+/// Remove leading and trailing spaces from a key.
+static BibMarcSlice BibMARCFileIndexTrimKey(BibMarcSlice key) {
+    while (key.length > 0 && key.bytes[0] == ' ') {
+        key.bytes += 1;
+        key.length -= 1;
+    }
+    while (key.length > 0 && key.bytes[key.length - 1] == ' ') {
+        key.length -= 1;
+    }
+    return key;
+}
+
+/// Compare the bytes of two keys, where shorter keys are ordered before longer keys with the same prefix.
+static int BibMARCFileIndexCompareKeys(uint8_t const *left, size_t leftLength,
+                                       uint8_t const *right, size_t rightLength) {
+    int const result = memcmp(left, right, MIN(leftLength, rightLength));
+    if (result != 0) {
+        return result;
+    }
+    return (leftLength < rightLength) ? -1 : (leftLength > rightLength) ? 1 : 0;
+}
+
+@implementation BibMARCFileIndex {
+    NSData *_data;
+    BibMARCFileIndexRecordEntry const *_records;
+    BibMARCFileIndexKeyEntry const *_keys;
+    NSUInteger _keyCount;
+    uint8_t const *_keyBytes;
+    uint64_t _keyBytesLength;
+}
+
+- (instancetype)init {
+    [self doesNotRecognizeSelector:_cmd];
+    return nil;
+}
+
+- (instancetype)initWithContentsOfFile:(NSString *)path error:(out NSError *__autoreleasing *)error {
+    if (self = [super init]) {
+        _data = [NSData dataWithContentsOfFile:path options:NSDataReadingMappedIfSafe error:error];
+        if (_data == nil) {
+            return nil;
+        }
+        uint8_t const *const bytes = [_data bytes];
+        NSUInteger const length = [_data length];
+        BibMARCFileIndexHeader header;
+        if (length < sizeof(header)) {
+            if (error != NULL) {
+                *error = BibMARCFileIndexMakeMalformedDataError(path);
+            }
+            return nil;
+        }
+        memcpy(&header, bytes, sizeof(header));
+        uint64_t const recordCount = NSSwapLittleLongLongToHost(header.recordCount);
+        uint64_t const keyCount = NSSwapLittleLongLongToHost(header.keyCount);
+        uint64_t const keyBytesLength = NSSwapLittleLongLongToHost(header.keyBytesLength);
+        uint64_t const tablesLength = length - sizeof(header);
+        if (memcmp(header.magic, BibMARCFileIndexMagic, sizeof(header.magic)) != 0
+            || NSSwapLittleIntToHost(header.version) != BibMARCFileIndexVersion
+            || recordCount > tablesLength / sizeof(BibMARCFileIndexRecordEntry)
+            || keyCount > tablesLength / sizeof(BibMARCFileIndexKeyEntry)
+            || (recordCount + keyCount) * 16 > tablesLength
+            || tablesLength - (recordCount + keyCount) * 16 != keyBytesLength) {
+            if (error != NULL) {
+                *error = BibMARCFileIndexMakeMalformedDataError(path);
+            }
+            return nil;
+        }
+        _count = (NSUInteger)recordCount;
+        _keyCount = (NSUInteger)keyCount;
+        _fileSize = NSSwapLittleLongLongToHost(header.fileSize);
+        _records = (BibMARCFileIndexRecordEntry const *)(bytes + sizeof(header));
+        _keys = (BibMARCFileIndexKeyEntry const *)(_records + _count);
+        _keyBytes = (uint8_t const *)(_keys + _keyCount);
+        _keyBytesLength = keyBytesLength;
+        if (header.keyTag[0] != '\0') {
+            NSString *const tagString = [[NSString alloc] initWithBytes:header.keyTag
+                                                                 length:sizeof(header.keyTag)
+                                                               encoding:NSASCIIStringEncoding];
+            BibFieldTag *const tag = [[BibFieldTag alloc] initWithString:tagString];
+            if (tag == nil) {
+                if (error != NULL) {
+                    *error = BibMARCFileIndexMakeMalformedDataError(path);
+                }
+                return nil;
+            }
+            _keyPath = (header.keyCode == '\0')
+                     ? [[BibFieldPath alloc] initWithFieldTag:tag]
+                     : [[BibFieldPath alloc] initWithFieldTag:tag
+                                                 subfieldCode:[NSString stringWithFormat:@"%c", header.keyCode]];
+        }
+    }
+    return self;
+}
+
++ (NSString *)indexPathForFileAtPath:(NSString *)path {
+    return [path stringByAppendingPathExtension:@"idx"];
+}
+
+#pragma mark - Lookup
+
+- (NSRange)byteRangeOfRecordAtIndex:(NSUInteger)index {
+    BibAssert(index < _count, NSRangeException, @"-[%@ %s]: index %lu beyond bounds (0 ..< %lu)",
+              [self className], sel_getName(_cmd), (unsigned long)index, (unsigned long)_count);
+    BibMARCFileIndexRecordEntry const *const entry = &(_records[index]);
+    return NSMakeRange((NSUInteger)NSSwapLittleLongLongToHost(entry->location), NSSwapLittleIntToHost(entry->length));
+}
+
+/// Compare the key at the given position in the sorted key table with another key.
+- (int)compareKeyAtIndex:(NSUInteger)index withKey:(BibMarcSlice)key {
+    BibMARCFileIndexKeyEntry const *const entry = &(_keys[index]);
+    uint64_t const location = NSSwapLittleLongLongToHost(entry->keyLocation);
+    uint64_t length = NSSwapLittleIntToHost(entry->keyLength);
+    if (location > _keyBytesLength || length > _keyBytesLength - location) {
+        // treat keys that point outside of the index's data as empty
+        length = 0;
+    }
+    return BibMARCFileIndexCompareKeys(_keyBytes + ((length > 0) ? location : 0), (size_t)length,
+                                       (uint8_t const *)key.bytes, key.length);
+}
+
+/// Find the position in the sorted key table of the first key that isn't ordered before the given key.
+- (NSUInteger)lowerBoundOfKey:(BibMarcSlice)key {
+    NSUInteger lower = 0;
+    NSUInteger upper = _keyCount;
+    while (lower < upper) {
+        NSUInteger const middle = lower + (upper - lower) / 2;
+        if ([self compareKeyAtIndex:middle withKey:key] < 0) {
+            lower = middle + 1;
+        } else {
+            upper = middle;
+        }
+    }
+    return lower;
+}
+
+- (NSUInteger)indexOfRecordWithKey:(NSString *)key {
+    char const *const string = [key UTF8String];
+    BibMarcSlice const slice = BibMARCFileIndexTrimKey((BibMarcSlice){ (int8_t const *)string, strlen(string) });
+    NSUInteger const position = [self lowerBoundOfKey:slice];
+    if (position < _keyCount && [self compareKeyAtIndex:position withKey:slice] == 0) {
+        return NSSwapLittleIntToHost(_keys[position].recordIndex);
+    }
+    return NSNotFound;
+}
+
+- (NSIndexSet *)indexesOfRecordsWithKey:(NSString *)key {
+    char const *const string = [key UTF8String];
+    BibMarcSlice const slice = BibMARCFileIndexTrimKey((BibMarcSlice){ (int8_t const *)string, strlen(string) });
+    NSMutableIndexSet *const indexes = [NSMutableIndexSet indexSet];
+    for (NSUInteger position = [self lowerBoundOfKey:slice];
+         position < _keyCount && [self compareKeyAtIndex:position withKey:slice] == 0;
+         position += 1) {
+        [indexes addIndex:NSSwapLittleIntToHost(_keys[position].recordIndex)];
+    }
+    return [indexes copy];
+}
+
+#pragma mark - Writing
+
+/// Add a key for the record at the given index, converting it to UTF-8 when it's encoded with MARC-8.
+static void BibMARCFileIndexAddKey(NSMutableData *const keys, NSMutableData *const keyBytes, BibMarcSlice key,
+                                   uint32_t const recordIndex, bib_char_converter_t _Nullable const converter) {
+    key = BibMARCFileIndexTrimKey(key);
+    if (key.length == 0) {
+        return;
+    }
+    BibMARCFileIndexKeyEntry entry = {
+        .keyLocation = NSSwapHostLongLongToLittle([keyBytes length]),
+        .recordIndex = NSSwapHostIntToLittle(recordIndex)
+    };
+    BOOL ascii = YES;
+    for (size_t index = 0; index < key.length && ascii; index += 1) {
+        ascii = ((uint8_t)key.bytes[index] < 0x80);
+    }
+    if (ascii || converter == NULL) {
+        [keyBytes appendBytes:key.bytes length:key.length];
+        entry.keyLength = NSSwapHostIntToLittle((uint32_t)key.length);
+    } else {
+        char *const converted = bib_char_convert_bytes(converter, (char const *)key.bytes, key.length);
+        if (converted == NULL) {
+            return;
+        }
+        size_t const length = strlen(converted);
+        [keyBytes appendBytes:converted length:length];
+        entry.keyLength = NSSwapHostIntToLittle((uint32_t)length);
+        free(converted);
+    }
+    [keys appendBytes:&entry length:sizeof(entry)];
+}
+
++ (BOOL)writeIndexForFile:(BibMARCMappedFile *)file
+                  keyPath:(BibFieldPath *)keyPath
+                   toPath:(NSString *)path
+                    error:(out NSError *__autoreleasing *)error {
+    BibAssert(keyPath == nil || [keyPath isControlFieldPath] || [keyPath isSubfieldPath], NSInvalidArgumentException,
+              @"+[%@ %s]: key path %@ must refer to a control field or a subfield",
+              [self className], sel_getName(_cmd), keyPath);
+    BibMARCFileIndexHeader header = {
+        .version = NSSwapHostIntToLittle(BibMARCFileIndexVersion),
+        .recordCount = NSSwapHostLongLongToLittle([file count]),
+        .fileSize = NSSwapHostLongLongToLittle([file fileSize])
+    };
+    memcpy(header.magic, BibMARCFileIndexMagic, sizeof(header.magic));
+    if (keyPath != nil) {
+        memcpy(header.keyTag, [[[keyPath fieldTag] stringValue] UTF8String], sizeof(header.keyTag));
+        header.keyCode = ([keyPath isSubfieldPath]) ? [[keyPath subfieldCode] UTF8String][0] : '\0';
+    }
+
+    NSUInteger const count = [file count];
+    NSMutableData *const records = [NSMutableData dataWithLength:count * sizeof(BibMARCFileIndexRecordEntry)];
+    NSMutableData *const keys = [NSMutableData data];
+    NSMutableData *const keyBytes = [NSMutableData data];
+    BibMARCFileIndexRecordEntry *const recordEntries = [records mutableBytes];
+    bib_char_converter_t converter = NULL;
+    BibMarcRecordView view = {};
+    for (NSUInteger index = 0; index < count; index += 1) {
+        NSRange const range = [file byteRangeOfRecordAtIndex:index];
+        recordEntries[index] = (BibMARCFileIndexRecordEntry){
+            .location = NSSwapHostLongLongToLittle(range.location),
+            .length = NSSwapHostIntToLittle((uint32_t)range.length)
+        };
+        if (keyPath == nil) {
+            continue;
+        }
+        @autoreleasepool {
+            NSData *const data = [file dataForRecordAtIndex:index];
+            if (BibMarcRecordViewRead(&view, [data bytes], [data length]) == 0) {
+                continue;
+            }
+            bib_char_converter_t keyConverter = NULL;
+            if (view.leader.recordEncoding != 'a') {
+                if (converter == NULL) {
+                    converter = bib_char_converter_open(bib_char_encoding_utf8, bib_char_encoding_marc8);
+                }
+                keyConverter = converter;
+            }
+            for (size_t fieldIndex = 0; fieldIndex < view.fieldsCount; fieldIndex += 1) {
+                BibMarcFieldView const *const field = &(view.fields[fieldIndex]);
+                if (memcmp(field->tag, header.keyTag, sizeof(header.keyTag)) != 0) {
+                    continue;
+                }
+                if (header.keyCode == '\0') {
+                    BibMarcSlice const content = BibMarcFieldViewGetContent(&view, field);
+                    BibMARCFileIndexAddKey(keys, keyBytes, content, (uint32_t)index, keyConverter);
+                    continue;
+                }
+                BibMarcSubfieldView const *const subfields = BibMarcFieldViewGetSubfields(&view, field);
+                for (size_t subfieldIndex = 0; subfieldIndex < field->subfieldsCount; subfieldIndex += 1) {
+                    BibMarcSubfieldView const *const subfield = &(subfields[subfieldIndex]);
+                    if (subfield->code == header.keyCode) {
+                        BibMarcSlice const content = BibMarcSubfieldViewGetContent(&view, subfield);
+                        BibMARCFileIndexAddKey(keys, keyBytes, content, (uint32_t)index, keyConverter);
+                    }
+                }
+            }
+        }
+    }
+    BibMarcRecordViewDestroy(&view);
+    if (converter != NULL) {
+        bib_char_converter_close(converter);
+    }
+
+    // sort keys by their bytes, and then by the position of their record in the file
+    NSUInteger const keyCount = [keys length] / sizeof(BibMARCFileIndexKeyEntry);
+    uint8_t const *const keyBuffer = [keyBytes bytes];
+    qsort_b([keys mutableBytes], keyCount, sizeof(BibMARCFileIndexKeyEntry), ^int(void const *lhs, void const *rhs) {
+        BibMARCFileIndexKeyEntry const *const left = lhs;
+        BibMARCFileIndexKeyEntry const *const right = rhs;
+        int const result = BibMARCFileIndexCompareKeys(keyBuffer + NSSwapLittleLongLongToHost(left->keyLocation),
+                                                       NSSwapLittleIntToHost(left->keyLength),
+                                                       keyBuffer + NSSwapLittleLongLongToHost(right->keyLocation),
+                                                       NSSwapLittleIntToHost(right->keyLength));
+        if (result != 0) {
+            return result;
+        }
+        uint32_t const leftIndex = NSSwapLittleIntToHost(left->recordIndex);
+        uint32_t const rightIndex = NSSwapLittleIntToHost(right->recordIndex);
+        return (leftIndex < rightIndex) ? -1 : (leftIndex > rightIndex) ? 1 : 0;
+    });
+    header.keyCount = NSSwapHostLongLongToLittle(keyCount);
+    header.keyBytesLength = NSSwapHostLongLongToLittle([keyBytes length]);
+
+    NSMutableData *const output = [NSMutableData dataWithBytes:&header length:sizeof(header)];
+    [output appendData:records];
+    [output appendData:keys];
+    [output appendData:keyBytes];
+    return [output writeToFile:path options:NSDataWritingAtomic error:error];
+}
+
+@end
+
+#pragma mark - Errors
+
+static NSError *BibMARCFileIndexMakeMalformedDataError(NSString *const path) {
+    return [NSError errorWithDomain:BibSerializationErrorDomain
+                               code:BibSerializationMalformedDataError
+                           userInfo:@{ NSFilePathErrorKey : path,
+                                       NSDebugDescriptionErrorKey : @"The file isn't a MARC 21 record index" }];
+}
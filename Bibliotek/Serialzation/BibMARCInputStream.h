@@ -9,6 +9,7 @@
 #import <Foundation/Foundation.h>
 #import <Bibliotek/BibAttributes.h>
 #import <Bibliotek/BibRecordInputStream.h>
+#import <Bibliotek/BibMARCSerialization.h>
 
 @class BibRecord;
 
@@ -18,6 +19,22 @@ NS_ASSUME_NONNULL_BEGIN
 NS_SWIFT_NAME(MARCInputStream)
 @interface BibMARCInputStream : BibRecordInputStream
 
+/// Options for decoding each record read from the stream.
+///
+/// The default value is no options.
+@property (nonatomic, assign) BibMARCReadingOptions readingOptions;
+
+/// The field tags or field paths of the only fields that should be decoded from each record.
+///
+/// Fields whose tags aren't in the filter are skipped using the record's directory, without reading their subfields,
+/// converting their content, or creating any objects for them. Records read from the stream contain only the fields
+/// in the filter, and their leaders are left unchanged. A field path selects its entire field.
+///
+/// The default value is `nil`, which decodes every field.
+/// - throws: `NSInvalidArgumentException` when the set contains an object that is neither
+///           a ``BibFieldTag`` nor a ``BibFieldPath``.
+@property (nonatomic, copy, nullable) NSSet *fieldFilter;
+
 /// Initializes and returns a ``BibMARCInputStream`` for reading from the given input stream.
 /// - parameter inputStream: The `NSInputStream` object from which record data should be read.
 /// - returns: An initialized ``BibMARCInputStream`` object that reads ``BibRecord`` objects
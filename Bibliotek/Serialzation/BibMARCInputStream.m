@@ -8,6 +8,9 @@
 
 #import "BibMARCInputStream.h"
 #import "BibMARCSerialization.h"
+#import "BibMARCSerialization+Internal.h"
+#import "BibFieldPath.h"
+#import "BibFieldTag.h"
 #import <Bibliotek/Bibliotek+Internal.h>
 
 NSErrorDomain const BibMARCInputStreamErrorDomain = @"BibMARCInputStreamErrorDomain";
@@ -16,6 +19,8 @@ NSErrorDomain const BibMARCInputStreamErrorDomain = @"BibMARCInputStreamErrorDom
     NSInputStream *_inputStream;
     NSStreamStatus _streamStatus;
     NSError *_streamError;
+    BibMARCSerializationBuffer _buffer;
+    BibMarcFieldFilter _filter;
 }
 
 - (instancetype)initWithInputStream:(NSInputStream *)inputStream {
@@ -29,6 +34,27 @@ NSErrorDomain const BibMARCInputStreamErrorDomain = @"BibMARCInputStreamErrorDom
 
 - (void)dealloc {
     [_inputStream close];
+    BibMARCSerializationBufferDestroy(&_buffer);
+}
+
+- (void)setFieldFilter:(NSSet *)fieldFilter {
+    BibMarcFieldFilter filter = {};
+    for (id object in fieldFilter) {
+        BibFieldTag *fieldTag = nil;
+        if ([object isKindOfClass:[BibFieldTag class]]) {
+            fieldTag = object;
+        } else if ([object isKindOfClass:[BibFieldPath class]]) {
+            fieldTag = [object fieldTag];
+        } else {
+            [NSException raise:NSInvalidArgumentException
+                        format:@"-[%@ %s]: %@ is neither a field tag nor a field path",
+                                [self className], sel_getName(_cmd), object];
+        }
+        BibMarcFieldFilterAddTag(&filter, [[fieldTag stringValue] UTF8String]);
+    }
+    _fieldFilter = [fieldFilter copy];
+    _filter = filter;
+    _buffer.view.filter = (_fieldFilter != nil) ? &_filter : NULL;
 }
 
 - (NSStreamStatus)streamStatus {
@@ -72,7 +98,10 @@ NSErrorDomain const BibMARCInputStreamErrorDomain = @"BibMARCInputStreamErrorDom
         return nil;
     }
     NSError *err = nil;
-    BibRecord *const record = [BibMARCSerialization recordFromStream:_inputStream error:&err];
+    BibRecord *const record = [BibMARCSerialization recordFromStream:_inputStream
+                                                              buffer:&_buffer
+                                                             options:_readingOptions
+                                                               error:&err];
     if (record == nil) {
         _streamStatus = (err == nil) ? NSStreamStatusError : NSStreamStatusAtEnd;
         _streamError = err;
@@ -0,0 +1,112 @@
+//
+//  BibMARCMappedFile.h
+//  Bibliotek
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <Bibliotek/BibAttributes.h>
+
+@class BibRecord;
+@class BibMARCFileIndex;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A file of MARC 21 records mapped into memory, with random access to each of its records.
+///
+/// The file is mapped read-only instead of being read through an input stream, so records are decoded
+/// straight from the mapped pages without copying the file's data. Opening a mapped file finds the location
+/// of every record using the record lengths in their leaders, so records can then be decoded in any order.
+///
+/// Mapped files are immutable, and records can be decoded from multiple threads at the same time.
+/// This makes it possible to hand different ranges of a large file's records to different workers.
+NS_SWIFT_NAME(MARCMappedFile) NS_SWIFT_SENDABLE
+@interface BibMARCMappedFile : NSObject <NSFastEnumeration>
+
+/// The path of the mapped file.
+@property (nonatomic, copy, readonly) NSString *path;
+
+/// The amount of records in the file.
+@property (nonatomic, readonly) NSUInteger count;
+
+/// The size of the file in bytes.
+@property (nonatomic, readonly) unsigned long long fileSize;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Map the file at the given path into memory, and find the location of each of its records.
+/// - parameter path: The path to a file of MARC 21 encoded records.
+/// - parameter error: A pointer to an `NSError` variable that can be used to return an
+///                    error value when `nil` is returned.
+/// - returns: A mapped file with the records in the file at `path`. Otherwise, `nil` is returned when
+///            the file can't be opened or mapped, or when it doesn't contain MARC 21 records.
+- (nullable instancetype)initWithFileAtPath:(NSString *)path
+                                      error:(out NSError *_Nullable __autoreleasing *_Nullable)error
+    NS_DESIGNATED_INITIALIZER;
+
+/// Map the file at the given path into memory, using a previously written index to find its records.
+///
+/// The file isn't scanned for record boundaries, so opening a large file with an index takes a constant amount
+/// of time instead of reading through every page of the file.
+/// - parameter path: The path to a file of MARC 21 encoded records.
+/// - parameter index: An index of the records in the file at `path`.
+/// - parameter error: A pointer to an `NSError` variable that can be used to return an
+///                    error value when `nil` is returned.
+/// - returns: A mapped file with the records in the file at `path`. Otherwise, `nil` is returned when
+///            the file can't be opened or mapped, or when its size doesn't match the size recorded in `index`.
+- (nullable instancetype)initWithFileAtPath:(NSString *)path
+                                      index:(BibMARCFileIndex *)index
+                                      error:(out NSError *_Nullable __autoreleasing *_Nullable)error
+    NS_DESIGNATED_INITIALIZER;
+
+/// Map the file at the given URL into memory, and find the location of each of its records.
+/// - parameter url: The file URL of a file of MARC 21 encoded records.
+/// - parameter error: A pointer to an `NSError` variable that can be used to return an
+///                    error value when `nil` is returned.
+/// - returns: A mapped file with the records in the file at `url`. Otherwise, `nil` is returned when
+///            the file can't be opened or mapped, or when it doesn't contain MARC 21 records.
+- (nullable instancetype)initWithURL:(NSURL *)url error:(out NSError *_Nullable __autoreleasing *_Nullable)error;
+
+/// Decode the record at the given index.
+/// - parameter index: The index of the record in the file.
+/// - returns: The record at `index`, or `nil` when its data is malformed.
+/// - throws: `NSRangeException` when `index` isn't less than ``count``.
+- (nullable BibRecord *)recordAtIndex:(NSUInteger)index;
+
+/// Decode the record at the given index.
+/// - parameter index: The index of the record in the file.
+/// - parameter error: A pointer to an `NSError` variable that can be used to return an
+///                    error value when `nil` is returned.
+/// - returns: The record at `index`, or `nil` when its data is malformed.
+/// - throws: `NSRangeException` when `index` isn't less than ``count``.
+- (nullable BibRecord *)recordAtIndex:(NSUInteger)index
+                                error:(out NSError *_Nullable __autoreleasing *_Nullable)error;
+
+/// Get the location and length in bytes of the record at the given index.
+/// - parameter index: The index of the record in the file.
+/// - returns: The range of bytes within the file, including the record's leader and record terminator.
+/// - throws: `NSRangeException` when `index` isn't less than ``count``.
+- (NSRange)byteRangeOfRecordAtIndex:(NSUInteger)index;
+
+/// Get the raw MARC 21 data of the record at the given index, without copying it.
+/// - parameter index: The index of the record in the file.
+/// - returns: A data object that refers to the record's bytes in the mapped file.
+///            The file stays mapped for as long as the data object is in use.
+/// - throws: `NSRangeException` when `index` isn't less than ``count``.
+- (NSData *)dataForRecordAtIndex:(NSUInteger)index;
+
+/// Decode each of the records within the given range of indexes.
+/// - parameter range: The indexes of the records in the file.
+/// - parameter block: A block called with each record and its index, in order.
+///                    Records with malformed data are skipped.
+///                    Set `stop` to `YES` to stop enumerating records.
+/// - throws: `NSRangeException` when `range` extends past ``count``.
+- (void)enumerateRecordsInRange:(NSRange)range
+                     usingBlock:(void (NS_NOESCAPE ^)(BibRecord *record, NSUInteger index, BOOL *stop))block
+    NS_SWIFT_NAME(enumerateRecords(in:using:));
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,327 @@
+//
+//  BibMARCMappedFile.m
+//  Bibliotek
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+
+#import "BibMARCMappedFile.h"
+#import "BibMARCFileIndex.h"
+#import "BibMARCSerialization+Internal.h"
+#import "BibSerializationError.h"
+#import "BibLeader.h"
+
+#import <fcntl.h>
+#import <sys/mman.h>
+#import <sys/stat.h>
+#import <unistd.h>
+
+#define BibAssert(condition, exception, message, ...) ({ \
+    if (!(condition)) { \
+        [NSException raise:exception format:message, ## __VA_ARGS__]; \
+    } \
+})
+
+static uint8_t const BibMARCMappedFileRecordTerminator = 0x1D;
+
+/// The most records decoded for each call to `-countByEnumeratingWithState:objects:count:`.
+static NSUInteger const BibMARCMappedFileEnumerationBatchSize = 16;
+
+static NSError *BibMARCMappedFileMakePOSIXError(NSString *path);
+static NSError *BibMARCMappedFileMakeMalformedDataError(NSString *path);
+static NSError *BibMARCMappedFileMakeOutdatedIndexError(NSString *path);
+
+@implementation BibMARCMappedFile {
+    uint8_t const *_bytes;
+    uint64_t *_locations;
+    uint32_t *_lengths;
+    NSUInteger _capacity;
+    BibMARCFileIndex *_index;
+}
+
+- (instancetype)init {
+    [self doesNotRecognizeSelector:_cmd];
+    return nil;
+}
+
+- (instancetype)initWithURL:(NSURL *)url error:(out NSError *__autoreleasing *)error {
+    return [self initWithFileAtPath:[url path] error:error];
+}
+
+- (instancetype)initWithFileAtPath:(NSString *)path error:(out NSError *__autoreleasing *)error {
+    if (self = [super init]) {
+        _path = [path copy];
+        if (![self mapFileWithError:error]) {
+            return nil;
+        }
+        if (![self indexRecords]) {
+            if (error != NULL) {
+                *error = BibMARCMappedFileMakeMalformedDataError(path);
+            }
+            return nil;
+        }
+    }
+    return self;
+}
+
+- (instancetype)initWithFileAtPath:(NSString *)path
+                             index:(BibMARCFileIndex *)index
+                             error:(out NSError *__autoreleasing *)error {
+    if (self = [super init]) {
+        _path = [path copy];
+        if (![self mapFileWithError:error]) {
+            return nil;
+        }
+        if ([index fileSize] != _fileSize) {
+            if (error != NULL) {
+                *error = BibMARCMappedFileMakeOutdatedIndexError(path);
+            }
+            return nil;
+        }
+        _index = index;
+        _count = [index count];
+    }
+    return self;
+}
+
+/// Map the file at ``path`` into memory.
+- (BOOL)mapFileWithError:(out NSError *__autoreleasing *)error {
+    int const fd = open([_path fileSystemRepresentation], O_RDONLY);
+    if (fd < 0) {
+        if (error != NULL) {
+            *error = BibMARCMappedFileMakePOSIXError(_path);
+        }
+        return NO;
+    }
+    struct stat status;
+    if (fstat(fd, &status) != 0) {
+        if (error != NULL) {
+            *error = BibMARCMappedFileMakePOSIXError(_path);
+        }
+        close(fd);
+        return NO;
+    }
+    _fileSize = (unsigned long long)status.st_size;
+    if (_fileSize > 0) {
+        void *const bytes = mmap(NULL, (size_t)_fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (bytes == MAP_FAILED) {
+            if (error != NULL) {
+                *error = BibMARCMappedFileMakePOSIXError(_path);
+            }
+            close(fd);
+            return NO;
+        }
+        _bytes = bytes;
+    }
+    // the mapping stays valid after its file descriptor is closed
+    close(fd);
+    return YES;
+}
+
+- (void)dealloc {
+    if (_bytes != NULL) {
+        munmap((void *)_bytes, (size_t)_fileSize);
+    }
+    free(_locations);
+    free(_lengths);
+}
+
+#pragma mark - Record Boundaries
+
+/// Find the length of the record beginning at the given location.
+/// - returns: The length of the record, including its record terminator,
+///            or `0` when there are no more records in the file.
+- (size_t)lengthOfRecordAtLocation:(size_t)location {
+    size_t const remaining = (size_t)_fileSize - location;
+    uint8_t const *const bytes = _bytes + location;
+    if (remaining >= BibLeaderRawDataLength) {
+        BibMarcLeader const leader = BibMarcLeaderRead((int8_t const *)bytes, remaining);
+        size_t const length = leader.recordLength;
+        if (length != NSNotFound && length > BibLeaderRawDataLength && length <= remaining
+            && bytes[length - 1] == BibMARCMappedFileRecordTerminator) {
+            return length;
+        }
+    }
+    // fall back to the record terminator when a record's leader has the wrong length,
+    // so that the records following it can still be found
+    uint8_t const *const terminator = memchr(bytes, BibMARCMappedFileRecordTerminator, remaining);
+    return (terminator == NULL) ? 0 : (size_t)(terminator - bytes) + 1;
+}
+
+/// Add a record to the index of record locations.
+- (BOOL)appendRecordAtLocation:(size_t)location length:(size_t)length {
+    if (_count == _capacity) {
+        NSUInteger const capacity = MAX(1024, _capacity * 2);
+        uint64_t *const locations = realloc(_locations, capacity * sizeof(uint64_t));
+        if (locations == NULL) {
+            return NO;
+        }
+        _locations = locations;
+        uint32_t *const lengths = realloc(_lengths, capacity * sizeof(uint32_t));
+        if (lengths == NULL) {
+            return NO;
+        }
+        _lengths = lengths;
+        _capacity = capacity;
+    }
+    _locations[_count] = location;
+    _lengths[_count] = (uint32_t)MIN(length, UINT32_MAX);
+    _count += 1;
+    return YES;
+}
+
+/// Find the location of each record in the file.
+/// - returns: `NO` when the file has data but no records could be found in it,
+///            or when there isn't enough memory to index its records.
+- (BOOL)indexRecords {
+    size_t const size = (size_t)_fileSize;
+    size_t location = 0;
+    while (location < size) {
+        // skip line breaks that some tools write between records
+        uint8_t const byte = _bytes[location];
+        if (byte == '\n' || byte == '\r') {
+            location += 1;
+            continue;
+        }
+        size_t const length = [self lengthOfRecordAtLocation:location];
+        if (length == 0) {
+            // ignore trailing data that isn't part of a record
+            break;
+        }
+        if (![self appendRecordAtLocation:location length:length]) {
+            return NO;
+        }
+        location += length;
+    }
+    return _count > 0 || location == size;
+}
+
+#pragma mark - Record Access
+
+- (NSRange)byteRangeOfRecordAtIndex:(NSUInteger)index {
+    BibAssert(index < _count, NSRangeException, @"-[%@ %s]: index %lu beyond bounds (0 ..< %lu)",
+              [self className], sel_getName(_cmd), (unsigned long)index, (unsigned long)_count);
+    return [self rangeOfRecordAtIndex:index];
+}
+
+/// Get the range of the record at an index known to be less than ``count``.
+/// - returns: The record's range within the file. Records whose index entries point outside of the file
+///            have an empty range, so that they're treated as malformed data.
+- (NSRange)rangeOfRecordAtIndex:(NSUInteger)index {
+    if (_index == nil) {
+        return NSMakeRange((NSUInteger)_locations[index], _lengths[index]);
+    }
+    NSRange const range = [_index byteRangeOfRecordAtIndex:index];
+    if (range.location > _fileSize || range.length > _fileSize - range.location) {
+        return NSMakeRange(0, 0);
+    }
+    return range;
+}
+
+- (NSData *)dataForRecordAtIndex:(NSUInteger)index {
+    NSRange const range = [self byteRangeOfRecordAtIndex:index];
+    // keep the file mapped for as long as the data is around
+    BibMARCMappedFile *const file = self;
+    return [[NSData alloc] initWithBytesNoCopy:(void *)(_bytes + range.location)
+                                        length:range.length
+                                   deallocator:^(void *bytes, NSUInteger length) { (void)file; }];
+}
+
+- (BibRecord *)recordAtIndex:(NSUInteger)index {
+    return [self recordAtIndex:index error:NULL];
+}
+
+- (BibRecord *)recordAtIndex:(NSUInteger)index error:(out NSError *__autoreleasing *)error {
+    NSRange const range = [self byteRangeOfRecordAtIndex:index];
+    BibMarcRecordView view = {};
+    BibRecord *const record = [BibMARCSerialization recordFromBytes:(_bytes + range.location)
+                                                              length:range.length
+                                                                view:&view
+                                                             options:0
+                                                               error:error];
+    BibMarcRecordViewDestroy(&view);
+    return record;
+}
+
+- (void)enumerateRecordsInRange:(NSRange)range
+                     usingBlock:(void (NS_NOESCAPE ^)(BibRecord *, NSUInteger, BOOL *))block {
+    BibAssert(range.location + range.length <= _count, NSRangeException,
+              @"-[%@ %s]: NSRange(location: %lu, length: %lu) beyond bounds (0 ..< %lu)",
+              [self className], sel_getName(_cmd), (unsigned long)range.location, (unsigned long)range.length,
+              (unsigned long)_count);
+    BibMarcRecordView view = {};
+    BOOL stop = NO;
+    for (NSUInteger index = range.location; index < NSMaxRange(range) && !stop; index += 1) {
+        @autoreleasepool {
+            NSRange const recordRange = [self rangeOfRecordAtIndex:index];
+            BibRecord *const record = [BibMARCSerialization recordFromBytes:(_bytes + recordRange.location)
+                                                                      length:recordRange.length
+                                                                        view:&view
+                                                                     options:0
+                                                                       error:NULL];
+            if (record != nil) {
+                block(record, index, &stop);
+            }
+        }
+    }
+    BibMarcRecordViewDestroy(&view);
+}
+
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state
+                                  objects:(id __unsafe_unretained [])buffer
+                                    count:(NSUInteger)len {
+    if (state->state == 0) {
+        // the file's records never change
+        state->mutationsPtr = &(state->extra[0]);
+        state->state = 1;
+    }
+    NSUInteger index = state->extra[1];
+    NSUInteger const limit = MIN(len, BibMARCMappedFileEnumerationBatchSize);
+    NSMutableArray *const records = [NSMutableArray arrayWithCapacity:limit];
+    BibMarcRecordView view = {};
+    while (index < _count && [records count] < limit) {
+        NSRange const range = [self rangeOfRecordAtIndex:index];
+        BibRecord *const record = [BibMARCSerialization recordFromBytes:(_bytes + range.location)
+                                                                  length:range.length
+                                                                    view:&view
+                                                                 options:0
+                                                                   error:NULL];
+        if (record != nil) {
+            [records addObject:record];
+        }
+        index += 1;
+    }
+    BibMarcRecordViewDestroy(&view);
+    state->extra[1] = index;
+
+    // the enumeration buffer doesn't retain its objects, so keep them alive until the autorelease pool drains
+    NSArray *__autoreleasing batch = records;
+    [batch getObjects:buffer range:NSMakeRange(0, [batch count])];
+    state->itemsPtr = buffer;
+    return [batch count];
+}
+
+@end
+
+#pragma mark - Errors
+
+static NSError *BibMARCMappedFileMakePOSIXError(NSString *const path) {
+    return [NSError errorWithDomain:NSPOSIXErrorDomain
+                               code:errno
+                           userInfo:@{ NSFilePathErrorKey : path }];
+}
+
+static NSError *BibMARCMappedFileMakeMalformedDataError(NSString *const path) {
+    return [NSError errorWithDomain:BibSerializationErrorDomain
+                               code:BibSerializationMalformedDataError
+                           userInfo:@{ NSFilePathErrorKey : path,
+                                       NSDebugDescriptionErrorKey : @"The file doesn't contain MARC 21 records" }];
+}
+
+static NSError *BibMARCMappedFileMakeOutdatedIndexError(NSString *const path) {
+    return [NSError errorWithDomain:BibSerializationErrorDomain
+                               code:BibSerializationMalformedDataError
+                           userInfo:@{ NSFilePathErrorKey : path,
+                                       NSDebugDescriptionErrorKey : @"The record index is out of date with the file" }];
+}
@@ -14,15 +14,36 @@
 NS_ASSUME_NONNULL_BEGIN
 
 /// A write-only stream used to serialize record objects as MARC 21 encoded data.
+///
+/// Records are collected in an output buffer and written to the underlying stream in blocks of
+/// ``bufferSize`` bytes, rather than with a separate write for each record. Buffered records are
+/// written when the stream is closed, when its ``BibRecordOutputStream/data`` is read, or when
+/// ``flush:`` is called.
 NS_SWIFT_NAME(MARCOutputStream)
 @interface BibMARCOutputStream : BibRecordOutputStream
 
+/// The size in bytes of the blocks of record data written to the underlying output stream.
+///
+/// Set this to `0` to write each record to the underlying stream as soon as it's encoded.
+///
+/// The default value is 1 MiB.
+@property (nonatomic, assign) NSUInteger bufferSize;
+
 /// Initializes and returns a ``BibMARCOutputStream`` for writing to the given input stream.
 /// - parameter outputStream: The `NSOutputStream` object to which record data should be written.
 /// - returns: An initialized ``BibMARCOutputStream`` object that writes ``BibRecord`` objects to
 ///            the given input stream.
 - (instancetype)initWithOutputStream:(NSOutputStream *)outputStream NS_DESIGNATED_INITIALIZER;
 
+/// Write all of the buffered record data to the underlying output stream.
+/// - parameter error: A pointer to an `NSError` variable that can be used to return an
+///                    error value when `NO` is returned.
+/// - returns: `YES` when all of the buffered data was written.
+/// - postcondition: When `NO` is returned, ``BibRecordOutputStream/streamStatus`` is set to
+///                  `NSStreamStatusError`, and ``BibRecordOutputStream/streamError`` is set to an
+///                  `NSError` object that indicates the reason for the failure.
+- (BOOL)flush:(out NSError *_Nullable __autoreleasing *_Nullable)error NS_SWIFT_NAME(flush());
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -8,13 +8,18 @@
 
 #import "BibMARCOutputStream.h"
 #import "BibMARCSerialization.h"
+#import "BibMARCSerialization+Internal.h"
 #import "BibSerializationError+Internal.h"
 #import "Bibliotek+Internal.h"
 
+static NSUInteger const BibMARCOutputStreamDefaultBufferSize = 1024 * 1024;
+
 @implementation BibMARCOutputStream {
     NSOutputStream *_outputStream;
     NSStreamStatus _streamStatus;
     NSError *_streamError;
+    BibMARCSerializationBuffer _buffer;
+    NSUInteger _bufferedLength;
 }
 
 - (instancetype)init {
@@ -26,12 +31,17 @@
         _outputStream = outputStream;
         _streamStatus = [outputStream streamStatus];
         _streamError = [outputStream streamError];
+        _bufferSize = BibMARCOutputStreamDefaultBufferSize;
     }
     return self;
 }
 
 - (void)dealloc {
+    if ([self streamStatus] == NSStreamStatusOpen) {
+        [self flush:NULL];
+    }
     [_outputStream close];
+    BibMARCSerializationBufferDestroy(&_buffer);
 }
 
 - (NSStreamStatus)streamStatus {
@@ -47,6 +57,9 @@
 }
 
 - (NSData *)data {
+    if ([self streamStatus] == NSStreamStatusOpen) {
+        [self flush:NULL];
+    }
     return [_outputStream propertyForKey:NSStreamDataWrittenToMemoryStreamKey];
 }
 
@@ -61,9 +74,12 @@
 
 - (instancetype)close {
     if (_streamStatus != NSStreamStatusClosed) {
+        BOOL const flushed = ([self streamStatus] != NSStreamStatusOpen) || [self flush:NULL];
         [_outputStream close];
-        _streamStatus = [_outputStream streamStatus];
-        _streamError = [_outputStream streamError];
+        if (flushed) {
+            _streamStatus = [_outputStream streamStatus];
+            _streamError = [_outputStream streamError];
+        }
     }
     return self;
 }
@@ -84,15 +100,61 @@
             return NO;
     }
     NSError *err = nil;
-    BOOL const success = [BibMARCSerialization writeRecord:record toStream:_outputStream error:&err];
-    if (!success) {
+    NSUInteger const length = [BibMARCSerialization encodeRecord:record
+                                                          buffer:&(_buffer.data)
+                                                          offset:_bufferedLength
+                                                           error:&err];
+    if (length == 0) {
+        _streamStatus = NSStreamStatusError;
+        _streamError = err;
+        if (error != NULL) {
+            *error = err;
+        }
+        return NO;
+    }
+    _bufferedLength += length;
+    if (_bufferedLength < _bufferSize) {
+        return YES;
+    }
+    return (_bufferSize == 0) ? [self flush:error] : [self flushBlocks:error];
+}
+
+/// Write as many whole blocks of buffered data as are available to the underlying output stream,
+/// and keep the rest buffered until there's enough to fill another block.
+- (BOOL)flushBlocks:(out NSError *__autoreleasing *)error {
+    NSUInteger const length = _bufferedLength - (_bufferedLength % _bufferSize);
+    if (! [self writeBufferedBytesWithLength:length error:error]) {
+        return NO;
+    }
+    memmove(_buffer.data.bytes, _buffer.data.bytes + length, _bufferedLength - length);
+    _bufferedLength -= length;
+    return YES;
+}
+
+- (BOOL)flush:(out NSError *__autoreleasing *)error {
+    if (! [self writeBufferedBytesWithLength:_bufferedLength error:error]) {
+        return NO;
+    }
+    _bufferedLength = 0;
+    return YES;
+}
+
+/// Write the first bytes of buffered data to the underlying output stream.
+/// - postcondition: When `NO` is returned, the stream's status is set to `NSStreamStatusError`.
+- (BOOL)writeBufferedBytesWithLength:(NSUInteger)length error:(out NSError *__autoreleasing *)error {
+    if (length == 0) {
+        return YES;
+    }
+    NSError *err = nil;
+    if (! [BibMARCSerialization writeBytes:_buffer.data.bytes length:length toStream:_outputStream error:&err]) {
         _streamStatus = NSStreamStatusError;
         _streamError = err;
         if (error != NULL) {
             *error = err;
         }
+        return NO;
     }
-    return success;
+    return YES;
 }
 
 @end
@@ -0,0 +1,88 @@
+//
+//  BibMARCSerialization+Internal.h
+//  Bibliotek
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+
+#import "BibMARCSerialization.h"
+#import "BibMarcIO.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Storage for raw record data that is kept between records read from or written to the same stream.
+///
+/// Records can be as large as 99,999 bytes, so keeping their data in a growable heap buffer avoids
+/// both the risk of overflowing the stack and the cost of setting up a new buffer for every record.
+typedef struct BibMARCSerializationBuffer {
+    BibMarcBuffer data;
+    BibMarcRecordView view;
+} BibMARCSerializationBuffer;
+
+/// Free the storage kept by a serialization buffer.
+extern void BibMARCSerializationBufferDestroy(BibMARCSerializationBuffer *buffer);
+
+@interface BibMARCSerialization (Internal)
+
+/// Decode a record directly from its raw data, without copying it.
+/// - parameter bytes: The raw data of the record, beginning with its leader.
+/// - parameter length: The length of the raw data, which may extend past the end of the record.
+/// - parameter view: A zero-initialized record view, or one used to decode a previous record.
+/// - parameter options: Options for decoding the record.
+/// - returns: The decoded record, or `nil` when the data isn't a well-formed MARC 21 record.
++ (nullable BibRecord *)recordFromBytes:(void const *)bytes
+                                 length:(NSUInteger)length
+                                   view:(BibMarcRecordView *)view
+                                options:(BibMARCReadingOptions)options
+                                  error:(out NSError *_Nullable __autoreleasing *_Nullable)error;
+
+/// Read a record from the given input stream, using storage that can be reused for the next record.
+/// - parameter buffer: A zero-initialized serialization buffer, or one used to read or write a previous record.
+/// - seealso: ``BibMARCSerialization/recordFromStream:options:error:``
++ (nullable BibRecord *)recordFromStream:(NSInputStream *)inputStream
+                                  buffer:(BibMARCSerializationBuffer *)buffer
+                                 options:(BibMARCReadingOptions)options
+                                   error:(out NSError *_Nullable __autoreleasing *_Nullable)error;
+
+/// Read the raw data of the next record in the given input stream, without decoding it.
+/// - parameter buffer: A buffer that is grown to hold the record's data.
+/// - parameter offset: The location in `buffer` where the record's data should be written.
+///                     Data already in the buffer before this location is kept.
+/// - returns: The length of the record's data, including its leader and record terminator,
+///            or `0` when a record couldn't be read from the stream.
+/// - postcondition: `error` is left unchanged when `0` is returned because the stream has no more records.
+///                  A stream that ends partway through a record's leader or data is an error.
++ (NSUInteger)readRecordDataFromStream:(NSInputStream *)inputStream
+                                buffer:(BibMarcBuffer *)buffer
+                                offset:(NSUInteger)offset
+                                 error:(out NSError *_Nullable __autoreleasing *_Nullable)error;
+
+/// Write a record to the given output stream, using storage that can be reused for the next record.
+/// - parameter buffer: A zero-initialized serialization buffer, or one used to read or write a previous record.
+/// - seealso: ``BibMARCSerialization/writeRecord:toStream:error:``
++ (BOOL)writeRecord:(BibRecord *)record
+           toStream:(NSOutputStream *)outputStream
+             buffer:(BibMARCSerializationBuffer *)buffer
+              error:(out NSError *_Nullable __autoreleasing *_Nullable)error;
+
+/// Encode a record as MARC 21 data, without writing it to a stream.
+/// - parameter buffer: A buffer that is grown to hold the record's data.
+/// - parameter offset: The location in `buffer` where the record's data should be written.
+///                     Data already in the buffer before this location is kept.
+/// - returns: The length of the record's data, or `0` when the record couldn't be encoded.
++ (NSUInteger)encodeRecord:(BibRecord *)record
+                    buffer:(BibMarcBuffer *)buffer
+                    offset:(NSUInteger)offset
+                     error:(out NSError *_Nullable __autoreleasing *_Nullable)error;
+
+/// Write all of the given data to an output stream, even when the stream accepts only part of it at a time.
+/// - returns: `YES` when all of the data was written, or `NO` when the stream failed or ran out of space.
++ (BOOL)writeBytes:(void const *)bytes
+            length:(NSUInteger)length
+          toStream:(NSOutputStream *)outputStream
+             error:(out NSError *_Nullable __autoreleasing *_Nullable)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
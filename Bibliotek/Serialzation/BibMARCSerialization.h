@@ -12,6 +12,17 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+/// Options for decoding records from MARC 21 data.
+typedef NS_OPTIONS(NSUInteger, BibMARCReadingOptions) {
+    /// Keep the raw data of each control field and subfield with its record, and convert it to a string the first
+    /// time it's read.
+    ///
+    /// Converting MARC-8 content to Unicode is most of the cost of decoding a record. Use this option when only a
+    /// few of each record's fields are read, so that the content of the other fields is never converted. Each record
+    /// keeps a copy of its raw data until all of its content has been read.
+    BibMARCReadingLazyContent NS_SWIFT_NAME(lazyContent) = 1 << 0,
+} NS_SWIFT_NAME(MARCReadingOptions);
+
 /// An object that encodes ``BibRecord`` instances as MARC 21 data, and visa-versa.
 ///
 /// MARC 21 is a data format designed to facilitate the exchange of bibliographic,
@@ -68,6 +79,21 @@ NS_SWIFT_NAME(MARCSerialization)
 + (nullable NSArray<BibRecord *> *)recordsFromData:(NSData *)data
                                              error:(out NSError *_Nullable __autoreleasing *_Nullable)error;
 
+/// Create an array of `BibRecord` objects from MARC 21 encoded data.
+///
+/// - parameter data: The MARC 21 encoded data containing serialized representations of
+///                   records.
+/// - parameter options: Options for decoding the records.
+/// - parameter error: A pointer to an `NSError` variable that can be used to return an
+///                    error value when `nil` is returned.
+/// - returns: An array of `BibRecord` objects is returned when records could be
+///            successfully deserialized from the data. Otherwise, `nil` is returned and,
+///            if `error` is not a `NULL` pointer, its pointee is set to an `NSError`
+///            object to indicate the reason for the failure.
++ (nullable NSArray<BibRecord *> *)recordsFromData:(NSData *)data
+                                           options:(BibMARCReadingOptions)options
+                                             error:(out NSError *_Nullable __autoreleasing *_Nullable)error;
+
 /// Write an instance of `BibRecord` as MARC 21 data to the given output stream.
 ///
 /// - parameter record: The record to write to the output stream.
@@ -101,6 +127,20 @@ NS_SWIFT_NAME(MARCSerialization)
 + (nullable BibRecord *)recordFromStream:(NSInputStream *)inputStream
                                    error:(out NSError *_Nullable __autoreleasing *_Nullable)error;
 
+/// Read an instance of `BibRecord` from the MARC 21 data in the given input stream.
+/// - parameter inputStream: The input stream to read the MARC 21 encoded data from.
+/// - parameter options: Options for decoding the record.
+/// - parameter error: A pointer to an `NSError` variable that can be used to return an
+///                    error value when `nil` is returned.
+/// - returns: A `BibRecord` object is returned when a record is successfully read from
+///            the input stream. Otherwise, `nil` is returned and, if `error` is not
+///            `NULL`,its pointee is set to an `NSError` object to indicate the reason for
+///            the failure.
+/// - precondition: If the input stream must be opened.
++ (nullable BibRecord *)recordFromStream:(NSInputStream *)inputStream
+                                 options:(BibMARCReadingOptions)options
+                                   error:(out NSError *_Nullable __autoreleasing *_Nullable)error;
+
 @end
 
 
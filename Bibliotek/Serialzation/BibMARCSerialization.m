@@ -7,6 +7,7 @@
 //
 
 #import "BibMARCSerialization.h"
+#import "BibMARCSerialization+Internal.h"
 #import "BibRecord.h"
 #import "BibMARCInputStream.h"
 #import "BibMARCOutputStream.h"
@@ -18,14 +19,17 @@
 #import "BibLeader.h"
 #import "BibFieldTag.h"
 #import "BibRecordField.h"
+#import "BibRecordField+Internal.h"
 #import "BibFieldIndicator.h"
 #import "BibSubfield.h"
+#import "BibSubfield+Internal.h"
 #import "BibRecordKind.h"
 
 #import "BibMarcIO.h"
 
 static BibMarcRecord BibMarcRecordMakeFromBibRecord(BibRecord *record);
-static BibRecord *BibRecordMakeFromMarcRecord(BibMarcRecord const *marcRecord) NS_RETURNS_RETAINED;
+static BibRecord *BibRecordMakeFromMarcRecordView(BibMarcRecordView const *view,
+                                                  BibMARCReadingOptions options) NS_RETURNS_RETAINED;
 
 static BOOL BibMarcLeaderReadFromInputStream(BibMarcLeader *leader, NSInputStream *inputStream,
                                              NSError *__autoreleasing *error);
@@ -34,6 +38,7 @@ static BOOL BibMARCSerializationCanUseStream(NSStream *stream, NSError *__autore
 static NSError *BibMARCSerializationMakeMissingDataError(void);
 static NSError *BibMARCSerializationMakeMalformedDataError(void);
 static NSError *BibMARCSerializationMakeStreamAtEndError(void);
+static NSError *BibMARCSerializationMakeOutOfMemoryError(void);
 
 @implementation BibMARCSerialization
 
@@ -47,29 +52,42 @@ static NSError *BibMARCSerializationMakeStreamAtEndError(void);
 
 + (NSData *)dataWithRecordsInArray:(NSArray<BibRecord *> *)records error:(NSError *__autoreleasing *)error {
     NSOutputStream *const outputStream = [[NSOutputStream alloc] initToMemory];
+    BibMARCSerializationBuffer buffer = {};
     [outputStream open];
     for (BibRecord *record in records) {
-        if (! [self writeRecord:record toStream:outputStream error:error]) {
+        if (! [self writeRecord:record toStream:outputStream buffer:&buffer error:error]) {
+            BibMARCSerializationBufferDestroy(&buffer);
             [outputStream close];
             return nil;
         }
     }
+    BibMARCSerializationBufferDestroy(&buffer);
     [outputStream close];
     return [outputStream propertyForKey:NSStreamDataWrittenToMemoryStreamKey];
 }
 
 + (NSArray<BibRecord *> *)recordsFromData:(NSData *)data error:(out NSError *__autoreleasing *)error {
+    return [self recordsFromData:data options:0 error:error];
+}
+
++ (NSArray<BibRecord *> *)recordsFromData:(NSData *)data
+                                  options:(BibMARCReadingOptions)options
+                                    error:(out NSError *__autoreleasing *)error {
     NSInputStream *const inputStream = [[NSInputStream alloc] initWithData:data];
     NSMutableArray *const recordsArray = [[NSMutableArray alloc] init];
+    BibMARCSerializationBuffer buffer = {};
 
     [inputStream open];
     NSError *err = nil;
-    BibRecord *record = [self recordFromStream:inputStream error:error];
+    BibRecord *record = [self recordFromStream:inputStream buffer:&buffer options:options error:error];
     while (record != nil && err == nil) {
         [recordsArray addObject:record];
-        record = [inputStream hasBytesAvailable] ? [self recordFromStream:inputStream error:&err] : nil;
+        record = [inputStream hasBytesAvailable]
+               ? [self recordFromStream:inputStream buffer:&buffer options:options error:&err]
+               : nil;
     }
     [inputStream close];
+    BibMARCSerializationBufferDestroy(&buffer);
 
     if (err != nil && error != NULL) {
         *error = err;
@@ -78,56 +96,113 @@ static NSError *BibMARCSerializationMakeStreamAtEndError(void);
 }
 
 + (BibRecord *)recordFromStream:(NSInputStream *)inputStream error:(out NSError *__autoreleasing *)error {
-    if (! [inputStream hasBytesAvailable]) {
+    return [self recordFromStream:inputStream options:0 error:error];
+}
+
++ (BibRecord *)recordFromStream:(NSInputStream *)inputStream
+                        options:(BibMARCReadingOptions)options
+                          error:(out NSError *__autoreleasing *)error {
+    BibMARCSerializationBuffer buffer = {};
+    BibRecord *const record = [self recordFromStream:inputStream buffer:&buffer options:options error:error];
+    BibMARCSerializationBufferDestroy(&buffer);
+    return record;
+}
+
++ (BOOL)writeRecord:(BibRecord *)record
+           toStream:(NSOutputStream *)outputStream
+              error:(out NSError *__autoreleasing *)error {
+    BibMARCSerializationBuffer buffer = {};
+    BOOL const success = [self writeRecord:record toStream:outputStream buffer:&buffer error:error];
+    BibMARCSerializationBufferDestroy(&buffer);
+    return success;
+}
+
+@end
+
+#pragma mark -
+
+@implementation BibMARCSerialization (Internal)
+
++ (BibRecord *)recordFromStream:(NSInputStream *)inputStream
+                          buffer:(BibMARCSerializationBuffer *)buffer
+                         options:(BibMARCReadingOptions)options
+                           error:(out NSError *__autoreleasing *)error {
+    NSError *err = nil;
+    NSUInteger const length = [self readRecordDataFromStream:inputStream buffer:&(buffer->data) offset:0 error:&err];
+    if (length == 0) {
         if (error != NULL) {
-            *error = BibMARCSerializationMakeStreamAtEndError();
+            *error = err ?: BibMARCSerializationMakeStreamAtEndError();
         }
         return nil;
     }
+    return [self recordFromBytes:buffer->data.bytes
+                          length:length
+                            view:&(buffer->view)
+                         options:options
+                           error:error];
+}
+
++ (NSUInteger)readRecordDataFromStream:(NSInputStream *)inputStream
+                                buffer:(BibMarcBuffer *)buffer
+                                offset:(NSUInteger)offset
+                                 error:(out NSError *__autoreleasing *)error {
+    if (! [inputStream hasBytesAvailable]) {
+        return 0;
+    }
     if (! BibMARCSerializationCanUseStream(inputStream, error)) {
-        return nil;
+        return 0;
     }
     BibMarcLeader leader;
     if (! BibMarcLeaderReadFromInputStream(&leader, inputStream, error)) {
-        return nil;
+        return 0;
     }
 
+    if (! BibMarcBufferReserve(buffer, offset + leader.recordLength)) {
+        if (error != NULL) {
+            *error = BibMARCSerializationMakeOutOfMemoryError();
+        }
+        return 0;
+    }
     size_t const remainingBytesCount = leader.recordLength - BibLeaderRawDataLength;
-    uint8_t *const buffer = alloca(leader.recordLength * sizeof(int8_t));
-    memcpy(buffer, leader.leaderData, BibLeaderRawDataLength);
+    uint8_t *const bytes = (uint8_t *)buffer->bytes + offset;
+    memcpy(bytes, leader.leaderData, BibLeaderRawDataLength);
 
-    NSUInteger const remainingReadLength = [inputStream read:(buffer + BibLeaderRawDataLength)
+    NSUInteger const remainingReadLength = [inputStream read:(bytes + BibLeaderRawDataLength)
                                                    maxLength:remainingBytesCount];
     if (remainingReadLength == NSNotFound)
     {
         if (error != NULL) {
             *error = [inputStream streamError];
         }
-        return nil;
+        return 0;
     }
     else if (remainingReadLength != remainingBytesCount)
     {
         if (error != NULL) {
             *error = BibMARCSerializationMakeMissingDataError();
         }
-        return nil;
+        return 0;
     }
+    return leader.recordLength;
+}
 
-    BibMarcRecord marcRecord;
-    if (BibMarcRecordRead(&marcRecord, (int8_t *)buffer, leader.recordLength) != leader.recordLength) {
++ (BibRecord *)recordFromBytes:(void const *)bytes
+                        length:(NSUInteger)length
+                          view:(BibMarcRecordView *)view
+                       options:(BibMARCReadingOptions)options
+                         error:(out NSError *__autoreleasing *)error {
+    if (BibMarcRecordViewRead(view, bytes, length) == 0) {
         if (error != NULL) {
             *error = BibMARCSerializationMakeMalformedDataError();
         }
         return nil;
     }
-
-    BibRecord *const bibRecord = BibRecordMakeFromMarcRecord(&marcRecord);
-    BibMarcRecordDestroy(&marcRecord);
-    return bibRecord;
+    return BibRecordMakeFromMarcRecordView(view, options);
 }
 
 + (BOOL)writeRecord:(BibRecord *)record
            toStream:(NSOutputStream *)outputStream
+             buffer:(BibMARCSerializationBuffer *)buffer
               error:(out NSError *__autoreleasing *)error {
     if (! [outputStream hasSpaceAvailable]) {
         if (error != NULL) {
@@ -138,27 +213,62 @@ static NSError *BibMARCSerializationMakeStreamAtEndError(void);
     if (! BibMARCSerializationCanUseStream(outputStream, error)) {
         return NO;
     }
+    NSUInteger const length = [self encodeRecord:record buffer:&(buffer->data) offset:0 error:error];
+    return (length != 0) && [self writeBytes:buffer->data.bytes length:length toStream:outputStream error:error];
+}
 
++ (NSUInteger)encodeRecord:(BibRecord *)record
+                    buffer:(BibMarcBuffer *)buffer
+                    offset:(NSUInteger)offset
+                     error:(out NSError *__autoreleasing *)error {
     BibMarcRecord marcRecord = BibMarcRecordMakeFromBibRecord(record);
 
     size_t const length = BibMarcRecordGetWriteSize(&marcRecord);
-    int8_t *const buffer = alloca(sizeof(int8_t) * length);
-    size_t const bufferWriteLength = length - BibMarcRecordWrite(&marcRecord, buffer, length);
+    if (! BibMarcBufferReserve(buffer, offset + length)) {
+        BibMarcRecordDestroy(&marcRecord);
+        if (error != NULL) {
+            *error = BibMARCSerializationMakeOutOfMemoryError();
+        }
+        return 0;
+    }
+    int8_t *const bytes = buffer->bytes + offset;
+    size_t const bufferWriteLength = length - BibMarcRecordWrite(&marcRecord, bytes, length);
     BibMarcRecordDestroy(&marcRecord);
 
     if (bufferWriteLength == 0) {
         if (error != NULL) {
             *error = BibMARCSerializationMakeMalformedDataError();
         }
-        return NO;
+        return 0;
     }
-    size_t const outputWriteLength = [outputStream write:(uint8_t *)buffer maxLength:length];
-    BOOL const success = (bufferWriteLength == outputWriteLength);
-    if (!success && error != NULL) {
-        *error = BibMARCSerializationMakeStreamAtEndError();
+    return bufferWriteLength;
+}
+
++ (BOOL)writeBytes:(void const *)bytes
+            length:(NSUInteger)length
+          toStream:(NSOutputStream *)outputStream
+             error:(out NSError *__autoreleasing *)error {
+    uint8_t const *remainingBytes = bytes;
+    NSUInteger remainingLength = length;
+    while (remainingLength > 0) {
+        // streams may accept only part of the data, so keep writing until all of it is taken
+        NSInteger const writeLength = [outputStream write:remainingBytes maxLength:remainingLength];
+        if (writeLength < 0) {
+            if (error != NULL) {
+                *error = [outputStream streamError] ?: BibMARCSerializationMakeStreamAtEndError();
+            }
+            return NO;
+        }
+        if (writeLength == 0) {
+            if (error != NULL) {
+                *error = BibMARCSerializationMakeStreamAtEndError();
+            }
+            return NO;
+        }
+        remainingBytes += writeLength;
+        remainingLength -= (NSUInteger)writeLength;
     }
-    
-    return success;
+    return YES;
 }
 
 @end
@@ -227,18 +337,21 @@ static BibMarcRecord BibMarcRecordMakeFromBibRecord(BibRecord *bibRecord)
     return record;
 }
 
-static NSArray *BibRecordFieldMakeArrayFromMarcRecord(BibMarcRecord const *marcRecord,
-                                                      bib_char_converter_t converter) NS_RETURNS_RETAINED;
+static NSArray *BibRecordFieldMakeArrayFromMarcRecordView(BibMarcRecordView const *view,
+                                                          bib_char_converter_t converter) NS_RETURNS_RETAINED;
+static NSArray *BibRecordFieldMakeLazyArrayFromMarcRecordView(BibMarcRecordView const *view,
+                                                              bib_char_encoding_t encoding) NS_RETURNS_RETAINED;
 
 
-static BibRecord *BibRecordMakeFromMarcRecord(BibMarcRecord const *const marcRecord) NS_RETURNS_RETAINED
+static BibRecord *BibRecordMakeFromMarcRecordView(BibMarcRecordView const *const view,
+                                                  BibMARCReadingOptions const options) NS_RETURNS_RETAINED
 {
-    int8_t const *const leaderBytes = marcRecord->leader.leaderData;
+    int8_t const *const leaderBytes = view->leader.leaderData;
     NSData *const leaderData = [[NSData alloc] initWithBytes:leaderBytes length:BibLeaderRawDataLength];
     BibLeader *const bibLeader = [[BibLeader alloc] initWithData:leaderData];
 
     bib_char_encoding_t to, from;
-    switch (marcRecord->leader.recordEncoding) {
+    switch (view->leader.recordEncoding) {
         case 'a':
             to = bib_char_encoding_utf8;
             from = bib_char_encoding_utf8;
@@ -250,8 +363,12 @@ static BibRecord *BibRecordMakeFromMarcRecord(BibMarcRecord const *const marcRec
             break;
     }
 
+    if (options & BibMARCReadingLazyContent) {
+        NSArray *fields = BibRecordFieldMakeLazyArrayFromMarcRecordView(view, from);
+        return [[BibRecord alloc] initWithLeader:bibLeader fields:fields];
+    }
     bib_char_converter_t const converter = bib_char_converter_open(to, from);
-    NSArray *fields = BibRecordFieldMakeArrayFromMarcRecord(marcRecord, converter);
+    NSArray *fields = BibRecordFieldMakeArrayFromMarcRecordView(view, converter);
     BibRecord *const record = [[BibRecord alloc] initWithLeader:bibLeader fields:fields];
     bib_char_converter_close(converter);
     return record;
@@ -265,9 +382,7 @@ static BOOL BibMarcLeaderReadFromInputStream(BibMarcLeader *const leader, NSInpu
     NSUInteger const readLength = [inputStream read:leaderBytes maxLength:BibLeaderRawDataLength];
     if (readLength == 0)
     {
-        if (error != NULL) {
-            *error = BibMARCSerializationMakeStreamAtEndError();
-        }
+        // no error, because the stream has simply run out of records
         return NO;
     }
     else if (readLength == NSNotFound)
@@ -286,7 +401,8 @@ static BOOL BibMarcLeaderReadFromInputStream(BibMarcLeader *const leader, NSInpu
     }
 
     *leader = BibMarcLeaderRead((int8_t *)leaderBytes, BibLeaderRawDataLength);
-    if (leader->recordLength == NSNotFound || leader->fieldsLocation == NSNotFound)
+    if (leader->recordLength == NSNotFound || leader->fieldsLocation == NSNotFound
+        || leader->recordLength <= BibLeaderRawDataLength)
     {
         if (error != NULL) {
             *error = BibMARCSerializationMakeMalformedDataError();
@@ -297,34 +413,80 @@ static BOOL BibMarcLeaderReadFromInputStream(BibMarcLeader *const leader, NSInpu
     return YES;
 }
 
-static NSArray *BibRecordFieldMakeArrayFromMarcRecord(BibMarcRecord const *const marcRecord,
-                                                      bib_char_converter_t marc8) NS_RETURNS_RETAINED
+static NSArray *BibRecordFieldMakeArrayFromMarcRecordView(BibMarcRecordView const *const view,
+                                                          bib_char_converter_t marc8) NS_RETURNS_RETAINED
 {
-    NSUInteger const recordFieldsCount = marcRecord->controlFieldsCount + marcRecord->contentFieldsCount;
-    NSMutableArray *const recordFields = [[NSMutableArray alloc] initWithCapacity:recordFieldsCount];
-    for (size_t index = 0; index < marcRecord->controlFieldsCount; index += 1)
+    NSMutableArray *const recordFields = [[NSMutableArray alloc] initWithCapacity:view->fieldsCount];
+    for (size_t index = 0; index < view->fieldsCount; index += 1)
     {
-        BibMarcControlField const *const field = &(marcRecord->controlFields[index]);
+        BibMarcFieldView const *const field = &(view->fields[index]);
         NSString *const tagString = [[NSString alloc] initWithUTF8String:field->tag];
         BibFieldTag *const tag = [[BibFieldTag alloc] initWithString:tagString];
-        NSString *const value = bib_char_convert_marc8(marc8, field->content);
-        BibRecordField *const controlField = [[BibRecordField alloc] initWithFieldTag:tag controlValue:value];
-        [recordFields addObject:controlField];
+        if (BibMarcFieldViewIsControlField(field))
+        {
+            BibMarcSlice const slice = BibMarcFieldViewGetContent(view, field);
+            NSString *const value = bib_char_convert_marc8_bytes(marc8, (char const *)slice.bytes, slice.length);
+            BibRecordField *const controlField = [[BibRecordField alloc] initWithFieldTag:tag controlValue:value];
+            [recordFields addObject:controlField];
+            continue;
+        }
+        BibFieldIndicator *const firstIndicator = [[BibFieldIndicator alloc] initWithRawValue:field->indicators[0]];
+        BibFieldIndicator *const secondIndicator = [[BibFieldIndicator alloc] initWithRawValue:field->indicators[1]];
+        NSMutableArray *const subfields = [[NSMutableArray alloc] initWithCapacity:field->subfieldsCount];
+        BibMarcSubfieldView const *const subfieldViews = BibMarcFieldViewGetSubfields(view, field);
+        for (size_t index = 0; index < field->subfieldsCount; index += 1)
+        {
+            BibMarcSubfieldView const *const subfield = &(subfieldViews[index]);
+            BibMarcSlice const slice = BibMarcSubfieldViewGetContent(view, subfield);
+            NSString *const code = [[NSString alloc] initWithUTF8String:(char[2]){subfield->code, '\0'}];
+            NSString *const content = bib_char_convert_marc8_bytes(marc8, (char const *)slice.bytes, slice.length);
+            BibSubfield *const bibSubfield = [[BibSubfield alloc] initWithCode:code content:content];
+            [subfields addObject:bibSubfield];
+        }
+        BibRecordField *const dataField = [[BibRecordField alloc] initWithFieldTag:tag
+                                                                    firstIndicator:firstIndicator
+                                                                   secondIndicator:secondIndicator
+                                                                         subfields:subfields];
+        [recordFields addObject:dataField];
     }
-    for (size_t index = 0; index < marcRecord->contentFieldsCount; index += 1)
+    return recordFields;
+}
+
+/// Make fields whose control values and subfield content are converted the first time they're read.
+/// The fields share a single copy of the record's raw data, which is released once all of their content is read.
+static NSArray *BibRecordFieldMakeLazyArrayFromMarcRecordView(BibMarcRecordView const *const view,
+                                                              bib_char_encoding_t const encoding) NS_RETURNS_RETAINED
+{
+    NSData *const recordData = [[NSData alloc] initWithBytes:view->bytes length:view->leader.recordLength];
+    NSMutableArray *const recordFields = [[NSMutableArray alloc] initWithCapacity:view->fieldsCount];
+    for (size_t index = 0; index < view->fieldsCount; index += 1)
     {
-        BibMarcContentField const *const field = &(marcRecord->contentFields[index]);
+        BibMarcFieldView const *const field = &(view->fields[index]);
         NSString *const tagString = [[NSString alloc] initWithUTF8String:field->tag];
         BibFieldTag *const tag = [[BibFieldTag alloc] initWithString:tagString];
+        if (BibMarcFieldViewIsControlField(field))
+        {
+            NSRange const range = NSMakeRange(field->contentLocation, field->contentLength);
+            BibRecordField *const controlField = [[BibRecordField alloc] initWithFieldTag:tag
+                                                                               recordData:recordData
+                                                                        controlValueRange:range
+                                                                                 encoding:encoding];
+            [recordFields addObject:controlField];
+            continue;
+        }
         BibFieldIndicator *const firstIndicator = [[BibFieldIndicator alloc] initWithRawValue:field->indicators[0]];
         BibFieldIndicator *const secondIndicator = [[BibFieldIndicator alloc] initWithRawValue:field->indicators[1]];
         NSMutableArray *const subfields = [[NSMutableArray alloc] initWithCapacity:field->subfieldsCount];
+        BibMarcSubfieldView const *const subfieldViews = BibMarcFieldViewGetSubfields(view, field);
         for (size_t index = 0; index < field->subfieldsCount; index += 1)
         {
-            BibMarcSubfield const *const subfield = &(field->subfields[index]);
+            BibMarcSubfieldView const *const subfield = &(subfieldViews[index]);
             NSString *const code = [[NSString alloc] initWithUTF8String:(char[2]){subfield->code, '\0'}];
-            NSString *const content = bib_char_convert_marc8(marc8, subfield->content);
-            BibSubfield *const bibSubfield = [[BibSubfield alloc] initWithCode:code content:content];
+            NSRange const range = NSMakeRange(subfield->contentLocation, subfield->contentLength);
+            BibSubfield *const bibSubfield = [[BibSubfield alloc] initWithCode:code
+                                                                    recordData:recordData
+                                                                  contentRange:range
+                                                                      encoding:encoding];
             [subfields addObject:bibSubfield];
         }
         BibRecordField *const dataField = [[BibRecordField alloc] initWithFieldTag:tag
@@ -393,6 +555,11 @@ static BOOL BibMARCSerializationCanUseStream(NSStream *const stream, NSError *__
     }
 }
 
+void BibMARCSerializationBufferDestroy(BibMARCSerializationBuffer *const buffer) {
+    BibMarcBufferDestroy(&(buffer->data));
+    BibMarcRecordViewDestroy(&(buffer->view));
+}
+
 static NSError *BibMARCSerializationMakeMissingDataError() {
     return  [NSError errorWithDomain:BibSerializationErrorDomain
                                 code:BibSerializationStreamAtEndError
@@ -411,3 +578,9 @@ static NSError *BibMARCSerializationMakeStreamAtEndError() {
                                code:BibSerializationStreamAtEndError
                            userInfo:@{ NSDebugDescriptionErrorKey : message }];
 }
+
+static NSError *BibMARCSerializationMakeOutOfMemoryError() {
+    return [NSError errorWithDomain:NSPOSIXErrorDomain
+                               code:ENOMEM
+                           userInfo:@{ NSDebugDescriptionErrorKey : @"Not enough memory to buffer MARC 21 data" }];
+}
@@ -63,7 +63,6 @@ BibMarcDirectoryEntry BibMarcDirectoryEntryRead(int8_t const *buffer, size_t len
 /// - parameter length: The length of the raw data buffer containing the record's control
 ///                     and content fields.
 boolean_t BibMarcControlFieldRead(BibMarcControlField *field, BibMarcDirectoryEntry const *entry, int8_t const *buffer, size_t length);
-size_t BibMarcSubfieldRead(BibMarcSubfield *subfield, int8_t const *buffer, size_t length);
 
 /// - parameter field: Allocated space for a content field structure where data read from
 ///                    the buffer will be written.
@@ -75,6 +74,112 @@ size_t BibMarcSubfieldRead(BibMarcSubfield *subfield, int8_t const *buffer, size
 boolean_t BibMarcContentFieldRead(BibMarcContentField *field, BibMarcDirectoryEntry const *entry, int8_t const *buffer, size_t length);
 size_t BibMarcRecordRead(BibMarcRecord *record, int8_t const *buffer, size_t length);
 
+#pragma mark - Record Views
+
+/// A run of bytes borrowed from a record's raw data.
+///
+/// Slices are not null-terminated, and are only valid for as long as the record's raw data is.
+typedef struct BibMarcSlice {
+    int8_t const *bytes;
+    size_t length;
+} BibMarcSlice;
+
+/// The location of a subfield's content within a record's raw data.
+typedef struct BibMarcSubfieldView {
+    char   code;
+    size_t contentLocation; // Location of the content relative to the start of the record.
+    size_t contentLength;
+} BibMarcSubfieldView;
+
+/// A set of field tags, used to read only some of a record's fields.
+///
+/// Field tags are made of three digits, so the filter keeps one bit for each tag from `000` to `999`.
+/// A zero-initialized filter contains no tags.
+typedef struct BibMarcFieldFilter {
+    uint8_t tags[125];
+} BibMarcFieldFilter;
+
+/// Add a field tag to a filter.
+/// - parameter tag: A field tag made of three digits. The tag doesn't need to be null-terminated.
+/// - returns: `false` when the tag isn't made of three digits, in which case the filter isn't changed.
+boolean_t BibMarcFieldFilterAddTag(BibMarcFieldFilter *filter, char const *tag);
+
+/// Determine whether or not a filter contains a field tag.
+/// - parameter tag: A field tag, which doesn't need to be null-terminated.
+/// - returns: `true` when the filter contains the tag, or `false` when the tag isn't made of three digits.
+boolean_t BibMarcFieldFilterContainsTag(BibMarcFieldFilter const *filter, char const *tag);
+
+/// The location of a control field's or content field's data within a record's raw data.
+typedef struct BibMarcFieldView {
+    char   tag[4];
+    int8_t indicators[2];   // Both indicators are zero for control fields.
+    size_t contentLocation; // Location of the field's data relative to the start of the record, after any indicators.
+    size_t contentLength;   // Length of the field's data, not including the field terminator.
+    size_t subfieldsIndex;  // Index of the field's first subfield in the record view's subfields.
+    size_t subfieldsCount;
+} BibMarcFieldView;
+
+/// A record whose fields and subfields are read in place from its raw data.
+///
+/// Reading a record view doesn't copy any field content. Fields and subfields are described by their location and
+/// length within the record's raw data, which must outlive the view. The storage for fields and subfields is kept
+/// between reads, so reading many records into the same view allocates only when a record is larger than any of
+/// the records read before it.
+typedef struct BibMarcRecordView {
+    BibMarcLeader leader;
+    int8_t const *bytes;
+
+    BibMarcFieldView *fields; // Fields in the same order as the record's directory.
+    size_t fieldsCount;
+    size_t fieldsCapacity;
+
+    BibMarcSubfieldView *subfields;
+    size_t subfieldsCount;
+    size_t subfieldsCapacity;
+
+    /// Fields whose tags aren't in this filter are skipped without reading their subfields,
+    /// or `NULL` to read every field. The filter isn't owned by the view, and must outlive it.
+    BibMarcFieldFilter const *filter;
+} BibMarcRecordView;
+
+/// Read the fields and subfields of a record without copying their content.
+/// - parameter view: A zero-initialized record view, or a view that was previously read into.
+/// - parameter buffer: The raw data of the record, beginning with its leader.
+///                     This buffer must not be changed or freed while the view is in use.
+/// - parameter length: The length of the raw data buffer, which may extend past the end of the record.
+/// - returns: The length of the record read from the buffer, or `0` when the record's data is malformed.
+/// - postcondition: The view's fields are only those allowed by its filter, in the same order as the directory.
+///                  Every directory entry is still checked, so a malformed record fails regardless of its filter.
+size_t BibMarcRecordViewRead(BibMarcRecordView *view, int8_t const *buffer, size_t length);
+
+/// Determine whether or not the field is a control field.
+boolean_t BibMarcFieldViewIsControlField(BibMarcFieldView const *field);
+
+/// Get the data of a control field, or the subfield data of a content field, without its field terminator.
+BibMarcSlice BibMarcFieldViewGetContent(BibMarcRecordView const *view, BibMarcFieldView const *field);
+
+/// Get the subfields belonging to a content field.
+/// - returns: The first of the field's `subfieldsCount` subfields.
+BibMarcSubfieldView const *BibMarcFieldViewGetSubfields(BibMarcRecordView const *view, BibMarcFieldView const *field);
+
+/// Get the content of a subfield, without its subfield code.
+BibMarcSlice BibMarcSubfieldViewGetContent(BibMarcRecordView const *view, BibMarcSubfieldView const *subfield);
+
+#pragma mark - Buffers
+
+/// A growable buffer for a record's raw data, which can be reused for many records.
+typedef struct BibMarcBuffer {
+    int8_t *bytes;
+    size_t capacity;
+} BibMarcBuffer;
+
+/// Make sure a buffer has room for at least the given number of bytes.
+/// - parameter buffer: A zero-initialized buffer, or a buffer that was previously reserved.
+/// - parameter length: The minimum number of bytes the buffer needs to hold.
+/// - returns: `true` when the buffer is large enough, or `false` when it couldn't be grown.
+/// - postcondition: Bytes already in the buffer are kept when it's grown.
+boolean_t BibMarcBufferReserve(BibMarcBuffer *buffer, size_t length);
+
 #pragma mark - Writing
 
 boolean_t BibMarcLeaderWrite(BibMarcLeader const *leader, int8_t *buffer, size_t length);
@@ -107,4 +212,11 @@ void BibMarcSubfieldDestroy(BibMarcSubfield *subfield);
 void BibMarcContentFieldDestroy(BibMarcContentField *field);
 void BibMarcRecordDestroy(BibMarcRecord *record);
 
+/// Free the field and subfield storage kept by a record view.
+///
+/// The record's raw data isn't owned by the view, and isn't freed.
+void BibMarcRecordViewDestroy(BibMarcRecordView *view);
+
+void BibMarcBufferDestroy(BibMarcBuffer *buffer);
+
 NS_ASSUME_NONNULL_END
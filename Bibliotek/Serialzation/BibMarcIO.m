@@ -69,56 +69,22 @@ boolean_t BibMarcControlFieldRead(BibMarcControlField *const field, BibMarcDirec
     return true;
 }
 
-size_t BibMarcSubfieldRead(BibMarcSubfield *const subfield, int8_t const *const buffer, size_t const length)
+/// Find the next subfield delimiter in a field's data.
+///
+/// `memchr` is vectorized by the C library, so it scans long subfields such as notes and URLs many bytes at a time.
+/// Only delimiters need to be found, because the field terminator always lies at the field's known upper bound.
+/// - parameter bytes: The raw data containing the field.
+/// - parameter location: The location in `bytes` where the search should begin.
+/// - parameter upper_bound: The location of the field terminator, or the end of the field's subfield data.
+/// - returns: The location of the next delimiter, or `upper_bound` when the field has no more subfields.
+static inline size_t BibMarcFindSubfieldDelimiter(int8_t const *const bytes, size_t const location,
+                                                  size_t const upper_bound)
 {
-    assert(subfield != nil);
-    assert(buffer != NULL);
-    assert(length >= 3); // minimum [delimiter][code][delimiter/terminator]
-
-    // subfield must always begin with a delimiter
-    assert(buffer[0] == kSubfieldDelimiter);
-
-    // read subfield code
-    subfield->code = buffer[1];
-
-    // find string content length
-    size_t const location = 2;
-    size_t cursor = location;
-    int8_t byte = buffer[cursor];
-    while (byte != kSubfieldDelimiter && byte != kFieldTerminator)
-    {
-        cursor += 1;
-        assert(cursor < length);
-        byte = buffer[cursor];
-    }
-
-    // content must always end with a delimiter or terminator
-    assert(byte == kSubfieldDelimiter || byte == kFieldTerminator);
-
-    // read string content
-    size_t const content_len = cursor - location;
-    subfield->content = calloc(content_len + 1, sizeof(char));
-    memcpy(subfield->content, buffer + location, content_len);
-    subfield->content[content_len] = '\0'; // null-terminate strings
-    return cursor;
-}
-
-size_t BibMarcContentFieldReadSubfieldsCount(BibMarcDirectoryEntry const *const entry,
-                                             int8_t const *const buffer, size_t const length)
-{
-    size_t const location = entry->fieldLocation + 2; // ignore the two indicator characters
-    size_t const upper_bound = entry->fieldLocation + entry->fieldLength;
-    assert(location < upper_bound);
-    assert(upper_bound < length);
-    size_t count = 0;
-    for (size_t index = location; index < upper_bound; index += 1)
-    {
-        if (buffer[index] == kSubfieldDelimiter)
-        {
-            count += 1;
-        }
+    if (location >= upper_bound) {
+        return upper_bound;
     }
-    return count;
+    int8_t const *const delimiter = memchr(bytes + location, kSubfieldDelimiter, upper_bound - location);
+    return (delimiter == NULL) ? upper_bound : (size_t)(delimiter - bytes);
 }
 
 boolean_t BibMarcContentFieldRead(BibMarcContentField *const field, BibMarcDirectoryEntry const *const entry,
@@ -131,35 +97,60 @@ boolean_t BibMarcContentFieldRead(BibMarcContentField *const field, BibMarcDirec
     // read tag and indicators
     strcpy(field->tag, entry->fieldTag);
     memcpy(field->indicators, buffer + entry->fieldLocation, 2);
+    field->subfields = NULL;
+    field->subfieldsCount = 0;
 
-    // allocate subfields
-    size_t const count = BibMarcContentFieldReadSubfieldsCount(entry, buffer, length);
-    field->subfields = calloc(count, sizeof(BibMarcSubfield));
-    field->subfieldsCount = count;
+    // content must always end with a field terminator
+    size_t const upper_bound = entry->fieldLocation + entry->fieldLength - 1;
+    assert(buffer[upper_bound] == kFieldTerminator);
+    if (buffer[upper_bound] != kFieldTerminator) {
+        return false;
+    }
 
-    // read subfields
-    size_t buffer_len = entry->fieldLength - 2;
-    int8_t const *buffer_ptr = buffer + entry->fieldLocation + 2;
-    for (size_t index = 0; index < count; index += 1)
+    // read subfields in a single pass, growing the subfield table as each one is found
+    size_t capacity = 0;
+    size_t cursor = entry->fieldLocation + kNumberOfIndicators;
+    while (cursor < upper_bound)
     {
-        size_t const offset = BibMarcSubfieldRead(&(field->subfields[index]), buffer_ptr, buffer_len);
-        buffer_len -= offset;
-        buffer_ptr += offset;
+        // subfield must always begin with a delimiter and a subfield code
+        assert(buffer[cursor] == kSubfieldDelimiter);
+        if (buffer[cursor] != kSubfieldDelimiter || cursor + 1 >= upper_bound) {
+            return false;
+        }
+        if (field->subfieldsCount == capacity) {
+            capacity = MAX(4, capacity * 2);
+            BibMarcSubfield *const subfields = realloc(field->subfields, capacity * sizeof(BibMarcSubfield));
+            if (subfields == NULL) {
+                return false;
+            }
+            field->subfields = subfields;
+        }
+        size_t const location = cursor + kLengthOfSubfieldCode;
+        size_t const next = BibMarcFindSubfieldDelimiter(buffer, location, upper_bound);
+
+        // read string content
+        BibMarcSubfield *const subfield = &(field->subfields[field->subfieldsCount]);
+        size_t const content_len = next - location;
+        subfield->code = buffer[cursor + 1];
+        subfield->content = calloc(content_len + 1, sizeof(char));
+        memcpy(subfield->content, buffer + location, content_len);
+        subfield->content[content_len] = '\0'; // null-terminate strings
+        field->subfieldsCount += 1;
+        cursor = next;
     }
-
-    assert(buffer_len == 1);
-    assert(buffer_ptr[0] == kFieldTerminator);
-    return (buffer_len == 1) && (buffer_ptr[0] == kFieldTerminator);
+    return true;
 }
 
 /// \note Directory entries must be sorted by tag, beginning with entries for control fields.
-size_t BibMarcDirectoryGetControlEntryCount(BibMarcDirectoryEntry const *const directory, size_t const length)
+/// - parameter directory: The raw data of the record's directory.
+/// - parameter length: The number of entries in the directory.
+size_t BibMarcDirectoryGetControlEntryCount(int8_t const *const directory, size_t const length)
 {
     size_t count = 0;
     for (size_t index = 0; index < length; index += 1)
     {
-        BibMarcDirectoryEntry const *const entry = &(directory[index]);
-        if (entry->fieldTag[0] == '0' && entry->fieldTag[1] == '0')
+        int8_t const *const tag = directory + (index * kDirectoryEntryLength);
+        if (tag[0] == '0' && tag[1] == '0')
         {
             count += 1;
         }
@@ -189,27 +180,24 @@ size_t BibMarcRecordRead(BibMarcRecord *const record, int8_t const *const buffer
     buffer_ptr += kLeaderLength;
     buffer_len -= kLeaderLength;
 
-    // read the directory entries
+    // skip over the directory, whose entries are read in place as each field is read
     size_t const directory_len = (leader.fieldsLocation - kLeaderLength) / kDirectoryEntryLength;
-    BibMarcDirectoryEntry *const directory = alloca(directory_len * sizeof(BibMarcDirectoryEntry));
-    for (size_t index = 0; index < directory_len; index += 1)
-    {
-        directory[index] = BibMarcDirectoryEntryRead(buffer_ptr, buffer_len);
-        buffer_ptr += kDirectoryEntryLength;
-        buffer_len -= kDirectoryEntryLength;
-    }
+    int8_t const *const directory_ptr = buffer_ptr;
+    buffer_ptr += directory_len * kDirectoryEntryLength;
+    buffer_len -= directory_len * kDirectoryEntryLength;
     assert(buffer_ptr[0] == kFieldTerminator);
     if (buffer_ptr[0] != kFieldTerminator) { return 0; }
     buffer_ptr += 1;
     buffer_len -= 1;
 
     // read control fields
-    size_t const control_count = BibMarcDirectoryGetControlEntryCount(directory, directory_len);
+    size_t const control_count = BibMarcDirectoryGetControlEntryCount(directory_ptr, directory_len);
     BibMarcControlField *const control_fields = calloc(control_count, sizeof(BibMarcControlField));
     for (size_t index = 0; index < control_count; index += 1)
     {
-        BibMarcDirectoryEntry const *const entry = &(directory[index]);
-        boolean_t const success = BibMarcControlFieldRead(&(control_fields[index]), entry, buffer_ptr, buffer_len);
+        int8_t const *const entry_ptr = directory_ptr + (index * kDirectoryEntryLength);
+        BibMarcDirectoryEntry const entry = BibMarcDirectoryEntryRead(entry_ptr, kDirectoryEntryLength);
+        boolean_t const success = BibMarcControlFieldRead(&(control_fields[index]), &entry, buffer_ptr, buffer_len);
         assert(success);
     }
 
@@ -219,8 +207,9 @@ size_t BibMarcRecordRead(BibMarcRecord *const record, int8_t const *const buffer
     for (size_t index = 0; index < content_count; index += 1)
     {
         size_t const entry_index = index + control_count;
-        BibMarcDirectoryEntry const *const entry = &(directory[entry_index]);
-        boolean_t const success = BibMarcContentFieldRead(&(content_fields[index]), entry, buffer_ptr, buffer_len);
+        int8_t const *const entry_ptr = directory_ptr + (entry_index * kDirectoryEntryLength);
+        BibMarcDirectoryEntry const entry = BibMarcDirectoryEntryRead(entry_ptr, kDirectoryEntryLength);
+        boolean_t const success = BibMarcContentFieldRead(&(content_fields[index]), &entry, buffer_ptr, buffer_len);
         assert(success);
     }
 
@@ -235,6 +224,199 @@ size_t BibMarcRecordRead(BibMarcRecord *const record, int8_t const *const buffer
     return leader.recordLength;
 }
 
+#pragma mark - Record Views
+
+/// Make sure the view has room for at least the given number of fields.
+static boolean_t BibMarcRecordViewReserveFields(BibMarcRecordView *const view, size_t const count)
+{
+    if (count <= view->fieldsCapacity) {
+        return true;
+    }
+    BibMarcFieldView *const fields = realloc(view->fields, count * sizeof(BibMarcFieldView));
+    if (fields == NULL) {
+        return false;
+    }
+    view->fields = fields;
+    view->fieldsCapacity = count;
+    return true;
+}
+
+/// Make sure the view has room for at least the given number of subfields.
+static boolean_t BibMarcRecordViewReserveSubfields(BibMarcRecordView *const view, size_t const count)
+{
+    if (count <= view->subfieldsCapacity) {
+        return true;
+    }
+    size_t const capacity = MAX(count, view->subfieldsCapacity * 2);
+    BibMarcSubfieldView *const subfields = realloc(view->subfields, capacity * sizeof(BibMarcSubfieldView));
+    if (subfields == NULL) {
+        return false;
+    }
+    view->subfields = subfields;
+    view->subfieldsCapacity = capacity;
+    return true;
+}
+
+/// Get a field tag's position in a field filter.
+/// - returns: The numeric value of the tag, or `NSNotFound` when the tag isn't made of three digits.
+static inline size_t BibMarcFieldFilterGetTagIndex(char const *const tag)
+{
+    size_t index = 0;
+    for (size_t position = 0; position < 3; position += 1) {
+        if (tag[position] < '0' || tag[position] > '9') { return NSNotFound; }
+        index = (index * 10) + (size_t)(tag[position] - '0');
+    }
+    return index;
+}
+
+boolean_t BibMarcFieldFilterAddTag(BibMarcFieldFilter *const filter, char const *const tag)
+{
+    assert(filter != NULL);
+    size_t const index = BibMarcFieldFilterGetTagIndex(tag);
+    if (index == NSNotFound) { return false; }
+    filter->tags[index / 8] |= (uint8_t)(1 << (index % 8));
+    return true;
+}
+
+boolean_t BibMarcFieldFilterContainsTag(BibMarcFieldFilter const *const filter, char const *const tag)
+{
+    assert(filter != NULL);
+    size_t const index = BibMarcFieldFilterGetTagIndex(tag);
+    return index != NSNotFound && (filter->tags[index / 8] & (1 << (index % 8))) != 0;
+}
+
+/// Find the subfields in a content field's data in a single pass over its bytes.
+/// - parameter field: A content field whose content location and length have already been read.
+static boolean_t BibMarcRecordViewReadSubfields(BibMarcRecordView *const view, BibMarcFieldView *const field)
+{
+    int8_t const *const bytes = view->bytes;
+    size_t const upper_bound = field->contentLocation + field->contentLength;
+    field->subfieldsIndex = view->subfieldsCount;
+    field->subfieldsCount = 0;
+    if (field->contentLength == 0) {
+        return true;
+    }
+
+    // subfield data must always begin with a delimiter
+    if (bytes[field->contentLocation] != kSubfieldDelimiter) {
+        return false;
+    }
+    size_t cursor = field->contentLocation;
+    while (cursor < upper_bound) {
+        // every subfield needs a code following its delimiter
+        if (cursor + 1 >= upper_bound || !BibMarcRecordViewReserveSubfields(view, view->subfieldsCount + 1)) {
+            return false;
+        }
+        size_t const location = cursor + kLengthOfSubfieldCode;
+        size_t const next = BibMarcFindSubfieldDelimiter(bytes, location, upper_bound);
+        BibMarcSubfieldView *const subfield = &(view->subfields[view->subfieldsCount]);
+        subfield->code = bytes[cursor + 1];
+        subfield->contentLocation = location;
+        subfield->contentLength = next - location;
+        view->subfieldsCount += 1;
+        field->subfieldsCount += 1;
+        cursor = next;
+    }
+    return true;
+}
+
+size_t BibMarcRecordViewRead(BibMarcRecordView *const view, int8_t const *const buffer, size_t const length)
+{
+    assert(view != NULL);
+    assert(buffer != NULL);
+    view->fieldsCount = 0;
+    view->subfieldsCount = 0;
+    if (length < kLeaderLength) { return 0; }
+
+    // read the record leader
+    BibMarcLeader const leader = BibMarcLeaderRead(buffer, length);
+    if (leader.recordLength == NSNotFound || leader.fieldsLocation == NSNotFound
+        || leader.recordLength > length || leader.fieldsLocation <= kLeaderLength
+        || leader.fieldsLocation >= leader.recordLength) { return 0; }
+
+    // records must always end with a record terminator, and the directory must end with a field terminator
+    if (buffer[leader.recordLength - 1] != kRecordTerminator
+        || buffer[leader.fieldsLocation - 1] != kFieldTerminator) { return 0; }
+    view->leader = leader;
+    view->bytes = buffer;
+
+    // read fields directly from the directory entries
+    size_t const directory_len = (leader.fieldsLocation - kLeaderLength - 1) / kDirectoryEntryLength;
+    if (!BibMarcRecordViewReserveFields(view, directory_len)) { return 0; }
+    for (size_t index = 0; index < directory_len; index += 1)
+    {
+        int8_t const *const entry_ptr = buffer + kLeaderLength + (index * kDirectoryEntryLength);
+        BibMarcDirectoryEntry const entry = BibMarcDirectoryEntryRead(entry_ptr, kDirectoryEntryLength);
+        size_t const location = leader.fieldsLocation + entry.fieldLocation;
+        if (entry.fieldLength == NSNotFound || entry.fieldLocation == NSNotFound || entry.fieldLength == 0
+            || location + entry.fieldLength >= leader.recordLength
+            || buffer[location + entry.fieldLength - 1] != kFieldTerminator) { return 0; }
+
+        // skip unwanted fields before doing any work on their content
+        if (view->filter != NULL && !BibMarcFieldFilterContainsTag(view->filter, entry.fieldTag)) { continue; }
+
+        BibMarcFieldView *const field = &(view->fields[view->fieldsCount]);
+        memcpy(field->tag, entry.fieldTag, sizeof(field->tag));
+        if (BibMarcFieldViewIsControlField(field)) {
+            field->indicators[0] = 0;
+            field->indicators[1] = 0;
+            field->contentLocation = location;
+            field->contentLength = entry.fieldLength - 1;
+            field->subfieldsIndex = view->subfieldsCount;
+            field->subfieldsCount = 0;
+        } else {
+            if (entry.fieldLength < kNumberOfIndicators + 1) { return 0; }
+            memcpy(field->indicators, buffer + location, kNumberOfIndicators);
+            field->contentLocation = location + kNumberOfIndicators;
+            field->contentLength = entry.fieldLength - kNumberOfIndicators - 1;
+            if (!BibMarcRecordViewReadSubfields(view, field)) { return 0; }
+        }
+        view->fieldsCount += 1;
+    }
+    return leader.recordLength;
+}
+
+boolean_t BibMarcFieldViewIsControlField(BibMarcFieldView const *const field)
+{
+    return field->tag[0] == '0' && field->tag[1] == '0';
+}
+
+BibMarcSlice BibMarcFieldViewGetContent(BibMarcRecordView const *const view, BibMarcFieldView const *const field)
+{
+    return (BibMarcSlice){ .bytes = view->bytes + field->contentLocation, .length = field->contentLength };
+}
+
+BibMarcSubfieldView const *BibMarcFieldViewGetSubfields(BibMarcRecordView const *const view,
+                                                        BibMarcFieldView const *const field)
+{
+    return view->subfields + field->subfieldsIndex;
+}
+
+BibMarcSlice BibMarcSubfieldViewGetContent(BibMarcRecordView const *const view,
+                                           BibMarcSubfieldView const *const subfield)
+{
+    return (BibMarcSlice){ .bytes = view->bytes + subfield->contentLocation, .length = subfield->contentLength };
+}
+
+#pragma mark - Buffers
+
+boolean_t BibMarcBufferReserve(BibMarcBuffer *const buffer, size_t const length)
+{
+    assert(buffer != NULL);
+    if (length <= buffer->capacity) {
+        return true;
+    }
+    // grow geometrically so that a run of slightly larger records doesn't reallocate for each one
+    size_t const capacity = MAX(length, buffer->capacity * 2);
+    int8_t *const bytes = realloc(buffer->bytes, capacity);
+    if (bytes == NULL) {
+        return false;
+    }
+    buffer->bytes = bytes;
+    buffer->capacity = capacity;
+    return true;
+}
+
 #pragma mark - Writing
 
 boolean_t BibMarcLeaderWrite(BibMarcLeader const *const leader, int8_t *const buffer, size_t const length)
@@ -512,6 +694,35 @@ void BibMarcRecordDestroy(BibMarcRecord *const record)
     }
 }
 
+void BibMarcRecordViewDestroy(BibMarcRecordView *const view)
+{
+    if (view->fields != NULL)
+    {
+        free(view->fields);
+        view->fields = NULL;
+    }
+    if (view->subfields != NULL)
+    {
+        free(view->subfields);
+        view->subfields = NULL;
+    }
+    view->fieldsCount = 0;
+    view->fieldsCapacity = 0;
+    view->subfieldsCount = 0;
+    view->subfieldsCapacity = 0;
+    view->bytes = NULL;
+}
+
+void BibMarcBufferDestroy(BibMarcBuffer *const buffer)
+{
+    if (buffer->bytes != NULL)
+    {
+        free(buffer->bytes);
+        buffer->bytes = NULL;
+    }
+    buffer->capacity = 0;
+}
+
 
 #pragma mark - Helpers
 
@@ -0,0 +1,90 @@
+//
+//  BibParallelRecordReader.h
+//  Bibliotek
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <Bibliotek/BibAttributes.h>
+#import <Bibliotek/BibMARCSerialization.h>
+
+@class BibRecord;
+@class BibMARCMappedFile;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A reader that decodes MARC 21 records on multiple threads at the same time.
+///
+/// Records are split into chunks along record boundaries, which are found using the record length in each
+/// record's leader. Each chunk is decoded on a background worker, while the next chunks are being read,
+/// so that parsing records and converting their MARC-8 content to Unicode is spread across every processor.
+///
+/// Decoded records are handed back to the caller on the thread that started reading them, one at a time.
+/// Records are delivered in the same order they appear in the input unless ``preservesOrder`` is `NO`,
+/// in which case each chunk's records are delivered as soon as that chunk is decoded.
+///
+/// A parallel record reader isn't thread-safe, and its properties shouldn't be changed while it's reading.
+NS_SWIFT_NAME(ParallelRecordReader)
+@interface BibParallelRecordReader : NSObject
+
+/// Deliver records in the order they appear in the input.
+///
+/// Set this to `NO` when the order of records doesn't matter, so that a slow chunk doesn't keep the records
+/// after it from being delivered. Each record's index in the input is still given alongside it.
+///
+/// The default value is `YES`.
+@property (nonatomic, assign) BOOL preservesOrder;
+
+/// The amount of records decoded together by a single worker.
+///
+/// Larger chunks spend less time coordinating workers, while smaller chunks deliver their first records sooner.
+///
+/// The default value is `256`.
+@property (nonatomic, assign) NSUInteger recordsPerChunk;
+
+/// The most chunks that can be read but not yet delivered at any one time.
+///
+/// This limits both the amount of workers decoding records at once, and the amount of memory used to hold
+/// records that have been decoded but not yet delivered.
+///
+/// The default value is twice the amount of active processors.
+@property (nonatomic, assign) NSUInteger maximumConcurrentChunks;
+
+/// Options for decoding each record.
+///
+/// The default value is no options.
+@property (nonatomic, assign) BibMARCReadingOptions readingOptions;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Create a reader that decodes the records in a mapped file.
+/// - parameter file: A mapped file of MARC 21 records.
+/// - returns: A reader that decodes all of the records in `file` each time they are enumerated.
+- (instancetype)initWithMappedFile:(BibMARCMappedFile *)file NS_DESIGNATED_INITIALIZER;
+
+/// Create a reader that decodes the records in an input stream.
+///
+/// Raw record data is read from the stream sequentially, and only the decoding of records is done in parallel.
+/// The stream is opened when records are first enumerated, and its records can only be enumerated once.
+/// - parameter inputStream: A stream of MARC 21 encoded data.
+/// - returns: A reader that decodes the records read from `inputStream`.
+- (instancetype)initWithInputStream:(NSInputStream *)inputStream NS_DESIGNATED_INITIALIZER;
+
+/// Decode each of the reader's records, and call the given block with each one.
+/// - parameter block: A block called with each decoded record and its index in the input.
+///                    The block is always called on the thread that called this method, one record at a time.
+///                    Set `stop` to `YES` to stop reading records.
+/// - parameter error: A pointer to an `NSError` variable that can be used to return an
+///                    error value when `NO` is returned.
+/// - returns: `YES` when every record was read and decoded, or when enumeration was stopped by `block`.
+///            Otherwise, `NO` is returned when the input couldn't be read or a record's data is malformed.
+///            When ``preservesOrder`` is `YES`, every record before the one that failed is delivered first.
+- (BOOL)enumerateRecordsUsingBlock:(void (NS_NOESCAPE ^)(BibRecord *record, NSUInteger index, BOOL *stop))block
+                             error:(out NSError *_Nullable __autoreleasing *_Nullable)error
+    NS_SWIFT_NAME(enumerateRecords(using:));
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,262 @@
+//
+//  BibParallelRecordReader.m
+//  Bibliotek
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+
+#import "BibParallelRecordReader.h"
+#import "BibMARCMappedFile.h"
+#import "BibMARCSerialization+Internal.h"
+#import "BibRecord.h"
+
+static NSUInteger const BibParallelRecordReaderDefaultRecordsPerChunk = 256;
+
+#pragma mark - Chunk
+
+/// A run of consecutive records that are decoded together by a single worker.
+@interface BibParallelRecordReaderChunk : NSObject
+
+/// The position of the chunk among all of the chunks read from the input.
+@property (nonatomic, readonly) NSUInteger sequence;
+
+/// The index in the input of the chunk's first record.
+@property (nonatomic, readonly) NSUInteger firstIndex;
+
+/// The amount of records in the chunk.
+@property (nonatomic, readonly) NSUInteger count;
+
+/// The chunk's decoded records, which are available once the chunk has been decoded.
+@property (nonatomic, readonly, nullable) NSArray<BibRecord *> *records;
+
+/// An error that ended reading or decoding the chunk's records.
+/// Records before the failure are still in ``records``.
+@property (nonatomic, readonly, nullable) NSError *error;
+
+/// Decode the chunk's records.
+- (void)decodeWithOptions:(BibMARCReadingOptions)options;
+
+@end
+
+@implementation BibParallelRecordReaderChunk {
+    BibMARCMappedFile *_file;
+    BibMarcBuffer _data;
+    NSUInteger *_lengths;
+}
+
+/// Create a chunk of records from a mapped file.
+- (instancetype)initWithSequence:(NSUInteger)sequence file:(BibMARCMappedFile *)file range:(NSRange)range {
+    if (self = [super init]) {
+        _sequence = sequence;
+        _firstIndex = range.location;
+        _file = file;
+        _count = range.length;
+    }
+    return self;
+}
+
+/// Create a chunk of records by reading their raw data from an input stream.
+/// - postcondition: The chunk has no records when the stream has no more records to read.
+- (instancetype)initWithSequence:(NSUInteger)sequence
+                      firstIndex:(NSUInteger)firstIndex
+                     inputStream:(NSInputStream *)inputStream
+                        capacity:(NSUInteger)capacity {
+    if (self = [super init]) {
+        _sequence = sequence;
+        _firstIndex = firstIndex;
+        _lengths = calloc(capacity, sizeof(NSUInteger));
+        NSUInteger offset = 0;
+        while (_count < capacity && [inputStream hasBytesAvailable]) {
+            NSError *error = nil;
+            NSUInteger const length = [BibMARCSerialization readRecordDataFromStream:inputStream
+                                                                              buffer:&_data
+                                                                              offset:offset
+                                                                               error:&error];
+            if (length == 0) {
+                // there's no error when the stream has simply run out of records
+                _error = error;
+                break;
+            }
+            _lengths[_count] = length;
+            _count += 1;
+            offset += length;
+        }
+    }
+    return self;
+}
+
+- (void)dealloc {
+    BibMarcBufferDestroy(&_data);
+    free(_lengths);
+}
+
+- (void)decodeWithOptions:(BibMARCReadingOptions)options {
+    NSMutableArray *const records = [NSMutableArray arrayWithCapacity:_count];
+    BibMarcRecordView view = {};
+    uint8_t const *bytes = (uint8_t const *)_data.bytes;
+    for (NSUInteger index = 0; index < _count; index += 1) {
+        @autoreleasepool {
+            NSError *error = nil;
+            BibRecord *record = nil;
+            if (_file != nil) {
+                NSData *const data = [_file dataForRecordAtIndex:(_firstIndex + index)];
+                record = [BibMARCSerialization recordFromBytes:[data bytes]
+                                                        length:[data length]
+                                                          view:&view
+                                                       options:options
+                                                         error:&error];
+            } else {
+                record = [BibMARCSerialization recordFromBytes:bytes
+                                                        length:_lengths[index]
+                                                          view:&view
+                                                       options:options
+                                                         error:&error];
+                bytes += _lengths[index];
+            }
+            if (record == nil) {
+                // a malformed record comes before any error reading the rest of the chunk
+                _error = error;
+                break;
+            }
+            [records addObject:record];
+        }
+    }
+    BibMarcRecordViewDestroy(&view);
+    _records = [records copy];
+}
+
+@end
+
+#pragma mark - Reader
+
+@implementation BibParallelRecordReader {
+    BibMARCMappedFile *_file;
+    NSInputStream *_inputStream;
+}
+
+- (instancetype)init {
+    [self doesNotRecognizeSelector:_cmd];
+    return nil;
+}
+
+- (instancetype)initWithMappedFile:(BibMARCMappedFile *)file {
+    if (self = [super init]) {
+        _file = file;
+        _preservesOrder = YES;
+        _recordsPerChunk = BibParallelRecordReaderDefaultRecordsPerChunk;
+        _maximumConcurrentChunks = [[NSProcessInfo processInfo] activeProcessorCount] * 2;
+    }
+    return self;
+}
+
+- (instancetype)initWithInputStream:(NSInputStream *)inputStream {
+    if (self = [super init]) {
+        _inputStream = inputStream;
+        _preservesOrder = YES;
+        _recordsPerChunk = BibParallelRecordReaderDefaultRecordsPerChunk;
+        _maximumConcurrentChunks = [[NSProcessInfo processInfo] activeProcessorCount] * 2;
+    }
+    return self;
+}
+
+/// Read the next chunk of records from the input.
+/// - returns: The next chunk, or `nil` when there are no more records to read.
+///            The returned chunk has an error when the input couldn't be read after its last record.
+- (BibParallelRecordReaderChunk *)nextChunkWithSequence:(NSUInteger)sequence firstIndex:(NSUInteger)firstIndex {
+    NSUInteger const capacity = MAX(1, _recordsPerChunk);
+    if (_file != nil) {
+        NSUInteger const count = [_file count];
+        if (firstIndex >= count) {
+            return nil;
+        }
+        NSRange const range = NSMakeRange(firstIndex, MIN(capacity, count - firstIndex));
+        return [[BibParallelRecordReaderChunk alloc] initWithSequence:sequence file:_file range:range];
+    }
+    BibParallelRecordReaderChunk *const chunk = [[BibParallelRecordReaderChunk alloc] initWithSequence:sequence
+                                                                                            firstIndex:firstIndex
+                                                                                           inputStream:_inputStream
+                                                                                              capacity:capacity];
+    return ([chunk count] > 0 || [chunk error] != nil) ? chunk : nil;
+}
+
+- (BOOL)enumerateRecordsUsingBlock:(void (NS_NOESCAPE ^)(BibRecord *, NSUInteger, BOOL *))block
+                             error:(out NSError *__autoreleasing *)error {
+    if (_inputStream != nil && [_inputStream streamStatus] == NSStreamStatusNotOpen) {
+        [_inputStream open];
+    }
+    BOOL const preservesOrder = _preservesOrder;
+    BibMARCReadingOptions const readingOptions = _readingOptions;
+    NSUInteger const maximumConcurrentChunks = MAX(1, _maximumConcurrentChunks);
+    dispatch_queue_t const queue = dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0);
+    dispatch_group_t const group = dispatch_group_create();
+
+    // decoded chunks waiting to be delivered, keyed by their sequence
+    NSCondition *const condition = [NSCondition new];
+    NSMutableDictionary<NSNumber *, BibParallelRecordReaderChunk *> *const decodedChunks = [NSMutableDictionary new];
+
+    NSUInteger submittedCount = 0;
+    NSUInteger deliveredCount = 0;
+    NSUInteger nextIndex = 0;
+    BOOL exhausted = NO;
+    BOOL stop = NO;
+    NSError *failure = nil;
+    while (!stop && failure == nil) {
+        // keep the workers busy with as many chunks as are allowed to be outstanding
+        while (!exhausted && submittedCount - deliveredCount < maximumConcurrentChunks) {
+            BibParallelRecordReaderChunk *const chunk = [self nextChunkWithSequence:submittedCount
+                                                                         firstIndex:nextIndex];
+            if (chunk == nil) {
+                exhausted = YES;
+                break;
+            }
+            submittedCount += 1;
+            nextIndex += [chunk count];
+            exhausted = ([chunk error] != nil);
+            dispatch_group_async(group, queue, ^{
+                [chunk decodeWithOptions:readingOptions];
+                [condition lock];
+                decodedChunks[@([chunk sequence])] = chunk;
+                [condition signal];
+                [condition unlock];
+            });
+        }
+        if (deliveredCount == submittedCount) {
+            break;
+        }
+
+        // wait for the next chunk to be delivered to finish decoding
+        BibParallelRecordReaderChunk *chunk = nil;
+        [condition lock];
+        while (chunk == nil) {
+            chunk = (preservesOrder) ? decodedChunks[@(deliveredCount)]
+                                     : [[decodedChunks objectEnumerator] nextObject];
+            if (chunk == nil) {
+                [condition wait];
+            }
+        }
+        [decodedChunks removeObjectForKey:@([chunk sequence])];
+        [condition unlock];
+        deliveredCount += 1;
+
+        NSArray<BibRecord *> *const records = [chunk records];
+        NSUInteger const count = [records count];
+        for (NSUInteger index = 0; index < count && !stop; index += 1) {
+            @autoreleasepool {
+                block(records[index], [chunk firstIndex] + index, &stop);
+            }
+        }
+        if (!stop) {
+            failure = [chunk error];
+        }
+    }
+
+    // chunks still being decoded refer to the input, so let them finish before returning
+    dispatch_group_wait(group, DISPATCH_TIME_FOREVER);
+    if (failure != nil && error != NULL) {
+        *error = failure;
+    }
+    return failure == nil;
+}
+
+@end
@@ -0,0 +1,118 @@
+//
+//  BibMARCFileIndexTests.m
+//  BibliotekTests
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import <Bibliotek/Bibliotek.h>
+
+@interface BibMARCFileIndexTests : XCTestCase
+
+@end
+
+@implementation BibMARCFileIndexTests {
+    NSString *_path;
+    NSString *_indexPath;
+    BibMARCMappedFile *_file;
+}
+
+- (NSData *)dataForRecordNamed:(NSString *)recordName {
+    NSBundle *const bundle = [NSBundle bundleForClass:[self class]];
+    NSString *const path = [bundle pathForResource:recordName ofType:@"marc8"];
+    return [NSData dataWithContentsOfFile:path];
+}
+
+- (void)setUp {
+    [super setUp];
+    NSData *const bibliographicData = [self dataForRecordNamed:@"BibliographicRecord"];
+    NSMutableData *const data = [bibliographicData mutableCopy];
+    [data appendData:[self dataForRecordNamed:@"ClassificationRecord"]];
+    [data appendData:bibliographicData];
+    _path = [NSTemporaryDirectory() stringByAppendingPathComponent:[[NSUUID UUID] UUIDString]];
+    _indexPath = [BibMARCFileIndex indexPathForFileAtPath:_path];
+    [data writeToFile:_path atomically:YES];
+    _file = [[BibMARCMappedFile alloc] initWithFileAtPath:_path error:NULL];
+}
+
+- (void)tearDown {
+    [[NSFileManager defaultManager] removeItemAtPath:_path error:NULL];
+    [[NSFileManager defaultManager] removeItemAtPath:_indexPath error:NULL];
+    [super tearDown];
+}
+
+#pragma mark -
+
+- (void)testWriteIndex {
+    NSError *error = nil;
+    BibFieldPath *const keyPath = [[BibFieldPath alloc] initWithFieldTagString:@"001"];
+    XCTAssertTrue([BibMARCFileIndex writeIndexForFile:_file keyPath:keyPath toPath:_indexPath error:&error]);
+    XCTAssertNil(error);
+    BibMARCFileIndex *const index = [[BibMARCFileIndex alloc] initWithContentsOfFile:_indexPath error:&error];
+    XCTAssertNil(error);
+    XCTAssertEqual([index count], 3);
+    XCTAssertEqual([index fileSize], [_file fileSize]);
+    XCTAssertEqualObjects([index keyPath], keyPath);
+    for (NSUInteger position = 0; position < [index count]; position += 1) {
+        XCTAssertTrue(NSEqualRanges([index byteRangeOfRecordAtIndex:position],
+                                    [_file byteRangeOfRecordAtIndex:position]));
+    }
+    XCTAssertThrowsSpecificNamed([index byteRangeOfRecordAtIndex:3], NSException, NSRangeException);
+}
+
+- (void)testFindRecordsByKey {
+    BibFieldPath *const keyPath = [[BibFieldPath alloc] initWithFieldTagString:@"001"];
+    [BibMARCFileIndex writeIndexForFile:_file keyPath:keyPath toPath:_indexPath error:NULL];
+    BibMARCFileIndex *const index = [[BibMARCFileIndex alloc] initWithContentsOfFile:_indexPath error:NULL];
+    XCTAssertEqual([index indexOfRecordWithKey:@"CF 00433757"], 1);
+    XCTAssertEqual([index indexOfRecordWithKey:@"  CF 00433757 "], 1);
+    XCTAssertEqual([index indexOfRecordWithKey:@"CF 0043375"], NSNotFound);
+
+    NSString *const controlNumber = [[[_file recordAtIndex:0] contentWithFieldPath:keyPath] firstObject];
+    NSMutableIndexSet *const expected = [NSMutableIndexSet indexSetWithIndex:0];
+    [expected addIndex:2];
+    XCTAssertEqualObjects([index indexesOfRecordsWithKey:controlNumber], expected);
+}
+
+- (void)testDataFieldKeyPath {
+    BibFieldPath *const keyPath = [[BibFieldPath alloc] initWithFieldTagString:@"245"];
+    XCTAssertThrowsSpecificNamed([BibMARCFileIndex writeIndexForFile:_file keyPath:keyPath toPath:_indexPath error:NULL],
+                                 NSException, NSInvalidArgumentException);
+}
+
+- (void)testMapFileWithIndex {
+    [BibMARCFileIndex writeIndexForFile:_file keyPath:nil toPath:_indexPath error:NULL];
+    BibMARCFileIndex *const index = [[BibMARCFileIndex alloc] initWithContentsOfFile:_indexPath error:NULL];
+    XCTAssertNil([index keyPath]);
+    XCTAssertEqual([index indexOfRecordWithKey:@"CF 00433757"], NSNotFound);
+
+    NSError *error = nil;
+    BibMARCMappedFile *const file = [[BibMARCMappedFile alloc] initWithFileAtPath:_path index:index error:&error];
+    XCTAssertNil(error);
+    XCTAssertEqual([file count], 3);
+    XCTAssertEqualObjects([file recordAtIndex:1], [_file recordAtIndex:1]);
+}
+
+- (void)testRejectOutdatedIndex {
+    [BibMARCFileIndex writeIndexForFile:_file keyPath:nil toPath:_indexPath error:NULL];
+    BibMARCFileIndex *const index = [[BibMARCFileIndex alloc] initWithContentsOfFile:_indexPath error:NULL];
+    NSFileHandle *const handle = [NSFileHandle fileHandleForWritingAtPath:_path];
+    [handle seekToEndOfFile];
+    [handle writeData:[self dataForRecordNamed:@"ClassificationRecord"]];
+    [handle closeFile];
+
+    NSError *error = nil;
+    XCTAssertNil([[BibMARCMappedFile alloc] initWithFileAtPath:_path index:index error:&error]);
+    XCTAssertEqualObjects([error domain], BibSerializationErrorDomain);
+}
+
+- (void)testOpenMalformedIndex {
+    [[@"not a record index" dataUsingEncoding:NSUTF8StringEncoding] writeToFile:_indexPath atomically:YES];
+    NSError *error = nil;
+    XCTAssertNil([[BibMARCFileIndex alloc] initWithContentsOfFile:_indexPath error:&error]);
+    XCTAssertEqualObjects([error domain], BibSerializationErrorDomain);
+}
+
+@end
@@ -60,4 +60,25 @@
 
 }
 
+- (void)testReadFilteredFields {
+    BibMARCInputStream *const inputStream = [self inputStreamForRecordNamed:@"BibliographicRecord"];
+    BibFieldTag *const controlNumberTag = [[BibFieldTag alloc] initWithString:@"001"];
+    BibFieldTag *const titleStatementTag = [[BibFieldTag alloc] initWithString:@"245"];
+    BibFieldPath *const titlePath = [[BibFieldPath alloc] initWithFieldTag:titleStatementTag subfieldCode:@"a"];
+    [inputStream setFieldFilter:[NSSet setWithObjects:controlNumberTag, titlePath, nil]];
+    NSError *error = nil;
+    BibRecord *const record = [inputStream readRecord:&error];
+    XCTAssertNil(error);
+    XCTAssertEqual([[record fields] count], 2);
+    XCTAssertEqualObjects([[[record fields] firstObject] fieldTag], controlNumberTag);
+    BibRecordField *const field = [record fieldWithTag:titleStatementTag];
+    XCTAssertEqualObjects([[field subfieldWithCode:@"c"] content], @"Arika Okrent.");
+}
+
+- (void)testInvalidFieldFilter {
+    BibMARCInputStream *const inputStream = [self inputStreamForRecordNamed:@"BibliographicRecord"];
+    XCTAssertThrowsSpecificNamed([inputStream setFieldFilter:[NSSet setWithObject:@"245"]],
+                                 NSException, NSInvalidArgumentException);
+}
+
 @end
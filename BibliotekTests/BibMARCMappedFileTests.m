@@ -0,0 +1,98 @@
+//
+//  BibMARCMappedFileTests.m
+//  BibliotekTests
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import <Bibliotek/Bibliotek.h>
+
+@interface BibMARCMappedFileTests : XCTestCase
+
+@end
+
+@implementation BibMARCMappedFileTests {
+    NSString *_path;
+    NSData *_bibliographicData;
+    NSData *_classificationData;
+}
+
+- (NSData *)dataForRecordNamed:(NSString *)recordName {
+    NSBundle *const bundle = [NSBundle bundleForClass:[self class]];
+    NSString *const path = [bundle pathForResource:recordName ofType:@"marc8"];
+    return [NSData dataWithContentsOfFile:path];
+}
+
+- (void)setUp {
+    [super setUp];
+    _bibliographicData = [self dataForRecordNamed:@"BibliographicRecord"];
+    _classificationData = [self dataForRecordNamed:@"ClassificationRecord"];
+    NSMutableData *const data = [_bibliographicData mutableCopy];
+    [data appendData:_classificationData];
+    [data appendBytes:"\n" length:1];
+    [data appendData:_bibliographicData];
+    _path = [NSTemporaryDirectory() stringByAppendingPathComponent:[[NSUUID UUID] UUIDString]];
+    [data writeToFile:_path atomically:YES];
+}
+
+- (void)tearDown {
+    [[NSFileManager defaultManager] removeItemAtPath:_path error:NULL];
+    [super tearDown];
+}
+
+#pragma mark -
+
+- (void)testFindRecords {
+    NSError *error = nil;
+    BibMARCMappedFile *const file = [[BibMARCMappedFile alloc] initWithFileAtPath:_path error:&error];
+    XCTAssertNil(error);
+    XCTAssertEqual([file count], 3);
+    XCTAssertEqual([file fileSize], [_bibliographicData length] * 2 + [_classificationData length] + 1);
+    XCTAssertTrue(NSEqualRanges([file byteRangeOfRecordAtIndex:0], NSMakeRange(0, [_bibliographicData length])));
+    XCTAssertTrue(NSEqualRanges([file byteRangeOfRecordAtIndex:1],
+                                NSMakeRange([_bibliographicData length], [_classificationData length])));
+    XCTAssertEqualObjects([file dataForRecordAtIndex:1], _classificationData);
+    XCTAssertEqualObjects([file dataForRecordAtIndex:2], _bibliographicData);
+    XCTAssertThrowsSpecificNamed([file recordAtIndex:3], NSException, NSRangeException);
+}
+
+- (void)testRecordAtIndex {
+    BibMARCMappedFile *const file = [[BibMARCMappedFile alloc] initWithFileAtPath:_path error:NULL];
+    BibRecord *const expected = [[BibMARCSerialization recordsFromData:_classificationData error:NULL] firstObject];
+    XCTAssertEqualObjects([file recordAtIndex:1], expected);
+    XCTAssertEqualObjects([file recordAtIndex:0], [file recordAtIndex:2]);
+}
+
+- (void)testEnumerateRecords {
+    BibMARCMappedFile *const file = [[BibMARCMappedFile alloc] initWithFileAtPath:_path error:NULL];
+    NSMutableArray *const records = [NSMutableArray array];
+    for (BibRecord *record in file) {
+        [records addObject:record];
+    }
+    XCTAssertEqual([records count], 3);
+    XCTAssertEqualObjects(records[1], [file recordAtIndex:1]);
+
+    __block NSUInteger count = 0;
+    [file enumerateRecordsInRange:NSMakeRange(1, 2) usingBlock:^(BibRecord *record, NSUInteger index, BOOL *stop) {
+        XCTAssertEqualObjects(record, records[index]);
+        count += 1;
+        *stop = YES;
+    }];
+    XCTAssertEqual(count, 1);
+}
+
+- (void)testMapFileWithoutRecords {
+    NSString *const path = [_path stringByAppendingPathExtension:@"txt"];
+    [[@"not a MARC 21 record" dataUsingEncoding:NSUTF8StringEncoding] writeToFile:path atomically:YES];
+    NSError *error = nil;
+    XCTAssertNil([[BibMARCMappedFile alloc] initWithFileAtPath:path error:&error]);
+    XCTAssertEqualObjects([error domain], BibSerializationErrorDomain);
+    [[NSFileManager defaultManager] removeItemAtPath:path error:NULL];
+
+    XCTAssertNil([[BibMARCMappedFile alloc] initWithFileAtPath:path error:&error]);
+    XCTAssertEqualObjects([error domain], NSPOSIXErrorDomain);
+}
+
+@end
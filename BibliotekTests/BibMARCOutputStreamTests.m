@@ -82,4 +82,41 @@
     XCTAssertEqualObjects(readRecord, rereadRecord);
 }
 
+
+- (void)testWriteBufferedRecords {
+    BibRecord *const classificationRecord = [self classificationRecord];
+    BibRecord *const bibliographicRecord = [self bibliographicRecord];
+    NSData *const classificationData = [BibMARCSerialization dataWithRecord:classificationRecord error:NULL];
+
+    NSError *error = nil;
+    NSOutputStream *const memoryStream = [NSOutputStream outputStreamToMemory];
+    BibMARCOutputStream *const outputStream = [[[BibMARCOutputStream alloc] initWithOutputStream:memoryStream] open];
+    [outputStream setBufferSize:1000];
+    XCTAssertTrue([outputStream writeRecord:classificationRecord error:&error]);
+    XCTAssertTrue([outputStream writeRecord:bibliographicRecord error:&error]);
+    XCTAssertTrue([outputStream writeRecord:classificationRecord error:&error]);
+    XCTAssertNil(error);
+    NSUInteger const writtenLength = [[memoryStream propertyForKey:NSStreamDataWrittenToMemoryStreamKey] length];
+    XCTAssertGreaterThan(writtenLength, 0);
+    XCTAssertEqual(writtenLength % 1000, 0);
+    [outputStream close];
+
+    NSArray *const records = [BibMARCSerialization recordsFromData:[outputStream data] error:&error];
+    NSArray *const expected = @[classificationRecord, bibliographicRecord, classificationRecord];
+    XCTAssertNil(error);
+    XCTAssertEqualObjects(records, expected);
+    XCTAssertEqualObjects([[outputStream data] subdataWithRange:NSMakeRange(0, [classificationData length])],
+                          classificationData);
+}
+
+- (void)testWriteUnbufferedRecords {
+    BibRecord *const record = [self classificationRecord];
+    NSOutputStream *const memoryStream = [NSOutputStream outputStreamToMemory];
+    BibMARCOutputStream *const outputStream = [[[BibMARCOutputStream alloc] initWithOutputStream:memoryStream] open];
+    [outputStream setBufferSize:0];
+    XCTAssertTrue([outputStream writeRecord:record error:NULL]);
+    NSData *const data = [memoryStream propertyForKey:NSStreamDataWrittenToMemoryStreamKey];
+    XCTAssertEqualObjects(data, [BibMARCSerialization dataWithRecord:record error:NULL]);
+}
+
 @end
@@ -124,6 +124,18 @@
     XCTAssertEqualObjects([[field subfieldWithCode:@"a"] content], @"E585.I75");
 }
 
-
+- (void)testReadLazyContent {
+    NSMutableData *const data = [[self dataForRecordNamed:@"MARC8Record1"] mutableCopy];
+    [data appendData:[self dataForRecordNamed:@"BibliographicRecord"]];
+    NSError *error = nil;
+    NSArray<BibRecord *> *const records = [BibMARCSerialization recordsFromData:data
+                                                                        options:BibMARCReadingLazyContent
+                                                                          error:&error];
+    XCTAssertNil(error);
+    BibFieldTag *const classificationFieldNumberTag = [[BibFieldTag alloc] initWithString:@"153"];
+    BibRecordField *const field = [[[records firstObject] fieldsWithTag:classificationFieldNumberTag] firstObject];
+    XCTAssertEqualObjects([[field subfieldWithCode:@"j"] content], @"K\x6F\xCC\x88nig, Josef, 1893-1974");
+    XCTAssertEqualObjects(records, [BibMARCSerialization recordsFromData:data error:NULL]);
+}
 
 @end
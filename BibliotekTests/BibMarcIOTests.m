@@ -0,0 +1,121 @@
+//
+//  BibMarcIOTests.m
+//  BibliotekTests
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import <Bibliotek/Bibliotek.h>
+#import "BibMarcIO.h"
+
+@interface BibMarcIOTests : XCTestCase
+
+@end
+
+@implementation BibMarcIOTests
+
+- (NSData *)dataForRecordNamed:(NSString *)recordName {
+    NSBundle *const bundle = [NSBundle bundleForClass:[self class]];
+    NSString *const path = [bundle pathForResource:recordName ofType:@"marc8"];
+    return [NSData dataWithContentsOfFile:path];
+}
+
+static NSString *BibMarcSliceGetString(BibMarcSlice const slice) {
+    return [[NSString alloc] initWithBytes:slice.bytes length:slice.length encoding:NSASCIIStringEncoding];
+}
+
+#pragma mark -
+
+- (void)testReadRecordView {
+    NSData *const data = [self dataForRecordNamed:@"ClassificationRecord"];
+    BibMarcRecordView view = {};
+    XCTAssertEqual(BibMarcRecordViewRead(&view, [data bytes], [data length]), [data length]);
+    XCTAssertEqual(view.fieldsCount, 10);
+
+    BibMarcFieldView const *const controlField = &(view.fields[0]);
+    XCTAssertTrue(BibMarcFieldViewIsControlField(controlField));
+    XCTAssertEqual(strcmp(controlField->tag, "001"), 0);
+    XCTAssertEqualObjects(BibMarcSliceGetString(BibMarcFieldViewGetContent(&view, controlField)), @"CF 00433757");
+
+    BibMarcFieldView const *const contentField = &(view.fields[7]);
+    XCTAssertFalse(BibMarcFieldViewIsControlField(contentField));
+    XCTAssertEqual(strcmp(contentField->tag, "153"), 0);
+    XCTAssertEqual(contentField->indicators[0], ' ');
+    XCTAssertEqual(contentField->indicators[1], ' ');
+    XCTAssertEqual(contentField->subfieldsCount, 5);
+    BibMarcSubfieldView const *const subfields = BibMarcFieldViewGetSubfields(&view, contentField);
+    XCTAssertEqual(subfields[0].code, 'a');
+    XCTAssertEqualObjects(BibMarcSliceGetString(BibMarcSubfieldViewGetContent(&view, &(subfields[0]))), @"KJV5461.3");
+    XCTAssertEqual(subfields[4].code, 'j');
+    XCTAssertEqualObjects(BibMarcSliceGetString(BibMarcSubfieldViewGetContent(&view, &(subfields[4]))),
+                          @"Private schools");
+    BibMarcRecordViewDestroy(&view);
+}
+
+- (void)testReuseRecordView {
+    NSData *const bibliographicData = [self dataForRecordNamed:@"BibliographicRecord"];
+    NSData *const classificationData = [self dataForRecordNamed:@"ClassificationRecord"];
+    BibMarcRecordView view = {};
+    XCTAssertEqual(BibMarcRecordViewRead(&view, [bibliographicData bytes], [bibliographicData length]),
+                   [bibliographicData length]);
+    BibMarcFieldView const *const fields = view.fields;
+    size_t const subfieldsCapacity = view.subfieldsCapacity;
+    XCTAssertEqual(BibMarcRecordViewRead(&view, [classificationData bytes], [classificationData length]),
+                   [classificationData length]);
+    XCTAssertEqual(view.fields, fields);
+    XCTAssertEqual(view.subfieldsCapacity, subfieldsCapacity);
+    XCTAssertEqual(view.fieldsCount, 10);
+    BibMarcRecordViewDestroy(&view);
+}
+
+- (void)testReadMalformedRecordView {
+    NSData *const data = [self dataForRecordNamed:@"ClassificationRecord"];
+    BibMarcRecordView view = {};
+    XCTAssertEqual(BibMarcRecordViewRead(&view, [data bytes], [data length] - 1), 0);
+    XCTAssertEqual(BibMarcRecordViewRead(&view, [data bytes], 20), 0);
+    NSMutableData *const corrupted = [data mutableCopy];
+    ((int8_t *)[corrupted mutableBytes])[[corrupted length] - 1] = ' ';
+    XCTAssertEqual(BibMarcRecordViewRead(&view, [corrupted bytes], [corrupted length]), 0);
+    BibMarcRecordViewDestroy(&view);
+}
+
+- (void)testReadFilteredRecordView {
+    NSData *const data = [self dataForRecordNamed:@"ClassificationRecord"];
+    BibMarcFieldFilter filter = {};
+    XCTAssertTrue(BibMarcFieldFilterAddTag(&filter, "001"));
+    XCTAssertTrue(BibMarcFieldFilterAddTag(&filter, "153"));
+    XCTAssertFalse(BibMarcFieldFilterAddTag(&filter, "15a"));
+    XCTAssertTrue(BibMarcFieldFilterContainsTag(&filter, "153"));
+    XCTAssertFalse(BibMarcFieldFilterContainsTag(&filter, "245"));
+
+    BibMarcRecordView view = { .filter = &filter };
+    XCTAssertEqual(BibMarcRecordViewRead(&view, [data bytes], [data length]), [data length]);
+    XCTAssertEqual(view.fieldsCount, 2);
+    XCTAssertEqual(view.subfieldsCount, 5);
+    XCTAssertEqual(strcmp(view.fields[0].tag, "001"), 0);
+    XCTAssertEqual(strcmp(view.fields[1].tag, "153"), 0);
+    BibMarcSubfieldView const *const subfields = BibMarcFieldViewGetSubfields(&view, &(view.fields[1]));
+    XCTAssertEqualObjects(BibMarcSliceGetString(BibMarcSubfieldViewGetContent(&view, &(subfields[4]))),
+                          @"Private schools");
+    BibMarcRecordViewDestroy(&view);
+}
+
+- (void)testReserveBuffer {
+    BibMarcBuffer buffer = {};
+    XCTAssertTrue(BibMarcBufferReserve(&buffer, 24));
+    XCTAssertGreaterThanOrEqual(buffer.capacity, 24);
+    memcpy(buffer.bytes, "00376nw  a2200145n  4500", 24);
+    XCTAssertTrue(BibMarcBufferReserve(&buffer, 99999));
+    XCTAssertGreaterThanOrEqual(buffer.capacity, 99999);
+    XCTAssertEqual(memcmp(buffer.bytes, "00376nw  a2200145n  4500", 24), 0);
+    int8_t const *const bytes = buffer.bytes;
+    XCTAssertTrue(BibMarcBufferReserve(&buffer, 500));
+    XCTAssertEqual(buffer.bytes, bytes);
+    BibMarcBufferDestroy(&buffer);
+    XCTAssertTrue(buffer.bytes == NULL);
+    XCTAssertEqual(buffer.capacity, 0);
+}
+
+@end
@@ -0,0 +1,114 @@
+//
+//  BibParallelRecordReaderTests.m
+//  BibliotekTests
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import <Bibliotek/Bibliotek.h>
+
+@interface BibParallelRecordReaderTests : XCTestCase
+
+@end
+
+@implementation BibParallelRecordReaderTests {
+    NSData *_data;
+    NSArray<BibRecord *> *_records;
+}
+
+- (NSData *)dataForRecordNamed:(NSString *)recordName {
+    NSBundle *const bundle = [NSBundle bundleForClass:[self class]];
+    NSString *const path = [bundle pathForResource:recordName ofType:@"marc8"];
+    return [NSData dataWithContentsOfFile:path];
+}
+
+- (void)setUp {
+    [super setUp];
+    NSData *const bibliographicData = [self dataForRecordNamed:@"BibliographicRecord"];
+    NSData *const classificationData = [self dataForRecordNamed:@"ClassificationRecord"];
+    NSMutableData *const data = [NSMutableData data];
+    for (NSUInteger index = 0; index < 50; index += 1) {
+        [data appendData:(index % 3 == 0) ? classificationData : bibliographicData];
+    }
+    _data = [data copy];
+    _records = [BibMARCSerialization recordsFromData:_data error:NULL];
+}
+
+#pragma mark -
+
+- (void)testReadRecordsInOrder {
+    BibParallelRecordReader *const reader =
+        [[BibParallelRecordReader alloc] initWithInputStream:[NSInputStream inputStreamWithData:_data]];
+    [reader setRecordsPerChunk:4];
+    NSMutableArray *const records = [NSMutableArray array];
+    NSError *error = nil;
+    XCTAssertTrue([reader enumerateRecordsUsingBlock:^(BibRecord *record, NSUInteger index, BOOL *stop) {
+        XCTAssertEqual(index, [records count]);
+        [records addObject:record];
+    } error:&error]);
+    XCTAssertNil(error);
+    XCTAssertEqualObjects(records, _records);
+}
+
+- (void)testReadRecordsUnordered {
+    NSString *const path = [NSTemporaryDirectory() stringByAppendingPathComponent:[[NSUUID UUID] UUIDString]];
+    [_data writeToFile:path atomically:YES];
+    BibMARCMappedFile *const file = [[BibMARCMappedFile alloc] initWithFileAtPath:path error:NULL];
+    BibParallelRecordReader *const reader = [[BibParallelRecordReader alloc] initWithMappedFile:file];
+    [reader setRecordsPerChunk:3];
+    [reader setPreservesOrder:NO];
+    NSMutableIndexSet *const indexes = [NSMutableIndexSet indexSet];
+    XCTAssertTrue([reader enumerateRecordsUsingBlock:^(BibRecord *record, NSUInteger index, BOOL *stop) {
+        XCTAssertFalse([indexes containsIndex:index]);
+        XCTAssertEqualObjects(record, self->_records[index]);
+        [indexes addIndex:index];
+    } error:NULL]);
+    XCTAssertEqualObjects(indexes, [NSIndexSet indexSetWithIndexesInRange:NSMakeRange(0, [_records count])]);
+    [[NSFileManager defaultManager] removeItemAtPath:path error:NULL];
+}
+
+- (void)testStopReadingRecords {
+    BibParallelRecordReader *const reader =
+        [[BibParallelRecordReader alloc] initWithInputStream:[NSInputStream inputStreamWithData:_data]];
+    [reader setRecordsPerChunk:2];
+    __block NSUInteger count = 0;
+    XCTAssertTrue([reader enumerateRecordsUsingBlock:^(BibRecord *record, NSUInteger index, BOOL *stop) {
+        count += 1;
+        *stop = (index == 6);
+    } error:NULL]);
+    XCTAssertEqual(count, 7);
+}
+
+- (void)testReadMalformedRecord {
+    NSMutableData *const data = [_data mutableCopy];
+    [data appendData:[@"00000not a MARC 21 record" dataUsingEncoding:NSASCIIStringEncoding]];
+    BibParallelRecordReader *const reader =
+        [[BibParallelRecordReader alloc] initWithInputStream:[NSInputStream inputStreamWithData:data]];
+    [reader setRecordsPerChunk:8];
+    __block NSUInteger count = 0;
+    NSError *error = nil;
+    XCTAssertFalse([reader enumerateRecordsUsingBlock:^(BibRecord *record, NSUInteger index, BOOL *stop) {
+        count += 1;
+    } error:&error]);
+    XCTAssertEqualObjects([error domain], BibSerializationErrorDomain);
+    XCTAssertEqual(count, [_records count]);
+}
+
+- (void)testReadTruncatedRecord {
+    NSMutableData *const data = [_data mutableCopy];
+    [data appendData:[[self dataForRecordNamed:@"BibliographicRecord"] subdataWithRange:NSMakeRange(0, 100)]];
+    BibParallelRecordReader *const reader =
+        [[BibParallelRecordReader alloc] initWithInputStream:[NSInputStream inputStreamWithData:data]];
+    [reader setRecordsPerChunk:8];
+    __block NSUInteger count = 0;
+    NSError *error = nil;
+    XCTAssertFalse([reader enumerateRecordsUsingBlock:^(BibRecord *record, NSUInteger index, BOOL *stop) {
+        count += 1;
+    } error:&error]);
+    XCTAssertEqualObjects([error domain], BibSerializationErrorDomain);
+    XCTAssertEqual(count, [_records count]);
+}
+
+@end
@@ -0,0 +1,585 @@
+//
+//  main.c
+//  LCCallNumberBenchmark
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+//  A throughput benchmark for the Library of Congress call number engine in `Bibliotek/Classification`.
+//
+//  The benchmark only depends on the C standard library and POSIX threads, so it can be built with a plain C
+//  compiler from the repository's root directory:
+//
+//      cc -std=gnu11 -O2 -IBibliotek/Classification -o lccalln-bench LCCallNumberBenchmark/main.c
+//          Bibliotek/Classification/bib*.c -lpthread
+//
+//  Usage:
+//
+//      lccalln-bench [-n count] [-r rounds] [-s seed] [-t threads]
+//
+//  A corpus of `count` call numbers is generated from `seed`, so that runs can be compared between revisions.
+//  Each measurement is repeated `rounds` times and the fastest round is reported. Before measuring, the results
+//  of parsing, sorting, and formatting are checked against the behavior expected by `LCCallNumberTests`, and the
+//  benchmark exits with a non-zero status when any check fails.
+//
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "bibtype.h"
+#include "bibparse.h"
+#include "bibtypeio.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#pragma mark - random numbers
+
+/// The state of a xorshift64* pseudo-random number generator.
+typedef struct bench_random {
+    uint64_t state;
+} bench_random_t;
+
+static uint64_t bench_random_next(bench_random_t *const random)
+{
+    random->state ^= random->state >> 12;
+    random->state ^= random->state << 25;
+    random->state ^= random->state >> 27;
+    return random->state * UINT64_C(0x2545F4914F6CDD1D);
+}
+
+/// Get a random number from `0` up to, but not including, `bound`.
+static size_t bench_random_below(bench_random_t *const random, size_t const bound)
+{
+    return (size_t)(bench_random_next(random) % bound);
+}
+
+/// Get `true` with the given chance out of one hundred.
+static bool bench_random_chance(bench_random_t *const random, size_t const percent)
+{
+    return bench_random_below(random, 100) < percent;
+}
+
+#pragma mark - corpus
+
+/// The longest string generated for any part of a call number, including the null terminator.
+#define BENCH_STRING_LENGTH 96
+
+/// A generated call number string, along with the separate strings of its subject, cutters, and specifications.
+typedef struct bench_entry {
+    char string[BENCH_STRING_LENGTH];
+    char subject[BENCH_STRING_LENGTH];
+    char cutters[BENCH_STRING_LENGTH];
+    char specifications[BENCH_STRING_LENGTH];
+} bench_entry_t;
+
+/// Subject classes weighted roughly by how often they appear in an academic library's collection.
+static char const *const bench_classes[] = {
+    "B", "BF", "BL", "BR", "BX", "D", "DA", "DC", "DR", "DS", "E", "F", "G", "GN", "GV", "H", "HB", "HD", "HD",
+    "HF", "HM", "HN", "HQ", "HV", "J", "JC", "JK", "JZ", "K", "KF", "KF", "KFN", "KZ", "L", "LB", "LC", "M", "ML",
+    "MT", "N", "NA", "NK", "P", "PA", "PC", "PE", "PN", "PN", "PQ", "PR", "PR", "PS", "PS", "PT", "Q", "QA", "QA",
+    "QA", "QB", "QC", "QD", "QE", "QH", "QK", "QL", "R", "RA", "RC", "RC", "S", "SB", "T", "TA", "TJ", "TK", "TX",
+    "U", "V", "Z"
+};
+
+static char const *const bench_volume_prefixes[] = { "v", "v", "v", "pt", "no", "bd", "t", "vol", "ser", "fasc" };
+static char const *const bench_supplement_prefixes[] = { "Suppl", "Suppl", "Index", "Appendix" };
+static char const *const bench_ordinal_suffixes[] = { "st", "nd", "rd", "th", "d" };
+
+#define BENCH_COUNT(array) (sizeof(array) / sizeof(*(array)))
+
+/// Append formatted text to the end of a string buffer.
+#define BENCH_APPEND(buffer, ...) \
+    snprintf((buffer) + strlen(buffer), sizeof(buffer) - strlen(buffer), __VA_ARGS__)
+
+/// Append a number between `1` and `max`, favoring smaller values like most class schedules do.
+static void bench_append_integer(char *const buffer, size_t const len, bench_random_t *const random,
+                                 size_t const max)
+{
+    size_t const magnitude = 1 + bench_random_below(random, 4);
+    size_t limit = 1;
+    for (size_t index = 0; index < magnitude; index += 1) {
+        limit *= 10;
+    }
+    size_t const value = 1 + bench_random_below(random, (limit < max) ? limit : max);
+    size_t const used = strlen(buffer);
+    snprintf(buffer + used, len - used, "%zu", value);
+}
+
+/// Append between one and `max` digits, where the last digit is never a zero.
+static void bench_append_digits(char *const buffer, size_t const len, bench_random_t *const random,
+                                size_t const max)
+{
+    size_t const count = 1 + bench_random_below(random, max);
+    size_t used = strlen(buffer);
+    for (size_t index = 0; index < count && used + 1 < len; index += 1) {
+        bool const last = (index + 1 == count);
+        buffer[used] = (char)('0' + ((last) ? 1 + bench_random_below(random, 9) : bench_random_below(random, 10)));
+        used += 1;
+    }
+    buffer[used] = '\0';
+}
+
+static void bench_append_year(char *const buffer, size_t const len, bench_random_t *const random)
+{
+    size_t const used = strlen(buffer);
+    snprintf(buffer + used, len - used, "%zu", 1850 + bench_random_below(random, 175));
+}
+
+static void bench_append_ordinal(char *const buffer, size_t const len, bench_random_t *const random)
+{
+    size_t const used = strlen(buffer);
+    char const *const suffix = bench_ordinal_suffixes[bench_random_below(random, BENCH_COUNT(bench_ordinal_suffixes))];
+    snprintf(buffer + used, len - used, "%zu%s", 1 + bench_random_below(random, 30), suffix);
+}
+
+/// Generate a random call number with the same mix of components found in a typical shelf-list.
+static void bench_entry_generate(bench_entry_t *const entry, bench_random_t *const random)
+{
+    memset(entry, 0, sizeof(bench_entry_t));
+
+    // subject class, subclass, and an occasional caption date or ordinal
+    BENCH_APPEND(entry->subject, "%s", bench_classes[bench_random_below(random, BENCH_COUNT(bench_classes))]);
+    bench_append_integer(entry->subject, sizeof(entry->subject), random, 9999);
+    if (bench_random_chance(random, 35)) {
+        BENCH_APPEND(entry->subject, ".");
+        bench_append_digits(entry->subject, sizeof(entry->subject), random, 3);
+    }
+    if (bench_random_chance(random, 4)) {
+        BENCH_APPEND(entry->subject, " ");
+        bench_append_year(entry->subject, sizeof(entry->subject), random);
+    } else if (bench_random_chance(random, 3)) {
+        BENCH_APPEND(entry->subject, " ");
+        bench_append_ordinal(entry->subject, sizeof(entry->subject), random);
+    }
+
+    // up to three cutter numbers, each with an occasional date
+    size_t const cutter_count = (bench_random_chance(random, 92)) ? 1 + bench_random_below(random, 3) : 0;
+    for (size_t index = 0; index < cutter_count; index += 1) {
+        BENCH_APPEND(entry->cutters, (index == 0) ? "." : " ");
+        BENCH_APPEND(entry->cutters, "%c", (char)('A' + bench_random_below(random, 26)));
+        bench_append_digits(entry->cutters, sizeof(entry->cutters), random, 3);
+        if (index + 1 < cutter_count && bench_random_chance(random, 8)) {
+            BENCH_APPEND(entry->cutters, " ");
+            bench_append_year(entry->cutters, sizeof(entry->cutters), random);
+        }
+    }
+
+    // a publication date followed by volumes, supplements, and edition ordinals
+    bool const has_date = bench_random_chance(random, 75);
+    if (has_date) {
+        bench_append_year(entry->specifications, sizeof(entry->specifications), random);
+    }
+    size_t const extra_count = (bench_random_chance(random, 30)) ? 1 + bench_random_below(random, 3) : 0;
+    for (size_t index = 0; index < extra_count; index += 1) {
+        if (has_date || index > 0) {
+            BENCH_APPEND(entry->specifications, " ");
+        }
+        size_t const kind = bench_random_below(random, 10);
+        if (kind < 6) {
+            size_t const count = BENCH_COUNT(bench_volume_prefixes);
+            BENCH_APPEND(entry->specifications, "%s. ", bench_volume_prefixes[bench_random_below(random, count)]);
+            bench_append_integer(entry->specifications, sizeof(entry->specifications), random, 99);
+        } else if (kind < 8) {
+            size_t const count = BENCH_COUNT(bench_supplement_prefixes);
+            BENCH_APPEND(entry->specifications, "%s ", bench_supplement_prefixes[bench_random_below(random, count)]);
+            bench_append_integer(entry->specifications, sizeof(entry->specifications), random, 9);
+        } else {
+            bench_append_ordinal(entry->specifications, sizeof(entry->specifications), random);
+        }
+    }
+
+    BENCH_APPEND(entry->string, "%s", entry->subject);
+    if (entry->cutters[0] != '\0') {
+        // the first cutter is often written without a space before it
+        BENCH_APPEND(entry->string, "%s%s", (bench_random_chance(random, 70)) ? "" : " ", entry->cutters);
+    }
+    if (entry->specifications[0] != '\0') {
+        BENCH_APPEND(entry->string, " %s", entry->specifications);
+    }
+}
+
+#pragma mark - timing
+
+/// Get the current time in nanoseconds from a monotonic clock.
+static uint64_t bench_now(void)
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (uint64_t)time.tv_sec * UINT64_C(1000000000) + (uint64_t)time.tv_nsec;
+}
+
+/// Print the throughput of an operation repeated `count` times over `elapsed` nanoseconds.
+static void bench_report(char const *const name, size_t const count, uint64_t const elapsed)
+{
+    double const seconds = (double)elapsed / 1e9;
+    double const rate = (seconds > 0) ? (double)count / seconds : 0;
+    double const each = (count > 0) ? (double)elapsed / (double)count : 0;
+    printf("  %-34s %14.0f /s %10.1f ns %10.2f ms\n", name, rate, each, (double)elapsed / 1e6);
+}
+
+/// Keep the optimizer from removing work whose result is otherwise unused.
+static volatile size_t bench_sink;
+
+#pragma mark - checks
+
+static size_t bench_failures = 0;
+
+static void bench_check(bool const condition, char const *const description)
+{
+    if (!condition) {
+        fprintf(stderr, "check failed: %s\n", description);
+        bench_failures += 1;
+    }
+}
+
+/// Check the sorted order expected by `BibNumberComparisonTests.test_02_sorted_array`.
+static void bench_check_fixture(void)
+{
+    char const *const strings[] = {
+        "QA76.76.C65 A37 1986", "DR1879.5.M37 M37 1988", "KF4558 15th .K46 1908", "JZ33.D4 1999 E37"
+    };
+    size_t const expected[] = { 1, 3, 2, 0 };
+    bib_lc_calln_t callns[4];
+    for (size_t index = 0; index < 4; index += 1) {
+        bench_check(bib_lc_calln_init(&(callns[index]), strings[index]), "parse the comparison test fixture");
+    }
+    unsigned char *encodings[4];
+    for (size_t index = 0; index < 4; index += 1) {
+        size_t const length = bib_lc_calln_encode(NULL, 0, &(callns[index]));
+        encodings[index] = malloc(length);
+        bib_lc_calln_encode(encodings[index], length, &(callns[index]));
+    }
+    size_t order[4] = { 0 };
+    bench_check(bib_lc_calln_encoded_sort(order, (unsigned char const *const *)encodings, 4, 1),
+                "sort the comparison test fixture");
+    bench_check(memcmp(order, expected, sizeof(order)) == 0, "sort the comparison test fixture in shelf order");
+    for (size_t index = 0; index < 4; index += 1) {
+        free(encodings[index]);
+        bib_lc_calln_deinit(&(callns[index]));
+    }
+}
+
+/// Check that every generated call number parses, sorts consistently, and formats to an equivalent string.
+static void bench_check_corpus(bench_entry_t const *const entries, bib_lc_calln_t *const callns, size_t const count,
+                               bib_lc_calln_style_t const style)
+{
+    size_t parsed = 0;
+    for (size_t index = 0; index < count; index += 1) {
+        if (bib_lc_calln_init(&(callns[index]), entries[index].string)) {
+            parsed += 1;
+        } else {
+            fprintf(stderr, "invalid call number: %s\n", entries[index].string);
+        }
+    }
+    bench_check(parsed == count, "parse every generated call number");
+    if (parsed != count) {
+        return;
+    }
+    for (size_t index = 0; index < count; index += 1) {
+        char string[BENCH_STRING_LENGTH * 2];
+        bib_lc_calln_t formatted;
+        bib_snprint_lc_calln(string, sizeof(string), &(callns[index]), style);
+        bool const success = bib_lc_calln_init(&formatted, string);
+        bench_check(success && bib_lc_calln_compare(bib_calln_ordered_same, &(callns[index]), &formatted, true)
+                               == bib_calln_ordered_same,
+                    "parse a formatted call number into an equivalent value");
+        bib_lc_calln_deinit(&formatted);
+    }
+    bench_check(bib_lc_calln_sort(callns, count, 0), "sort the generated call numbers");
+    size_t unordered = 0;
+    for (size_t index = 1; index < count; index += 1) {
+        bib_calln_comparison_t const result = bib_lc_calln_compare(bib_calln_ordered_same, &(callns[index - 1]),
+                                                                   &(callns[index]), false);
+        unordered += (result == bib_calln_ordered_descending) ? 1 : 0;
+    }
+    bench_check(unordered == 0, "sort the generated call numbers in shelf order");
+    for (size_t index = 0; index < count; index += 1) {
+        bib_lc_calln_deinit(&(callns[index]));
+    }
+}
+
+#pragma mark - measurements
+
+static void bench_measure_parse(bench_entry_t const *const entries, bib_lc_calln_t *const callns,
+                                size_t const count, size_t const rounds, unsigned const threads)
+{
+    uint64_t best = UINT64_MAX;
+    for (size_t round = 0; round < rounds; round += 1) {
+        uint64_t const start = bench_now();
+        for (size_t index = 0; index < count; index += 1) {
+            bench_sink += bib_lc_calln_init(&(callns[index]), entries[index].string);
+            bib_lc_calln_deinit(&(callns[index]));
+        }
+        uint64_t const elapsed = bench_now() - start;
+        best = (elapsed < best) ? elapsed : best;
+    }
+    bench_report("parse", count, best);
+
+    bib_lc_specification_t *const buffer = calloc(count, sizeof(bib_lc_specification_t));
+    best = UINT64_MAX;
+    for (size_t round = 0; round < rounds && buffer != NULL; round += 1) {
+        bib_lc_specification_arena_t arena;
+        bib_lc_specification_arena_init(&arena, buffer, count);
+        uint64_t const start = bench_now();
+        for (size_t index = 0; index < count; index += 1) {
+            bench_sink += bib_lc_calln_init_arena(&(callns[index]), entries[index].string, &arena);
+        }
+        uint64_t const elapsed = bench_now() - start;
+        for (size_t index = 0; index < count; index += 1) {
+            bib_lc_calln_deinit(&(callns[index]));
+        }
+        best = (elapsed < best) ? elapsed : best;
+    }
+    bench_report("parse (arena)", count, best);
+    free(buffer);
+
+    char const **const strings = calloc(count, sizeof(char const *));
+    for (size_t index = 0; index < count && strings != NULL; index += 1) {
+        strings[index] = entries[index].string;
+    }
+    best = UINT64_MAX;
+    for (size_t round = 0; round < rounds && strings != NULL; round += 1) {
+        uint64_t const start = bench_now();
+        bench_sink += bib_lc_calln_init_batch(callns, strings, count, NULL, threads);
+        uint64_t const elapsed = bench_now() - start;
+        for (size_t index = 0; index < count; index += 1) {
+            bib_lc_calln_deinit(&(callns[index]));
+        }
+        best = (elapsed < best) ? elapsed : best;
+    }
+    bench_report("parse (batch)", count, best);
+    free(strings);
+}
+
+static void bench_measure_components(bench_entry_t const *const entries, size_t const count, size_t const rounds)
+{
+    uint64_t subject = UINT64_MAX;
+    uint64_t cutters = UINT64_MAX;
+    uint64_t specifications = UINT64_MAX;
+    size_t cutter_count = 0;
+    size_t specification_count = 0;
+    for (size_t round = 0; round < rounds; round += 1) {
+        uint64_t start = bench_now();
+        for (size_t index = 0; index < count; index += 1) {
+            bib_lc_calln_t calln;
+            memset(&calln, 0, sizeof(bib_lc_calln_t));
+            bib_strbuf_t parser = bib_strbuf(entries[index].subject, 0);
+            bench_sink += bib_parse_lc_subject(&calln, &parser);
+        }
+        uint64_t elapsed = bench_now() - start;
+        subject = (elapsed < subject) ? elapsed : subject;
+
+        cutter_count = 0;
+        start = bench_now();
+        for (size_t index = 0; index < count; index += 1) {
+            if (entries[index].cutters[0] == '\0') {
+                continue;
+            }
+            bib_cuttseg_t segments[3];
+            memset(segments, 0, sizeof(segments));
+            bib_strbuf_t parser = bib_strbuf(entries[index].cutters, 0);
+            bench_sink += bib_parse_cuttseg_list(segments, &parser);
+            cutter_count += 1;
+        }
+        elapsed = bench_now() - start;
+        cutters = (elapsed < cutters) ? elapsed : cutters;
+
+        specification_count = 0;
+        start = bench_now();
+        for (size_t index = 0; index < count; index += 1) {
+            if (entries[index].specifications[0] == '\0') {
+                continue;
+            }
+            bib_lc_specification_list_t list;
+            memset(&list, 0, sizeof(bib_lc_specification_list_t));
+            bib_strbuf_t parser = bib_strbuf(entries[index].specifications, 0);
+            bench_sink += bib_parse_lc_remainder(&list, &parser);
+            bib_lc_specification_list_deinit(&list);
+            specification_count += 1;
+        }
+        elapsed = bench_now() - start;
+        specifications = (elapsed < specifications) ? elapsed : specifications;
+    }
+    bench_report("parse subject", count, subject);
+    bench_report("parse cutters", cutter_count, cutters);
+    bench_report("parse specifications", specification_count, specifications);
+}
+
+static void bench_measure_compare(bib_lc_calln_t const *const callns, size_t const count, size_t const rounds)
+{
+    if (count < 2) {
+        return;
+    }
+    size_t const pairs = count - 1;
+    for (int specify = 0; specify < 2; specify += 1) {
+        uint64_t best = UINT64_MAX;
+        for (size_t round = 0; round < rounds; round += 1) {
+            size_t sum = 0;
+            uint64_t const start = bench_now();
+            for (size_t index = 0; index < pairs; index += 1) {
+                sum += (size_t)bib_lc_calln_compare(bib_calln_ordered_same, &(callns[index]), &(callns[index + 1]),
+                                                    specify);
+            }
+            uint64_t const elapsed = bench_now() - start;
+            bench_sink += sum;
+            best = (elapsed < best) ? elapsed : best;
+        }
+        bench_report((specify) ? "compare (specialization)" : "compare (shelf order)", pairs, best);
+    }
+}
+
+static void bench_measure_sort(bib_lc_calln_t const *const callns, size_t const count, size_t const rounds,
+                               unsigned const threads)
+{
+    bib_lc_calln_t *const copy = calloc(count, sizeof(bib_lc_calln_t));
+    unsigned char **const encodings = calloc(count, sizeof(unsigned char *));
+    size_t *const order = calloc(count, sizeof(size_t));
+    if (copy == NULL || encodings == NULL || order == NULL) {
+        free(copy);
+        free(encodings);
+        free(order);
+        return;
+    }
+    unsigned const thread_counts[2] = { 1, threads };
+    for (size_t variant = 0; variant < 2; variant += 1) {
+        uint64_t best = UINT64_MAX;
+        for (size_t round = 0; round < rounds; round += 1) {
+            // the structures are only moved around, so a shallow copy keeps the originals intact
+            memcpy(copy, callns, count * sizeof(bib_lc_calln_t));
+            uint64_t const start = bench_now();
+            bench_sink += bib_lc_calln_sort(copy, count, thread_counts[variant]);
+            uint64_t const elapsed = bench_now() - start;
+            best = (elapsed < best) ? elapsed : best;
+        }
+        bench_report((variant == 0) ? "sort (1 thread)" : "sort (all threads)", count, best);
+    }
+
+    uint64_t const encode_start = bench_now();
+    for (size_t index = 0; index < count; index += 1) {
+        size_t const length = bib_lc_calln_encode(NULL, 0, &(callns[index]));
+        encodings[index] = malloc(length);
+        if (encodings[index] != NULL) {
+            bib_lc_calln_encode(encodings[index], length, &(callns[index]));
+        }
+    }
+    bench_report("encode", count, bench_now() - encode_start);
+    for (size_t variant = 0; variant < 2; variant += 1) {
+        uint64_t best = UINT64_MAX;
+        for (size_t round = 0; round < rounds; round += 1) {
+            uint64_t const start = bench_now();
+            bench_sink += bib_lc_calln_encoded_sort(order, (unsigned char const *const *)encodings, count,
+                                                    thread_counts[variant]);
+            uint64_t const elapsed = bench_now() - start;
+            best = (elapsed < best) ? elapsed : best;
+        }
+        bench_report((variant == 0) ? "sort encoded (1 thread)" : "sort encoded (all threads)", count, best);
+    }
+    for (size_t index = 0; index < count; index += 1) {
+        free(encodings[index]);
+    }
+    free(copy);
+    free(encodings);
+    free(order);
+}
+
+static void bench_measure_format(bib_lc_calln_t const *const callns, size_t const count, size_t const rounds,
+                                 bib_lc_calln_style_t const style)
+{
+    uint64_t best = UINT64_MAX;
+    for (size_t round = 0; round < rounds; round += 1) {
+        char buffer[BENCH_STRING_LENGTH * 2];
+        uint64_t const start = bench_now();
+        for (size_t index = 0; index < count; index += 1) {
+            bench_sink += bib_snprint_lc_calln(buffer, sizeof(buffer), &(callns[index]), style);
+        }
+        uint64_t const elapsed = bench_now() - start;
+        best = (elapsed < best) ? elapsed : best;
+    }
+    bench_report("format", count, best);
+
+    size_t *const offsets = calloc(count, sizeof(size_t));
+    size_t const length = (offsets == NULL) ? 0 : bib_lc_calln_format_batch(NULL, 0, offsets, callns, count, style);
+    char *const buffer = (length == 0) ? NULL : malloc(length);
+    best = UINT64_MAX;
+    for (size_t round = 0; round < rounds && buffer != NULL; round += 1) {
+        uint64_t const start = bench_now();
+        bench_sink += bib_lc_calln_format_batch(buffer, length, offsets, callns, count, style);
+        uint64_t const elapsed = bench_now() - start;
+        best = (elapsed < best) ? elapsed : best;
+    }
+    bench_report("format (batch)", count, best);
+    free(buffer);
+    free(offsets);
+}
+
+#pragma mark - main
+
+static void bench_usage(char const *const name)
+{
+    fprintf(stderr, "usage: %s [-n count] [-r rounds] [-s seed] [-t threads]\n", name);
+}
+
+int main(int argc, char *argv[])
+{
+    size_t count = 100000;
+    size_t rounds = 5;
+    uint64_t seed = 1;
+    unsigned threads = 0;
+    int option = 0;
+    while ((option = getopt(argc, argv, "n:r:s:t:h")) != -1) {
+        switch (option) {
+            case 'n': count = strtoul(optarg, NULL, 10); break;
+            case 'r': rounds = strtoul(optarg, NULL, 10); break;
+            case 's': seed = strtoull(optarg, NULL, 10); break;
+            case 't': threads = (unsigned)strtoul(optarg, NULL, 10); break;
+            default:
+                bench_usage(argv[0]);
+                return (option == 'h') ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+    if (count == 0 || rounds == 0) {
+        bench_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    bench_entry_t *const entries = calloc(count, sizeof(bench_entry_t));
+    bib_lc_calln_t *const callns = calloc(count, sizeof(bib_lc_calln_t));
+    if (entries == NULL || callns == NULL) {
+        fprintf(stderr, "unable to allocate a corpus of %zu call numbers\n", count);
+        return EXIT_FAILURE;
+    }
+    bench_random_t random = { .state = (seed == 0) ? 1 : seed };
+    for (size_t index = 0; index < count; index += 1) {
+        bench_entry_generate(&(entries[index]), &random);
+    }
+    bib_lc_calln_style_t const style = { .separator = ' ', .extra_cutpoint = true };
+
+    bench_check_fixture();
+    bench_check_corpus(entries, callns, count, style);
+    if (bench_failures > 0) {
+        fprintf(stderr, "%zu checks failed\n", bench_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("%zu call numbers, seed %llu, best of %zu rounds\n", count, (unsigned long long)seed, rounds);
+    printf("  for example: %s\n", entries[0].string);
+    bench_measure_parse(entries, callns, count, rounds, threads);
+    bench_measure_components(entries, count, rounds);
+
+    // the remaining measurements use the parsed call numbers in generated order
+    for (size_t index = 0; index < count; index += 1) {
+        bib_lc_calln_init(&(callns[index]), entries[index].string);
+    }
+    bench_measure_compare(callns, count, rounds);
+    bench_measure_sort(callns, count, rounds, threads);
+    bench_measure_format(callns, count, rounds, style);
+
+    for (size_t index = 0; index < count; index += 1) {
+        bib_lc_calln_deinit(&(callns[index]));
+    }
+    free(entries);
+    free(callns);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,78 @@
+//
+//  BibArenaParsingTests.m
+//  LCCallNumberTests
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "bibtype.h"
+#import "BibTestUtils.h"
+
+@interface BibArenaParsingTests : XCTestCase
+@end
+
+@implementation BibArenaParsingTests
+
+- (void)test_01_arena_parse_matches_heap_parse {
+    // call numbers with long runs of specifications, in addition to the shared call numbers
+    char const *const strs[] = {
+        BibTestCallNumberStringList, "QA76 1999 v. 1 pt. 2 suppl. 3 4th 2001", "QA76.A1 1999 2000 2001 2002 2003"
+    };
+    size_t const count = sizeof(strs) / sizeof(*strs);
+    bib_lc_specification_t buffer[64] = {};
+    bib_lc_specification_arena_t arena = {};
+    bib_lc_specification_arena_init(&arena, buffer, 64);
+    bib_lc_calln_t nums[sizeof(strs) / sizeof(*strs)] = {};
+    size_t used = 0;
+    for (size_t index = 0; index < count; index += 1) {
+        XCTAssertTrue(bib_lc_calln_init_arena(&(nums[index]), strs[index], &arena));
+        used += nums[index].remainder.length;
+        XCTAssertEqual(arena.length, used);
+        if (nums[index].remainder.length > 0) {
+            XCTAssertTrue(nums[index].remainder.arena == &arena);
+            XCTAssertTrue(nums[index].remainder.buffer == &(buffer[used - nums[index].remainder.length]));
+        }
+    }
+    size_t expected_used = 0;
+    for (size_t index = 0; index < count; index += 1) {
+        bib_lc_calln_t num = {};
+        XCTAssertTrue(bib_lc_calln_init(&num, strs[index]));
+        expected_used += num.remainder.length;
+        XCTAssertEqual(bib_lc_calln_compare(bib_calln_ordered_same, &num, &(nums[index]), true),
+                       bib_calln_ordered_same);
+        bib_lc_calln_deinit(&num);
+    }
+    XCTAssertEqual(used, expected_used);
+    bib_lc_specification_arena_reset(&arena);
+    XCTAssertEqual(arena.length, 0);
+}
+
+- (void)test_02_failed_parse_returns_arena_space {
+    bib_lc_specification_t buffer[8] = {};
+    bib_lc_specification_arena_t arena = {};
+    bib_lc_specification_arena_init(&arena, buffer, 8);
+    bib_lc_calln_t num = {};
+    XCTAssertFalse(bib_lc_calln_init_arena(&num, "QA76.A1 1999 2000 2001 2002 2003  ", &arena));
+    XCTAssertEqual(arena.length, 0);
+    XCTAssertTrue(bib_lc_calln_init_arena(&num, "QA76.A1 1999 2000 2001 2002 2003", &arena));
+    XCTAssertEqual(arena.length, 2);
+    bib_lc_calln_deinit(&num);
+    XCTAssertEqual(arena.length, 0);
+}
+
+- (void)test_03_full_arena_falls_back_to_heap {
+    bib_lc_specification_t buffer[2] = {};
+    bib_lc_specification_arena_t arena = {};
+    bib_lc_specification_arena_init(&arena, buffer, 2);
+    bib_lc_calln_t num = {};
+    XCTAssertTrue(bib_lc_calln_init_arena(&num, "QA76 1999 v. 1 pt. 2 suppl. 3 4th 2001", &arena));
+    XCTAssertEqual(num.remainder.length, 3);
+    XCTAssertTrue(num.remainder.arena == NULL);
+    XCTAssertEqual(arena.length, 0);
+    XCTAssertEqual(num.remainder.buffer[2].kind, bib_lc_specification_kind_date);
+    bib_lc_calln_deinit(&num);
+}
+
+@end
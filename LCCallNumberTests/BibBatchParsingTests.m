@@ -0,0 +1,75 @@
+//
+//  BibBatchParsingTests.m
+//  LCCallNumberTests
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import <Bibliotek/Bibliotek.h>
+#import "bibtype.h"
+#import "BibTestUtils.h"
+
+@interface BibBatchParsingTests : XCTestCase
+@end
+
+/// Strings that the batch should fail to parse, mixed in among the shared call numbers.
+static char const *const bib_batch_invalid_strings[] = { "not a call number", "" };
+
+@implementation BibBatchParsingTests
+
+- (void)test_01_batch_matches_single_parse {
+    size_t const invalid_count = sizeof(bib_batch_invalid_strings) / sizeof(*bib_batch_invalid_strings);
+    size_t const length = BibTestCallNumberStringsCount + invalid_count;
+    size_t const count = length * 200;
+    char const **const strs = calloc(count, sizeof(char const *));
+    bib_lc_calln_t *const nums = calloc(count, sizeof(bib_lc_calln_t));
+    bool *const ok = calloc(count, sizeof(bool));
+    for (size_t index = 0; index < count; index += 1) {
+        size_t const position = index % length;
+        strs[index] = (index == 7) ? NULL
+                    : (position < BibTestCallNumberStringsCount) ? BibTestCallNumberStrings[position]
+                    : bib_batch_invalid_strings[position - BibTestCallNumberStringsCount];
+    }
+    size_t const success_count = bib_lc_calln_init_batch(nums, strs, count, ok, 4);
+
+    size_t expected_count = 0;
+    for (size_t index = 0; index < count; index += 1) {
+        bib_lc_calln_t num = {};
+        bool const success = (strs[index] != NULL) && bib_lc_calln_init(&num, strs[index]);
+        XCTAssertEqual(ok[index], success);
+        if (success) {
+            expected_count += 1;
+            XCTAssertEqual(bib_lc_calln_compare(bib_calln_ordered_same, &num, &(nums[index]), true),
+                           bib_calln_ordered_same);
+            bib_lc_calln_deinit(&num);
+            bib_lc_calln_deinit(&(nums[index]));
+        }
+    }
+    XCTAssertEqual(success_count, expected_count);
+    free(strs);
+    free(nums);
+    free(ok);
+}
+
+- (void)test_02_batch_without_flags {
+    bib_lc_calln_t nums[2] = {};
+    char const *const strs[2] = { "QA76", "?" };
+    XCTAssertEqual(bib_lc_calln_init_batch(nums, strs, 2, NULL, 0), 1);
+    XCTAssertTrue(bib_lc_calln_init_batch(NULL, strs, 2, NULL, 0) == 0);
+    bib_lc_calln_deinit(&(nums[0]));
+}
+
+- (void)test_03_call_numbers_with_strings {
+    NSArray *const strings = @[ @"QA76.76.C65 A37 1986", @"  HQ76 ", @"nope", @"QA76é" ];
+    NSArray *const callNumbers = [BibLCCallNumber callNumbersWithStrings:strings];
+    XCTAssertEqual([callNumbers count], 4);
+    XCTAssertEqualObjects(callNumbers[0], [BibLCCallNumber callNumberWithString:@"QA76.76.C65 A37 1986"]);
+    XCTAssertEqualObjects(callNumbers[1], [BibLCCallNumber callNumberWithString:@"HQ76"]);
+    XCTAssertEqualObjects(callNumbers[2], [NSNull null]);
+    XCTAssertEqualObjects(callNumbers[3], [NSNull null]);
+    XCTAssertEqualObjects([BibLCCallNumber callNumbersWithStrings:@[]], @[]);
+}
+
+@end
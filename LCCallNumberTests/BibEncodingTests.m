@@ -0,0 +1,102 @@
+//
+//  BibEncodingTests.m
+//  LCCallNumberTests
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "BibTestUtils.h"
+#import "bibtype.h"
+#import "bibtypeio.h"
+
+@interface BibEncodingTests : XCTestCase
+@end
+
+/// The shared call numbers, along with call numbers using each kind of specification.
+static char const *const bib_encoding_strings[] = {
+    BibTestCallNumberStringList, "QA76 1999 v. 1 pt. 2 suppl. 3 4th 2001", "HQ76.5 2001 Jan. 5", "PN1995.9.S3 B3 etc."
+};
+
+@implementation BibEncodingTests
+
+- (void)test_01_round_trip {
+    size_t const count = sizeof(bib_encoding_strings) / sizeof(*bib_encoding_strings);
+    bib_lc_calln_style_t const style = { .separator = ' ' };
+    for (size_t index = 0; index < count; index += 1) {
+        bib_lc_calln_t num = {};
+        bib_lc_calln_t decoded = {};
+        unsigned char encoding[256] = {};
+        char expected[256] = {};
+        char actual[256] = {};
+        XCTAssertTrue(bib_lc_calln_init(&num, bib_encoding_strings[index]));
+        size_t const length = bib_lc_calln_encode(encoding, sizeof(encoding), &num);
+        XCTAssertTrue(length < sizeof(bib_lc_calln_t) / 2);
+        XCTAssertTrue(bib_lc_calln_decode(&decoded, encoding, length));
+        XCTAssertEqual(bib_lc_calln_compare(bib_calln_ordered_same, &num, &decoded, true), bib_calln_ordered_same);
+        size_t __unused _0 = bib_snprint_lc_calln(expected, sizeof(expected), &num, style);
+        size_t __unused _1 = bib_snprint_lc_calln(actual, sizeof(actual), &decoded, style);
+        BibAssertEqualStrings(actual, expected);
+        bib_lc_calln_deinit(&num);
+        bib_lc_calln_deinit(&decoded);
+    }
+}
+
+- (void)test_02_encoded_compare_matches_structure_compare {
+    size_t const count = sizeof(bib_encoding_strings) / sizeof(*bib_encoding_strings);
+    for (size_t i = 0; i < count; i += 1) {
+        for (size_t j = 0; j < count; j += 1) {
+            bib_lc_calln_t left = {};
+            bib_lc_calln_t right = {};
+            unsigned char lenc[256] = {};
+            unsigned char renc[256] = {};
+            XCTAssertTrue(bib_lc_calln_init(&left, bib_encoding_strings[i]));
+            XCTAssertTrue(bib_lc_calln_init(&right, bib_encoding_strings[j]));
+            size_t __unused _0 = bib_lc_calln_encode(lenc, sizeof(lenc), &left);
+            size_t __unused _1 = bib_lc_calln_encode(renc, sizeof(renc), &right);
+            int expected = 0;
+            switch (bib_lc_calln_compare(bib_calln_ordered_same, &left, &right, false)) {
+                case bib_calln_ordered_specifying:
+                case bib_calln_ordered_ascending: expected = -1; break;
+                case bib_calln_ordered_same: expected = 0; break;
+                case bib_calln_ordered_descending:
+                case bib_calln_ordered_generalizing: expected = 1; break;
+            }
+            int const result = bib_lc_calln_encoded_compare(lenc, renc);
+            XCTAssertEqual((result > 0) - (result < 0), expected);
+            bib_lc_calln_deinit(&left);
+            bib_lc_calln_deinit(&right);
+        }
+    }
+}
+
+- (void)test_03_encoded_sort_key {
+    bib_lc_calln_t num = {};
+    unsigned char encoding[256] = {};
+    unsigned char key[256] = {};
+    XCTAssertTrue(bib_lc_calln_init(&num, "DR1879.5 1988.C786 15th.ed. Suppl. 3"));
+    size_t __unused _ = bib_lc_calln_encode(encoding, sizeof(encoding), &num);
+    size_t const key_length = bib_lc_calln_sortkey(key, sizeof(key), &num);
+    size_t length = 0;
+    unsigned char const *const embedded = bib_lc_calln_encoded_sortkey(encoding, &length);
+    XCTAssertEqual(length, key_length);
+    XCTAssertEqual(memcmp(embedded, key, length), 0);
+    bib_lc_calln_deinit(&num);
+}
+
+- (void)test_04_decode_rejects_truncated_input {
+    bib_lc_calln_t num = {};
+    bib_lc_calln_t decoded = {};
+    unsigned char encoding[256] = {};
+    XCTAssertTrue(bib_lc_calln_init(&num, "QA76 1999 v. 1 pt. 2 suppl. 3 4th 2001"));
+    size_t const length = bib_lc_calln_encode(encoding, sizeof(encoding), &num);
+    XCTAssertEqual(bib_lc_calln_encode(NULL, 0, &num), length);
+    XCTAssertEqual(bib_lc_calln_encode(encoding, 4, &num), length);
+    for (size_t size = 0; size < length; size += 1) {
+        XCTAssertFalse(bib_lc_calln_decode(&decoded, encoding, size));
+    }
+    bib_lc_calln_deinit(&num);
+}
+
+@end
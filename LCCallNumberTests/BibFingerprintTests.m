@@ -0,0 +1,94 @@
+//
+//  BibFingerprintTests.m
+//  LCCallNumberTests
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "bibtype.h"
+#import "BibTestUtils.h"
+
+@interface BibFingerprintTests : XCTestCase
+@end
+
+/// Compare the fingerprints of the two call number strings.
+static bib_calln_comparison_t bib_fingerprint_compare_strings(char const *const left, char const *const right,
+                                                              bool const specify)
+{
+    bib_lc_calln_t lnum = {};
+    bib_lc_calln_t rnum = {};
+    if (!bib_lc_calln_init(&lnum, left) || !bib_lc_calln_init(&rnum, right)) {
+        return -3;
+    }
+    bib_calln_comparison_t const result = bib_lc_calln_fingerprint_compare(lnum.fingerprint, rnum.fingerprint,
+                                                                           specify);
+    bib_lc_calln_deinit(&lnum);
+    bib_lc_calln_deinit(&rnum);
+    return result;
+}
+
+@implementation BibFingerprintTests
+
+- (void)test_01_class_order {
+    XCTAssertEqual(bib_fingerprint_compare_strings("HQ76", "QA76", false), bib_calln_ordered_ascending);
+    XCTAssertEqual(bib_fingerprint_compare_strings("QA76", "HQ76", true), bib_calln_ordered_descending);
+    XCTAssertEqual(bib_fingerprint_compare_strings("P35", "P112", true), bib_calln_ordered_ascending);
+    XCTAssertEqual(bib_fingerprint_compare_strings("QA76.76", "QA76.9", true), bib_calln_ordered_ascending);
+    XCTAssertEqual(bib_fingerprint_compare_strings("QA76.9", "QA76.76", false), bib_calln_ordered_descending);
+    XCTAssertEqual(bib_fingerprint_compare_strings("QA76.7", "QA76.76", true), bib_calln_ordered_ascending);
+}
+
+- (void)test_02_undecided_order {
+    // the same subject needs the full comparison
+    XCTAssertEqual(bib_fingerprint_compare_strings("QA76.76.C65 A37", "QA76.76.C65 A38", false),
+                   bib_calln_ordered_same);
+    XCTAssertEqual(bib_fingerprint_compare_strings("QA76.12345678", "QA76.12345679", false),
+                   bib_calln_ordered_same);
+    // prefixes might specialize the other call number
+    XCTAssertEqual(bib_fingerprint_compare_strings("Q172", "QA76", false), bib_calln_ordered_ascending);
+    XCTAssertEqual(bib_fingerprint_compare_strings("Q172", "QA76", true), bib_calln_ordered_same);
+    XCTAssertEqual(bib_fingerprint_compare_strings("QA76", "QA76.76", false), bib_calln_ordered_ascending);
+    XCTAssertEqual(bib_fingerprint_compare_strings("QA76", "QA76.76", true), bib_calln_ordered_same);
+    // fingerprints that haven't been calculated
+    XCTAssertEqual(bib_lc_calln_fingerprint_compare(0, 0, false), bib_calln_ordered_same);
+    bib_lc_calln_t num = {};
+    XCTAssertTrue(bib_lc_calln_init(&num, "QA76"));
+    XCTAssertNotEqual(num.fingerprint, 0);
+    XCTAssertEqual(num.fingerprint, bib_lc_calln_fingerprint(&num));
+    XCTAssertEqual(bib_lc_calln_fingerprint_compare(0, num.fingerprint, false), bib_calln_ordered_same);
+    bib_lc_calln_deinit(&num);
+}
+
+- (void)test_03_matches_comparison {
+    // the shared call numbers, along with classes whose fingerprints share long prefixes
+    char const *const strings[] = {
+        BibTestCallNumberStringList, "QA76", "QA76.C6", "QA76.7", "QA90", "QA101", "QB1", "P35", "P112", "PC5615",
+        "HQ76", "HQ76.5", "H1"
+    };
+    size_t const count = sizeof(strings) / sizeof(*strings);
+    for (size_t i = 0; i < count; i += 1) {
+        for (size_t j = 0; j < count; j += 1) {
+            bib_lc_calln_t left = {};
+            bib_lc_calln_t right = {};
+            XCTAssertTrue(bib_lc_calln_init(&left, strings[i]));
+            XCTAssertTrue(bib_lc_calln_init(&right, strings[j]));
+            for (int specify = 0; specify < 2; specify += 1) {
+                bib_calln_comparison_t const fast = bib_lc_calln_compare(bib_calln_ordered_same, &left, &right,
+                                                                         specify);
+                left.fingerprint = 0;
+                right.fingerprint = 0;
+                bib_calln_comparison_t const full = bib_lc_calln_compare(bib_calln_ordered_same, &left, &right,
+                                                                         specify);
+                left.fingerprint = bib_lc_calln_fingerprint(&left);
+                right.fingerprint = bib_lc_calln_fingerprint(&right);
+                XCTAssertEqual(fast, full, @"%s %s", strings[i], strings[j]);
+            }
+            bib_lc_calln_deinit(&left);
+            bib_lc_calln_deinit(&right);
+        }
+    }
+}
+
+@end
@@ -0,0 +1,155 @@
+//
+//  BibIncrementalParsingTests.m
+//  LCCallNumberTests
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "bibparse.h"
+#import "BibTestUtils.h"
+
+@interface BibIncrementalParsingTests : XCTestCase
+@end
+
+/// Read each character of the string, stopping at the first rejected character.
+/// - returns: The amount of characters read by the parser.
+static size_t bib_incremental_push_all(bib_lc_calln_parse_state_t *const state, char const *const str)
+{
+    size_t length = 0;
+    while (str[length] != '\0' && bib_lc_calln_parse_state_push(state, str[length])) {
+        length += 1;
+    }
+    return length;
+}
+
+@implementation BibIncrementalParsingTests
+
+- (void)test_01_every_prefix_of_a_call_number_is_accepted {
+    // the shared call numbers, along with unusual spellings that the parser still accepts
+    char const *const strs[] = { BibTestCallNumberStringList, "HQ76 vol. 1", "QA76,5", "QA. v. 2" };
+    for (size_t index = 0; index < sizeof(strs) / sizeof(*strs); index += 1) {
+        bib_lc_calln_parse_state_t state;
+        bib_lc_calln_parse_state_init(&state);
+        XCTAssertEqual(bib_incremental_push_all(&state, strs[index]), strlen(strs[index]));
+        XCTAssertEqual(strcmp(state.input, strs[index]), 0);
+
+        bib_lc_calln_t expected = {};
+        bib_lc_calln_t actual = {};
+        XCTAssertTrue(bib_lc_calln_init(&expected, strs[index]));
+        XCTAssertTrue(bib_lc_calln_parse_state_finish(&state, &actual));
+        XCTAssertEqual(bib_lc_calln_compare(bib_calln_ordered_same, &expected, &actual, true),
+                       bib_calln_ordered_same);
+        bib_lc_calln_deinit(&expected);
+        bib_lc_calln_deinit(&actual);
+    }
+}
+
+- (void)test_02_components {
+    char const *const str = "QA76.76.C65 A37 1986 v. 2";
+    bib_lc_calln_component_t const expected[] = {
+        bib_lc_calln_component_class, bib_lc_calln_component_class,
+        bib_lc_calln_component_integer, bib_lc_calln_component_integer,
+        bib_lc_calln_component_decimal, bib_lc_calln_component_decimal, bib_lc_calln_component_decimal,
+        bib_lc_calln_component_cutter, bib_lc_calln_component_cutter, bib_lc_calln_component_cutter,
+        bib_lc_calln_component_cutter, bib_lc_calln_component_cutter,
+        bib_lc_calln_component_cutter, bib_lc_calln_component_cutter, bib_lc_calln_component_cutter,
+        bib_lc_calln_component_cutter,
+        bib_lc_calln_component_cutter_dateord, bib_lc_calln_component_cutter_dateord,
+        bib_lc_calln_component_cutter_dateord, bib_lc_calln_component_cutter_dateord,
+        bib_lc_calln_component_cutter_dateord,
+        bib_lc_calln_component_cutter, bib_lc_calln_component_specification,
+        bib_lc_calln_component_specification, bib_lc_calln_component_specification
+    };
+    XCTAssertEqual(sizeof(expected) / sizeof(*expected), strlen(str));
+    bib_lc_calln_parse_state_t state;
+    bib_lc_calln_parse_state_init(&state);
+    XCTAssertEqual(state.component, bib_lc_calln_component_none);
+    for (size_t index = 0; str[index] != '\0'; index += 1) {
+        XCTAssertTrue(bib_lc_calln_parse_state_push(&state, str[index]));
+        XCTAssertEqual(state.component, expected[index]);
+    }
+}
+
+- (void)test_03_completions {
+    bib_lc_calln_parse_state_t state;
+    bib_lc_calln_parse_state_init(&state);
+    XCTAssertEqual(bib_lc_calln_parse_state_completions(&state), bib_lc_calln_completion_letter);
+    XCTAssertFalse(bib_lc_calln_parse_state_push(&state, '7'));
+    XCTAssertEqual(state.length, 0);
+
+    XCTAssertEqual(bib_incremental_push_all(&state, "QA"), 2);
+    XCTAssertEqual(bib_lc_calln_parse_state_completions(&state),
+                   bib_lc_calln_completion_letter | bib_lc_calln_completion_digit | bib_lc_calln_completion_point
+                   | bib_lc_calln_completion_space | bib_lc_calln_completion_end);
+    XCTAssertFalse(bib_lc_calln_parse_state_push(&state, '-'));
+
+    XCTAssertEqual(bib_incremental_push_all(&state, "76.C"), 4);
+    XCTAssertEqual(bib_lc_calln_parse_state_completions(&state),
+                   bib_lc_calln_completion_digit | bib_lc_calln_completion_end);
+    XCTAssertFalse(bib_lc_calln_parse_state_push(&state, ' '));
+    XCTAssertEqual(strcmp(state.input, "QA76.C"), 0);
+
+    // a cutter number's mark must be followed by whitespace or the end of the call number
+    XCTAssertEqual(bib_incremental_push_all(&state, "65ab"), 4);
+    XCTAssertEqual(state.component, bib_lc_calln_component_cutter_mark);
+    XCTAssertFalse(bib_lc_calln_parse_state_push(&state, '2'));
+    XCTAssertTrue(bib_lc_calln_parse_state_completions(&state) & bib_lc_calln_completion_end);
+
+    // the end of a date can't be known without looking ahead
+    XCTAssertEqual(bib_incremental_push_all(&state, " 1986"), 5);
+    XCTAssertFalse(bib_lc_calln_parse_state_completions(&state) & bib_lc_calln_completion_end);
+    XCTAssertTrue(bib_lc_calln_parse_state_completions(&state) & bib_lc_calln_completion_symbol);
+}
+
+- (void)test_04_partial_call_number {
+    bib_lc_calln_parse_state_t state;
+    bib_lc_calln_parse_state_init(&state);
+    XCTAssertEqual(bib_incremental_push_all(&state, "qa76.76"), 7);
+    XCTAssertEqual(strcmp(state.calln.letters, "QA"), 0);
+    XCTAssertEqual(strcmp(state.calln.integer, "76"), 0);
+    XCTAssertEqual(strcmp(state.calln.decimal, "76"), 0);
+
+    // keep a copy of the state to remove characters from the end of the input
+    bib_lc_calln_parse_state_t const previous = state;
+    XCTAssertEqual(bib_incremental_push_all(&state, ".c6"), 3);
+    XCTAssertEqual(state.calln.cutters[0].cutter.letter, 'C');
+    XCTAssertEqual(strcmp(state.calln.cutters[0].cutter.number, "6"), 0);
+    XCTAssertEqual(bib_lc_calln_compare(bib_calln_ordered_same, &(previous.calln), &(state.calln), true),
+                   bib_calln_ordered_specifying);
+    state = previous;
+    XCTAssertEqual(strcmp(state.input, "qa76.76"), 0);
+    XCTAssertEqual(state.calln.cutters[0].cutter.letter, '\0');
+
+    bib_lc_calln_t calln = {};
+    XCTAssertEqual(bib_incremental_push_all(&state, ".C65 A37"), 8);
+    XCTAssertTrue(bib_lc_calln_parse_state_finish(&state, &calln));
+    XCTAssertEqual(bib_lc_calln_compare(bib_calln_ordered_same, &(state.calln), &calln, true),
+                   bib_calln_ordered_same);
+    bib_lc_calln_deinit(&calln);
+}
+
+- (void)test_05_cutter_turns_out_to_be_specification {
+    bib_lc_calln_parse_state_t state;
+    bib_lc_calln_parse_state_init(&state);
+    XCTAssertEqual(bib_incremental_push_all(&state, "HQ76 v"), 6);
+    XCTAssertEqual(state.component, bib_lc_calln_component_cutter);
+    XCTAssertEqual(state.calln.cutters[0].cutter.letter, 'V');
+    XCTAssertEqual(bib_incremental_push_all(&state, "ol. 1"), 5);
+    XCTAssertEqual(state.component, bib_lc_calln_component_specification);
+    XCTAssertEqual(state.calln.cutters[0].cutter.letter, '\0');
+    XCTAssertEqual(strcmp(state.calln.integer, "76"), 0);
+
+    bib_lc_calln_t calln = {};
+    XCTAssertTrue(bib_lc_calln_parse_state_finish(&state, &calln));
+    XCTAssertEqual(calln.specifications[0].kind, bib_lc_specification_kind_volume);
+    bib_lc_calln_deinit(&calln);
+
+    bib_lc_calln_parse_state_init(&state);
+    XCTAssertEqual(bib_incremental_push_all(&state, "HQ 7-"), 5);
+    XCTAssertEqual(state.component, bib_lc_calln_component_specification);
+    XCTAssertEqual(state.calln.integer[0], '\0');
+}
+
+@end
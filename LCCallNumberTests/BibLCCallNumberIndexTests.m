@@ -0,0 +1,112 @@
+//
+//  BibLCCallNumberIndexTests.m
+//  LCCallNumberTests
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import <Bibliotek/Bibliotek.h>
+#import "BibTestUtils.h"
+
+@interface BibLCCallNumberIndexTests : XCTestCase
+@end
+
+static NSArray<BibLCCallNumber *> *BibCallNumbers(NSArray<NSString *> *strings)
+{
+    NSMutableArray *const callNumbers = [NSMutableArray arrayWithCapacity:[strings count]];
+    for (NSString *string in strings) {
+        [callNumbers addObject:[BibLCCallNumber callNumberWithString:string]];
+    }
+    return callNumbers;
+}
+
+@implementation BibLCCallNumberIndexTests {
+    BibLCCallNumberIndex *_index;
+}
+
+- (void)setUp {
+    [super setUp];
+    // the shared call numbers, with classes around QA76 and a duplicate for the range and neighbor tests
+    NSArray<NSString *> *const extras = @[
+        @"HQ76.5", @"QA76", @"QA70", @"QA77", @"HQ76.13", @"QA76.5", @"QA76.76.C65 A37 1986"
+    ];
+    NSArray<NSString *> *const strings = [BibTestCallNumberStringArray() arrayByAddingObjectsFromArray:extras];
+    _index = [BibLCCallNumberIndex indexWithCallNumbers:BibCallNumbers(strings)];
+}
+
+- (void)test_01_shelf_order {
+    XCTAssertEqual([_index count], BibTestCallNumberStringsCount + 7);
+    NSArray<BibLCCallNumber *> *const callNumbers = [_index callNumbers];
+    for (NSUInteger index = 1; index < [callNumbers count]; index += 1) {
+        XCTAssertNotEqual([callNumbers[index - 1] compare:callNumbers[index]], NSOrderedDescending);
+    }
+    XCTAssertEqualObjects([callNumbers subarrayWithRange:NSMakeRange(12, 11)], BibCallNumbers(@[
+        @"Q11.P6 n.s. v. 56 pt. 9", @"Q172.J64 2017", @"QA70", @"QA76", @"QA76.5", @"QA76.73.J39 D83 2014",
+        @"QA76.76.C65 A37 1986", @"QA76.76.C65 A37 1986", @"QA76.9.T48 I544 2013", @"QA77", @"QL737.C2C37 1984a"
+    ]));
+}
+
+- (void)test_02_range {
+    BibLCCallNumber *const lower = [BibLCCallNumber callNumberWithString:@"QA76.7"];
+    BibLCCallNumber *const upper = [BibLCCallNumber callNumberWithString:@"QA76.9"];
+    XCTAssertEqualObjects([_index callNumbersFromCallNumber:lower toCallNumber:upper], BibCallNumbers(@[
+        @"QA76.73.J39 D83 2014", @"QA76.76.C65 A37 1986", @"QA76.76.C65 A37 1986", @"QA76.9.T48 I544 2013"
+    ]));
+    XCTAssertEqualObjects([_index callNumbersFromCallNumber:upper toCallNumber:lower], @[]);
+}
+
+- (void)test_03_included_by {
+    BibLCCallNumber *const qa76 = [BibLCCallNumber callNumberWithString:@"QA76"];
+    XCTAssertEqualObjects([_index callNumbersIncludedByCallNumber:qa76], BibCallNumbers(@[
+        @"QA76", @"QA76.5", @"QA76.73.J39 D83 2014", @"QA76.76.C65 A37 1986", @"QA76.76.C65 A37 1986",
+        @"QA76.9.T48 I544 2013"
+    ]));
+    BibLCCallNumber *const hq = [BibLCCallNumber callNumberWithString:@"HQ"];
+    XCTAssertEqualObjects([_index callNumbersIncludedByCallNumber:hq], BibCallNumbers(@[ @"HQ76.13", @"HQ76.5" ]));
+    BibLCCallNumber *const pn = [BibLCCallNumber callNumberWithString:@"PN"];
+    XCTAssertEqualObjects([_index callNumbersIncludedByCallNumber:pn], @[]);
+}
+
+- (void)test_04_included_by_matches_linear_scan {
+    for (BibLCCallNumber *classification in [_index callNumbers]) {
+        NSMutableArray *const expected = [NSMutableArray array];
+        for (BibLCCallNumber *callNumber in _index) {
+            if ([classification includesCallNumber:callNumber]) {
+                [expected addObject:callNumber];
+            }
+        }
+        XCTAssertEqualObjects([_index callNumbersIncludedByCallNumber:classification], expected);
+    }
+}
+
+- (void)test_05_nearest_neighbors {
+    BibLCCallNumber *const callNumber = [BibLCCallNumber callNumberWithString:@"QA76.6"];
+    XCTAssertEqual([_index indexForCallNumber:callNumber], 17);
+    XCTAssertEqualObjects([_index callNumbersNearCallNumber:callNumber count:2], BibCallNumbers(@[
+        @"QA76", @"QA76.5", @"QA76.73.J39 D83 2014", @"QA76.76.C65 A37 1986"
+    ]));
+    BibLCCallNumber *const last = [BibLCCallNumber callNumberWithString:@"Z1"];
+    XCTAssertEqualObjects([_index callNumbersNearCallNumber:last count:2],
+                          BibCallNumbers(@[ @"QA77", @"QL737.C2C37 1984a" ]));
+}
+
+- (void)test_06_mutable_index {
+    BibMutableLCCallNumberIndex *const index = [_index mutableCopy];
+    [index addCallNumber:[BibLCCallNumber callNumberWithString:@"QA76.6"]];
+    XCTAssertEqualObjects([[index callNumberAtIndex:17] stringValue], @"QA76.6");
+    [index removeCallNumber:[BibLCCallNumber callNumberWithString:@"QA76.76.C65 A37 1986"]];
+    [index removeCallNumber:[BibLCCallNumber callNumberWithString:@"PN1"]];
+    NSUInteger const count = [_index count];
+    XCTAssertEqual([index count], count);
+    [index addCallNumbers:BibCallNumbers(@[ @"Z1", @"A1", @"QA76.5", @"QA76.5" ])];
+    XCTAssertEqual([index count], count + 4);
+    XCTAssertEqualObjects([index[0] stringValue], @"A1");
+    XCTAssertEqualObjects([index[count + 3] stringValue], @"Z1");
+    XCTAssertEqual([[index callNumbersIncludedByCallNumber:[BibLCCallNumber callNumberWithString:@"QA76.5"]] count], 3);
+    XCTAssertEqual([_index count], count);
+    XCTAssertEqual([[index copy] count], count + 4);
+}
+
+@end
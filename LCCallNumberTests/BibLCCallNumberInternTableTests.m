@@ -0,0 +1,83 @@
+//
+//  BibLCCallNumberInternTableTests.m
+//  LCCallNumberTests
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import <Bibliotek/Bibliotek.h>
+
+@interface BibLCCallNumberInternTableTests : XCTestCase
+@end
+
+@implementation BibLCCallNumberInternTableTests {
+    BibLCCallNumberInternTable *_table;
+}
+
+- (void)setUp {
+    [super setUp];
+    _table = [BibLCCallNumberInternTable new];
+}
+
+- (void)test_01_equal_strings_share_an_instance {
+    BibLCCallNumber *const callNumber = [_table callNumberWithString:@"QA76.76.C65 A37 1986"];
+    XCTAssertNotNil(callNumber);
+    XCTAssertTrue([_table callNumberWithString:@"QA76.76.C65 A37 1986"] == callNumber);
+    XCTAssertEqual([_table count], 1);
+    XCTAssertNil([_table callNumberWithString:@"not a call number"]);
+    XCTAssertEqual([_table count], 1);
+}
+
+- (void)test_02_equivalent_call_numbers_share_an_instance {
+    BibLCCallNumber *const callNumber = [_table callNumberWithString:@"QA76.C6"];
+    XCTAssertTrue([_table callNumberWithString:@"QA76 .C6"] == callNumber);
+    XCTAssertTrue([_table callNumberWithString:@"qa76.c6"] == callNumber);
+    BibLCCallNumber *const other = [BibLCCallNumber callNumberWithString:@"QA76.C6"];
+    XCTAssertTrue([_table internCallNumber:other] == callNumber);
+    BibLCCallNumber *const distinct = [BibLCCallNumber callNumberWithString:@"QA76.C7"];
+    XCTAssertTrue([_table internCallNumber:distinct] == distinct);
+    XCTAssertEqual([_table count], 2);
+}
+
+- (void)test_03_call_numbers_with_strings {
+    BibLCCallNumber *const existing = [_table callNumberWithString:@"HQ76"];
+    NSArray *const callNumbers = [_table callNumbersWithStrings:@[
+        @"QA76.9", @"HQ76", @"nope", @"QA76.9", @"QA76.90", @"HQ76"
+    ]];
+    XCTAssertEqual([callNumbers count], 6);
+    XCTAssertTrue(callNumbers[1] == existing);
+    XCTAssertTrue(callNumbers[5] == existing);
+    XCTAssertEqualObjects(callNumbers[2], [NSNull null]);
+    XCTAssertTrue(callNumbers[0] == callNumbers[3]);
+    XCTAssertTrue(callNumbers[0] == [_table callNumberWithString:@"QA76.9"]);
+    XCTAssertEqualObjects(callNumbers[0], [BibLCCallNumber callNumberWithString:@"QA76.9"]);
+    XCTAssertEqualObjects([_table callNumbersWithStrings:@[]], @[]);
+}
+
+- (void)test_04_concurrent_interning {
+    NSArray<NSString *> *const strings = @[ @"QA76.9", @"QA76.76.C65 A37 1986", @"HQ76.5", @"P35", @"PC5615" ];
+    NSMutableArray<BibLCCallNumber *> *const results = [NSMutableArray array];
+    NSLock *const lock = [NSLock new];
+    dispatch_apply(1000, DISPATCH_APPLY_AUTO, ^(size_t iteration) {
+        BibLCCallNumber *const callNumber = [self->_table callNumberWithString:strings[iteration % [strings count]]];
+        [lock lock];
+        [results addObject:callNumber];
+        [lock unlock];
+    });
+    XCTAssertEqual([_table count], [strings count]);
+    for (BibLCCallNumber *callNumber in results) {
+        XCTAssertTrue([_table callNumberWithString:[callNumber stringValue]] == callNumber);
+    }
+}
+
+- (void)test_05_remove_all_call_numbers {
+    BibLCCallNumber *const callNumber = [_table callNumberWithString:@"QA76"];
+    [_table removeAllCallNumbers];
+    XCTAssertEqual([_table count], 0);
+    XCTAssertFalse([_table callNumberWithString:@"QA76"] == callNumber);
+    XCTAssertTrue([BibLCCallNumberInternTable sharedTable] == [BibLCCallNumberInternTable sharedTable]);
+}
+
+@end
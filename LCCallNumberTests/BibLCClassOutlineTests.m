@@ -0,0 +1,105 @@
+//
+//  BibLCClassOutlineTests.m
+//  LCCallNumberTests
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import <Bibliotek/Bibliotek.h>
+
+@interface BibLCClassOutlineTests : XCTestCase
+@end
+
+static NSString *const BibOutlineTable = @""
+    "# Mathematics\n"
+    "QA1-QA939 Mathematics\n"
+    "QA1-43 General\n"
+    "QA47-59 Tables\n"
+    "\n"
+    "QA71-90 Instruments and machines\n"
+    "QA75.5-76.95 Electronic computers. Computer science\n"
+    "QA76.73 Programming languages\n"
+    "QA101-145 Elementary mathematics\n";
+
+static NSArray<NSString *> *BibCaptions(NSArray<BibLCClassCaption *> *captions)
+{
+    return [captions valueForKey:@"caption"];
+}
+
+@implementation BibLCClassOutlineTests {
+    BibLCClassOutline *_outline;
+}
+
+- (void)setUp {
+    [super setUp];
+    NSError *error = nil;
+    _outline = [[BibLCClassOutline alloc] initWithString:BibOutlineTable error:&error];
+    XCTAssertNotNil(_outline);
+    XCTAssertNil(error);
+}
+
+- (void)test_01_captions {
+    XCTAssertEqual([_outline count], 7);
+    XCTAssertEqualObjects(BibCaptions([_outline captions]), (@[
+        @"Mathematics", @"General", @"Tables", @"Instruments and machines",
+        @"Electronic computers. Computer science", @"Programming languages", @"Elementary mathematics"
+    ]));
+    BibLCClassCaption *const caption = [[_outline captions] objectAtIndex:3];
+    XCTAssertEqualObjects([caption lowerCallNumber], [BibLCCallNumber callNumberWithString:@"QA71"]);
+    XCTAssertEqualObjects([caption upperCallNumber], [BibLCCallNumber callNumberWithString:@"QA90"]);
+    XCTAssertEqualObjects([caption description], @"QA71-QA90 Instruments and machines");
+}
+
+- (void)test_02_captions_containing_call_number {
+    BibLCCallNumber *const callNumber = [BibLCCallNumber callNumberWithString:@"QA76.73.J39 D83 2014"];
+    XCTAssertEqualObjects(BibCaptions([_outline captionsContainingCallNumber:callNumber]), (@[
+        @"Mathematics", @"Instruments and machines", @"Electronic computers. Computer science",
+        @"Programming languages"
+    ]));
+}
+
+- (void)test_03_upper_bound_includes_subclasses {
+    BibLCCallNumber *const included = [BibLCCallNumber callNumberWithString:@"QA90.5.M37"];
+    XCTAssertEqualObjects(BibCaptions([_outline captionsContainingCallNumber:included]),
+                          (@[ @"Mathematics", @"Instruments and machines" ]));
+    BibLCCallNumber *const after = [BibLCCallNumber callNumberWithString:@"QA91"];
+    XCTAssertEqualObjects(BibCaptions([_outline captionsContainingCallNumber:after]), (@[ @"Mathematics" ]));
+}
+
+- (void)test_04_call_numbers_outside_the_outline {
+    XCTAssertEqualObjects([_outline captionsContainingCallNumber:[BibLCCallNumber callNumberWithString:@"QA"]], @[]);
+    XCTAssertEqualObjects([_outline captionsContainingCallNumber:[BibLCCallNumber callNumberWithString:@"HQ76"]], @[]);
+    XCTAssertEqualObjects([_outline captionsContainingCallNumber:[BibLCCallNumber callNumberWithString:@"QB1"]], @[]);
+    XCTAssertEqualObjects([[[BibLCClassOutline alloc] init] captionsContainingCallNumber:
+                           [BibLCCallNumber callNumberWithString:@"QA1"]], @[]);
+}
+
+- (void)test_05_matches_each_caption {
+    NSArray<NSString *> *const strings = @[
+        @"QA1", @"QA43.5", @"QA44", @"QA47", @"QA59.C6", @"QA71", @"QA75", @"QA75.5", @"QA76", @"QA76.73",
+        @"QA76.73.C15", @"QA76.95", @"QA76.96", @"QA90", @"QA101", @"QA145.2", @"QA939", @"QA940", @"QA"
+    ];
+    for (NSString *string in strings) {
+        BibLCCallNumber *const callNumber = [BibLCCallNumber callNumberWithString:string];
+        NSMutableArray<BibLCClassCaption *> *const expected = [NSMutableArray array];
+        for (BibLCClassCaption *caption in [_outline captions]) {
+            if ([caption containsCallNumber:callNumber]) {
+                [expected addObject:caption];
+            }
+        }
+        XCTAssertEqualObjects([_outline captionsContainingCallNumber:callNumber], expected, @"%@", string);
+    }
+}
+
+- (void)test_06_invalid_table {
+    NSError *error = nil;
+    XCTAssertNil([[BibLCClassOutline alloc] initWithString:@"QA1-QA939 Mathematics\nQA90-QA71 Backwards\n"
+                                                     error:&error]);
+    XCTAssertEqualObjects([error domain], NSCocoaErrorDomain);
+    XCTAssertEqual([error code], NSFileReadCorruptFileError);
+    XCTAssertTrue([[error localizedDescription] containsString:@"line 2"]);
+}
+
+@end
@@ -14,6 +14,11 @@
 @interface BibLexNumberTests : XCTestCase
 @end
 
+/// Match the characters `1` and `x`.
+static bool bib_lex_number_test_pred(char c) {
+    return c == '1' || c == 'x';
+}
+
 @implementation BibLexNumberTests
 
 - (void)test_ditit06_01 {
@@ -215,4 +220,30 @@
     XCTAssertEqual(lexer.len, strlen(lexer.str) + 1, @"len should equal the input string's remaining length");
 }
 
+- (void)test_digitXX_06 {
+    bib_digit16_b buffer = {};
+    bib_strbuf_t lexer = bib_strbuf("123456789012x45678901", 0);
+    XCTAssertEqual(bib_lex_digit_n(buffer, sizeof(bib_digit16_b), &lexer), 12,
+                   @"a non-numeral character past the first eight digits should end the number");
+    BibAssertEqualStrings(buffer, "123456789012", @"the output buffer should contain the digits");
+    BibAssertEqualStrings(lexer.str, "x45678901", @"the non-numeral characters should not be consumed");
+}
+
+- (void)test_digitXX_07 {
+    bib_digit16_b buffer = {};
+    bib_strbuf_t lexer = bib_strbuf("1234\xB9" "5678901234", 0);
+    XCTAssertEqual(bib_lex_digit_n(buffer, sizeof(bib_digit16_b), &lexer), 4,
+                   @"bytes outside of the ASCII range are never numerals");
+    BibAssertEqualStrings(buffer, "1234", @"the output buffer should contain the digits");
+}
+
+- (void)test_digitXX_08 {
+    char buffer[8] = {};
+    bib_strbuf_t lexer = bib_strbuf("x1x12", 0);
+    XCTAssertEqual(bib_lex_char_n(buffer, sizeof(buffer), bib_lex_number_test_pred, &lexer), 4,
+                   @"lexing should call predicates defined outside of the lexer");
+    BibAssertEqualStrings(buffer, "x1x1", @"the output buffer should contain the matching characters");
+    BibAssertEqualStrings(lexer.str, "2", @"the first character not matching the predicate should not be consumed");
+}
+
 @end
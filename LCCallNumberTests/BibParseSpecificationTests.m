@@ -8,6 +8,7 @@
 
 #import <XCTest/XCTest.h>
 #import "BibTestUtils.h"
+#import "biblex.h"
 #import "bibparse.h"
 #import "bibtype.h"
 
@@ -110,5 +111,39 @@
     XCTAssertEqual(parser.len, strlen(parser.str) + 1);
 }
 
+- (void)test_10_keywords {
+    XCTAssertEqual(bib_lex_keyword("v", 1), bib_keyword_kind_volume_prefix);
+    XCTAssertEqual(bib_lex_keyword("vol. 2", 3), bib_keyword_kind_volume_prefix);
+    XCTAssertEqual(bib_lex_keyword("pt", 2), bib_keyword_kind_volume_prefix);
+    XCTAssertEqual(bib_lex_keyword("Suppl", 5), bib_keyword_kind_supplement_prefix);
+    XCTAssertEqual(bib_lex_keyword("Index", 5), bib_keyword_kind_supplement_prefix);
+    XCTAssertEqual(bib_lex_keyword("th", 2), bib_keyword_kind_ordinal_suffix);
+    XCTAssertEqual(bib_lex_keyword("d", 1), bib_keyword_kind_ordinal_suffix);
+    XCTAssertEqual(bib_lex_keyword("vo", 2), bib_keyword_kind_none);
+    XCTAssertEqual(bib_lex_keyword("V", 1), bib_keyword_kind_none);
+    XCTAssertEqual(bib_lex_keyword("suppl", 5), bib_keyword_kind_none);
+    XCTAssertEqual(bib_lex_keyword("Supplements", 11), bib_keyword_kind_none);
+    XCTAssertEqual(bib_lex_keyword("", 0), bib_keyword_kind_none);
+}
+
+- (void)test_11_parse_unknown_abbreviations {
+    bib_lc_specification_t spc = {};
+    bib_strbuf_t parser = bib_strbuf("fig. 3", 0);
+    XCTAssertTrue(bib_parse_lc_specification(&spc, &parser));
+    XCTAssertEqual(spc.kind, bib_lc_specification_kind_volume);
+    BibAssertEqualStrings(spc.volume.prefix, "fig");
+    BibAssertEqualStrings(spc.volume.number, "3");
+
+    parser = bib_strbuf("Atlas 2", 0);
+    XCTAssertTrue(bib_parse_lc_specification(&spc, &parser));
+    XCTAssertEqual(spc.kind, bib_lc_specification_kind_supplement);
+    BibAssertEqualStrings(spc.supplement.prefix, "Atlas");
+    BibAssertEqualStrings(spc.supplement.number, "2");
+
+    parser = bib_strbuf("v", 0);
+    XCTAssertTrue(bib_parse_lc_specification(&spc, &parser));
+    XCTAssertEqual(spc.kind, bib_lc_specification_kind_word);
+    BibAssertEqualStrings(spc.word, "v");
+}
 
 @end
@@ -0,0 +1,126 @@
+//
+//  BibSortKeyTests.m
+//  LCCallNumberTests
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "bibtype.h"
+#import "BibTestUtils.h"
+
+@interface BibSortKeyTests : XCTestCase
+@end
+
+/// Compare the sort keys for the two call number strings, with the sign of `memcmp`.
+static int bib_sortkey_compare_strings(char const *const left, char const *const right)
+{
+    bib_lc_calln_t lnum = {};
+    bib_lc_calln_t rnum = {};
+    unsigned char lkey[256] = {};
+    unsigned char rkey[256] = {};
+    if (!bib_lc_calln_init(&lnum, left) || !bib_lc_calln_init(&rnum, right)) {
+        return -2;
+    }
+    size_t const llen = bib_lc_calln_sortkey(lkey, sizeof(lkey), &lnum);
+    size_t const rlen = bib_lc_calln_sortkey(rkey, sizeof(rkey), &rnum);
+    bib_lc_calln_deinit(&lnum);
+    bib_lc_calln_deinit(&rnum);
+    int const result = memcmp(lkey, rkey, (llen < rlen) ? llen : rlen);
+    if (result != 0) {
+        return (result < 0) ? -1 : 1;
+    }
+    return (llen < rlen) ? -1 : (llen > rlen) ? 1 : 0;
+}
+
+@implementation BibSortKeyTests
+
+- (void)test_01_class_order {
+    XCTAssertEqual(bib_sortkey_compare_strings("HQ76", "QA76"), -1);
+    XCTAssertEqual(bib_sortkey_compare_strings("QA76", "QA76.76"), -1);
+    XCTAssertEqual(bib_sortkey_compare_strings("QA76.76", "QA76.9"), -1);
+    XCTAssertEqual(bib_sortkey_compare_strings("P35", "P112"), -1);
+    XCTAssertEqual(bib_sortkey_compare_strings("P327", "PC5615"), -1);
+    XCTAssertEqual(bib_sortkey_compare_strings("QA76", "QA70"), 1);
+}
+
+- (void)test_02_same_call_number {
+    XCTAssertEqual(bib_sortkey_compare_strings("QA76.76.C65 A37 1986", "QA76.76.C65A37 1986"), 0);
+    XCTAssertEqual(bib_sortkey_compare_strings("QA76.76.C65 A37 1986", "qa76.76.c65 a37 1986"), 0);
+}
+
+- (void)test_03_specification_order {
+    XCTAssertEqual(bib_sortkey_compare_strings("Q11.P6 15th", "Q11.P6 1999"), -1);
+    XCTAssertEqual(bib_sortkey_compare_strings("Q11.P6 n.s.", "Q11.P6 v. 1"), -1);
+    XCTAssertEqual(bib_sortkey_compare_strings("Q11.P6 v. 1", "Q11.P6 v. 2"), -1);
+    XCTAssertEqual(bib_sortkey_compare_strings("Q11.P6 n.s. v. 56", "Q11.P6 n.s. v. 56 pt. 9"), -1);
+}
+
+- (void)test_04_matches_comparison {
+    char const *const *const strings = BibTestCallNumberStrings;
+    size_t const count = BibTestCallNumberStringsCount;
+    for (size_t i = 0; i < count; i += 1) {
+        for (size_t j = 0; j < count; j += 1) {
+            bib_lc_calln_t left = {};
+            bib_lc_calln_t right = {};
+            XCTAssertTrue(bib_lc_calln_init(&left, strings[i]));
+            XCTAssertTrue(bib_lc_calln_init(&right, strings[j]));
+            int expected = 0;
+            switch (bib_lc_calln_compare(bib_calln_ordered_same, &left, &right, false)) {
+                case bib_calln_ordered_specifying:
+                case bib_calln_ordered_ascending: expected = -1; break;
+                case bib_calln_ordered_same: expected = 0; break;
+                case bib_calln_ordered_descending:
+                case bib_calln_ordered_generalizing: expected = 1; break;
+            }
+            XCTAssertEqual(bib_sortkey_compare_strings(strings[i], strings[j]), expected);
+            bib_lc_calln_deinit(&left);
+            bib_lc_calln_deinit(&right);
+        }
+    }
+}
+
+- (void)test_05_length_without_buffer {
+    bib_lc_calln_t num = {};
+    unsigned char key[256] = {};
+    XCTAssertTrue(bib_lc_calln_init(&num, "DR1879.5 1988.C786 15th.ed. Suppl. 3"));
+    size_t const length = bib_lc_calln_sortkey(NULL, 0, &num);
+    XCTAssertEqual(length, bib_lc_calln_sortkey(key, sizeof(key), &num));
+    XCTAssertEqual(length, bib_lc_calln_sortkey(key, 4, &num));
+    bib_lc_calln_deinit(&num);
+}
+
+- (void)test_06_hash_matches_equality {
+    // spellings of the same call numbers, which must hash the same
+    char const *const strings[] = {
+        BibTestCallNumberStringList, "QA76.76.C65A37 1986", "qa76.76.c65 a37 1986", "QA76.76.C65 A37 1987",
+        "QA76.76", "QA76.760", "QA076.76"
+    };
+    size_t const count = sizeof(strings) / sizeof(*strings);
+    for (size_t i = 0; i < count; i += 1) {
+        for (size_t j = 0; j < count; j += 1) {
+            bib_lc_calln_t left = {};
+            bib_lc_calln_t right = {};
+            XCTAssertTrue(bib_lc_calln_init(&left, strings[i]));
+            XCTAssertTrue(bib_lc_calln_init(&right, strings[j]));
+            if (bib_lc_calln_compare(bib_calln_ordered_same, &left, &right, false) == bib_calln_ordered_same) {
+                XCTAssertEqual(bib_lc_calln_hash(&left), bib_lc_calln_hash(&right));
+            }
+            unsigned char encoding[256] = {};
+            size_t __unused _ = bib_lc_calln_encode(encoding, sizeof(encoding), &left);
+            XCTAssertEqual(bib_lc_calln_encoded_hash(encoding), bib_lc_calln_hash(&left));
+            bib_lc_calln_deinit(&left);
+            bib_lc_calln_deinit(&right);
+        }
+    }
+    bib_lc_calln_t left = {};
+    bib_lc_calln_t right = {};
+    XCTAssertTrue(bib_lc_calln_init(&left, "QA76.76.C65 A37 1986"));
+    XCTAssertTrue(bib_lc_calln_init(&right, "QA76.76.C65 A37 1987"));
+    XCTAssertNotEqual(bib_lc_calln_hash(&left), bib_lc_calln_hash(&right));
+    bib_lc_calln_deinit(&left);
+    bib_lc_calln_deinit(&right);
+}
+
+@end
@@ -0,0 +1,88 @@
+//
+//  BibSortTests.m
+//  LCCallNumberTests
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import <Bibliotek/Bibliotek.h>
+#import "bibtype.h"
+#import "BibTestUtils.h"
+
+@interface BibSortTests : XCTestCase
+@end
+
+@implementation BibSortTests
+
+- (void)test_01_sort_in_shelf_order {
+    size_t const length = BibTestCallNumberStringsCount;
+    size_t const count = 20011;
+    bib_lc_calln_t *const nums = calloc(count, sizeof(bib_lc_calln_t));
+    for (size_t index = 0; index < count; index += 1) {
+        XCTAssertTrue(bib_lc_calln_init(&(nums[index]), BibTestCallNumberStrings[(index * 7) % length]));
+    }
+    XCTAssertTrue(bib_lc_calln_sort(nums, count, 4));
+    for (size_t index = 1; index < count; index += 1) {
+        bib_calln_comparison_t const result = bib_lc_calln_compare(bib_calln_ordered_same, &(nums[index - 1]),
+                                                                   &(nums[index]), false);
+        XCTAssertTrue(result == bib_calln_ordered_same || result == bib_calln_ordered_ascending);
+    }
+    for (size_t index = 0; index < count; index += 1) {
+        bib_lc_calln_deinit(&(nums[index]));
+    }
+    free(nums);
+
+    bib_lc_calln_t pair[2] = {};
+    XCTAssertTrue(bib_lc_calln_init(&(pair[0]), "QA76.9"));
+    XCTAssertTrue(bib_lc_calln_init(&(pair[1]), "QA76.76"));
+    XCTAssertTrue(bib_lc_calln_sort(pair, 2, 0));
+    XCTAssertEqual(strcmp(pair[0].decimal, "76"), 0);
+    XCTAssertEqual(strcmp(pair[1].decimal, "9"), 0);
+    XCTAssertTrue(bib_lc_calln_sort(pair, 1, 0));
+    XCTAssertTrue(bib_lc_calln_sort(pair, 0, 0));
+    bib_lc_calln_deinit(&(pair[0]));
+    bib_lc_calln_deinit(&(pair[1]));
+}
+
+- (void)test_02_encoded_sort_is_stable {
+    size_t const length = BibTestCallNumberStringsCount;
+    size_t const count = 30000;
+    unsigned char **const encodings = calloc(count, sizeof(unsigned char *));
+    size_t *const order = calloc(count, sizeof(size_t));
+    for (size_t index = 0; index < count; index += 1) {
+        bib_lc_calln_t num = {};
+        XCTAssertTrue(bib_lc_calln_init(&num, BibTestCallNumberStrings[(index * 13) % length]));
+        size_t const size = bib_lc_calln_encode(NULL, 0, &num);
+        encodings[index] = malloc(size);
+        XCTAssertEqual(bib_lc_calln_encode(encodings[index], size, &num), size);
+        bib_lc_calln_deinit(&num);
+    }
+    for (unsigned threads = 1; threads <= 8; threads *= 2) {
+        XCTAssertTrue(bib_lc_calln_encoded_sort(order, (unsigned char const *const *)encodings, count, threads));
+        for (size_t index = 1; index < count; index += 1) {
+            int const result = bib_lc_calln_encoded_compare(encodings[order[index - 1]], encodings[order[index]]);
+            XCTAssertTrue(result < 0 || (result == 0 && order[index - 1] < order[index]));
+        }
+    }
+    for (size_t index = 0; index < count; index += 1) {
+        free(encodings[index]);
+    }
+    free(encodings);
+    free(order);
+}
+
+- (void)test_03_sort_call_numbers {
+    NSArray *const strings = @[ @"QA76.9", @"HQ76", @"QA76.76", @"P112", @"QA76", @"P35" ];
+    NSMutableArray<BibLCCallNumber *> *const callNumbers = [NSMutableArray array];
+    [callNumbers addObjectsFromArray:[BibLCCallNumber callNumbersWithStrings:strings]];
+    NSArray<BibLCCallNumber *> *const expected = [callNumbers sortedArrayUsingSelector:@selector(compare:)];
+    XCTAssertEqualObjects([BibLCCallNumber sortCallNumbers:callNumbers inPlace:NO options:0], expected);
+    XCTAssertEqualObjects([callNumbers firstObject], [BibLCCallNumber callNumberWithString:@"QA76.9"]);
+    XCTAssertEqual([BibLCCallNumber sortCallNumbers:callNumbers inPlace:YES options:NSSortConcurrent], callNumbers);
+    XCTAssertEqualObjects(callNumbers, expected);
+    XCTAssertEqualObjects([BibLCCallNumber sortCallNumbers:@[] inPlace:NO options:0], @[]);
+}
+
+@end
@@ -8,6 +8,7 @@
 
 #import <XCTest/XCTest.h>
 #import <Bibliotek/Bibliotek.h>
+#import "bibtypeio.h"
 
 @interface BibStringFormattingTests : XCTestCase
 @property (nonatomic, readonly, strong) BibLCCallNumber *a;
@@ -124,4 +125,50 @@
     XCTAssertEqualObjects([_g stringWithFormatOptions:BibLCCallNumberFormatOptionsSpine], @"Q\n11\n.P6\nn.s.\nv. 56\npt. 9");
 }
 
+- (void)test_h_format_batch {
+    char const *const strs[3] = { "DR1879.5.M37M37 1998", "JZ33.D4 1999 E37", "Q11.P6 n.s. v. 56 pt. 9" };
+    char const *const expected[3] = { "DR\n1879.5\n.M37\nM37\n1998", "JZ\n33\n.D4\n1999\nE37",
+                                      "Q\n11\n.P6\nn.s.\nv. 56\npt. 9" };
+    bib_lc_calln_style_t const style = {
+        .separator = '\n', .split_subject = true, .split_cutters = true, .split_sections = true
+    };
+    bib_lc_calln_t callns[3] = {};
+    for (size_t index = 0; index < 3; index += 1) {
+        XCTAssertTrue(bib_lc_calln_init(&(callns[index]), strs[index]));
+    }
+    size_t offsets[3] = {};
+    size_t const length = bib_lc_calln_format_batch(NULL, 0, offsets, callns, 3, style);
+    XCTAssertEqual(length, strlen(expected[0]) + strlen(expected[1]) + strlen(expected[2]) + 3);
+    XCTAssertEqual(offsets[1], strlen(expected[0]) + 1);
+
+    char buffer[128] = {};
+    XCTAssertEqual(bib_lc_calln_format_batch(buffer, sizeof(buffer), offsets, callns, 3, style), length);
+    for (size_t index = 0; index < 3; index += 1) {
+        XCTAssertEqual(strcmp(&(buffer[offsets[index]]), expected[index]), 0);
+    }
+
+    // a buffer that's too small is filled without writing past its end
+    char small[20];
+    memset(small, 'x', sizeof(small));
+    XCTAssertEqual(bib_lc_calln_format_batch(small, 16, offsets, callns, 3, style), length);
+    XCTAssertEqual(strcmp(small, "DR\n1879.5\n.M37\n"), 0);
+    XCTAssertEqual(small[16], 'x');
+    for (size_t index = 0; index < 3; index += 1) {
+        bib_lc_calln_deinit(&(callns[index]));
+    }
+}
+
+- (void)test_h_strings_with_call_numbers {
+    NSArray<BibLCCallNumber *> *const callNumbers = @[ _a, _c, _e, _g ];
+    NSArray<NSString *> *const spine = @[ @"DR\n1879.5\n.M37\nM37\n1998", @"JZ\n33\n.D4\n1999\nE37",
+                                          @"HF\n5414.13\n.R73\n1978", @"Q\n11\n.P6\nn.s.\nv. 56\npt. 9" ];
+    NSArray<NSString *> *const pocket = @[ @"DR 1879.5 .M37 M37 1998", @"JZ 33 .D4 1999 E37", @"HF 5414.13 .R73 1978",
+                                           @"Q 11 .P6 n.s. v. 56 pt. 9" ];
+    XCTAssertEqualObjects([BibLCCallNumber stringsWithCallNumbers:callNumbers
+                                                    formatOptions:BibLCCallNumberFormatOptionsSpine], spine);
+    XCTAssertEqualObjects([BibLCCallNumber stringsWithCallNumbers:callNumbers
+                                                    formatOptions:BibLCCallNumberFormatOptionsPocket], pocket);
+    XCTAssertEqualObjects([BibLCCallNumber stringsWithCallNumbers:@[] formatOptions:0], @[]);
+}
+
 @end
@@ -12,4 +12,28 @@
 #define BibAssertEqualStrings(expression1, expression2, ...) \
     _XCTPrimitiveAssertEqualObjects(self, @(expression1), @#expression1, @(expression2), @#expression2, __VA_ARGS__)
 
+/// A sample of call numbers covering each part of the call number syntax, for tests that check behavior
+/// across many call numbers at once. Use this list to add test-specific call numbers to a local array.
+#define BibTestCallNumberStringList \
+    "QA76.76.C65 A37 1986", "DR1879.5.M37 M37 1988", "KF4558 15th .K46 1908", "JZ33.D4 1999 E37", \
+    "Q172.J64 2017", "QA76.9.T48 I544 2013", "QA76.73.J39 D83 2014", "DR1879.5.M37 M37 1988/89", \
+    "QL737.C2C37 1984a", "AB32.64.S6L552 vol. 1 1976ab", "DR1879.5 1988.C786 15th.ed. Suppl. 3", \
+    "Q11.P6 n.s. v. 56 pt. 9", "PE1574.F67 2012", "PE1574.L37 2012", "PE1574.L37", "PE1574"
+
+/// The shared sample of call numbers, each of which is a valid call number.
+static char const *const BibTestCallNumberStrings[] = { BibTestCallNumberStringList };
+
+/// The amount of call numbers in ``BibTestCallNumberStrings``.
+static size_t const BibTestCallNumberStringsCount =
+    sizeof(BibTestCallNumberStrings) / sizeof(*BibTestCallNumberStrings);
+
+/// The shared sample of call numbers, as strings that can be given to ``BibLCCallNumber``.
+static inline NSArray<NSString *> *BibTestCallNumberStringArray(void) {
+    NSMutableArray *const strings = [NSMutableArray arrayWithCapacity:BibTestCallNumberStringsCount];
+    for (size_t index = 0; index < BibTestCallNumberStringsCount; index += 1) {
+        [strings addObject:@(BibTestCallNumberStrings[index])];
+    }
+    return strings;
+}
+
 #endif /* BibTestUtils_h */
@@ -0,0 +1,112 @@
+//
+//  BibTokenizerTests.m
+//  LCCallNumberTests
+//
+//  Created by Steve Brunwasser on 10/18/26.
+//  Copyright © 2026 Steve Brunwasser. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "BibTestUtils.h"
+#import "bibtokenizer.h"
+#import "bibparse.h"
+#import "bibtype.h"
+
+@interface BibTokenizerTests : XCTestCase
+@end
+
+@implementation BibTokenizerTests
+
+- (void)test_01_tokenize_call_number {
+    char const *const str = "QA76.76 v. 12";
+    bib_token_t tokens[16] = {};
+    size_t const count = bib_tokenize(tokens, 16, str, strlen(str) + 1);
+    XCTAssertEqual(count, 10);
+    XCTAssertEqual(tokens[0].kind, bib_token_kind_letters);
+    XCTAssertEqual(tokens[0].len, 2);
+    XCTAssertEqual(tokens[1].kind, bib_token_kind_digits);
+    XCTAssertEqual(tokens[1].len, 2);
+    XCTAssertEqual(tokens[2].kind, bib_token_kind_point);
+    XCTAssertEqual(tokens[3].kind, bib_token_kind_digits);
+    XCTAssertEqual(tokens[4].kind, bib_token_kind_space);
+    XCTAssertEqual(tokens[5].kind, bib_token_kind_letters);
+    XCTAssertEqual(tokens[6].kind, bib_token_kind_point);
+    XCTAssertEqual(tokens[7].kind, bib_token_kind_space);
+    XCTAssertEqual(tokens[8].kind, bib_token_kind_digits);
+    XCTAssertEqual(tokens[9].kind, bib_token_kind_stop);
+    XCTAssertEqual(tokens[9].str, &(str[13]));
+}
+
+- (void)test_02_tokenize_merges_letter_case_and_whitespace {
+    char const *const str = "AbC \t\n12";
+    bib_token_t tokens[8] = {};
+    size_t const count = bib_tokenize(tokens, 8, str, strlen(str));
+    XCTAssertEqual(count, 3);
+    XCTAssertEqual(tokens[0].kind, bib_token_kind_letters);
+    XCTAssertEqual(tokens[0].len, 3);
+    XCTAssertEqual(tokens[1].kind, bib_token_kind_space);
+    XCTAssertEqual(tokens[1].len, 3);
+    XCTAssertEqual(tokens[2].kind, bib_token_kind_digits);
+    XCTAssertEqual(tokens[2].len, 2);
+}
+
+- (void)test_03_tokenize_counts_tokens_beyond_capacity {
+    char const *const str = "A1B2C3";
+    bib_token_t tokens[2] = {};
+    XCTAssertEqual(bib_tokenize(tokens, 2, str, strlen(str) + 1), 7);
+    XCTAssertEqual(bib_tokenize(NULL, 0, str, strlen(str) + 1), 7);
+    XCTAssertEqual(tokens[1].kind, bib_token_kind_digits);
+}
+
+- (void)test_04_tokenize_stops_after_null_terminator {
+    char const str[] = "A1\0B2";
+    XCTAssertEqual(bib_tokenize(NULL, 0, str, sizeof(str)), 3);
+}
+
+- (void)test_05_token_lexer_reads_within_tokens {
+    char const *const str = "12345678 abc";
+    bib_token_list_t list = {};
+    XCTAssertTrue(bib_token_list_init(&list, str, strlen(str) + 1));
+    bib_tokbuf_t lexer = bib_tokbuf(&list);
+    bib_digit06_b integer = {};
+    XCTAssertTrue(bib_token_lex_integer(integer, &lexer));
+    BibAssertEqualStrings(integer, "123456");
+    XCTAssertEqual(lexer.offset, 6);
+    XCTAssertFalse(bib_token_read_space(&lexer));
+    bib_digit16_b digits = {};
+    XCTAssertTrue(bib_token_lex_digit16(digits, &lexer));
+    BibAssertEqualStrings(digits, "78");
+    XCTAssertTrue(bib_token_read_space(&lexer));
+    XCTAssertFalse(bib_token_peek_break(&lexer));
+    BibAssertEqualStrings(bib_tokbuf_strbuf(&lexer).str, "abc");
+    bib_token_list_deinit(&list);
+}
+
+- (void)test_06_token_list_allocates_long_input {
+    char str[BIB_TOKEN_LIST_INLINE_CAPACITY * 2 + 1] = {};
+    for (size_t index = 0; index < sizeof(str) - 1; index += 2) {
+        str[index] = 'A';
+        str[index + 1] = '1';
+    }
+    bib_token_list_t list = {};
+    XCTAssertTrue(bib_token_list_init(&list, str, sizeof(str)));
+    XCTAssertEqual(list.length, BIB_TOKEN_LIST_INLINE_CAPACITY * 2 + 1);
+    XCTAssertTrue(list.buffer != list.storage);
+    XCTAssertEqual(list.buffer[list.length - 1].kind, bib_token_kind_stop);
+    bib_token_list_deinit(&list);
+}
+
+- (void)test_07_performance_parse_call_numbers {
+    [self measureBlock:^{
+        for (size_t round = 0; round < 10000; round += 1) {
+            for (size_t index = 0; index < BibTestCallNumberStringsCount; index += 1) {
+                bib_lc_calln_t calln = {};
+                if (bib_lc_calln_init(&calln, BibTestCallNumberStrings[index])) {
+                    bib_lc_calln_deinit(&calln);
+                }
+            }
+        }
+    }];
+}
+
+@end